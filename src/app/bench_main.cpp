@@ -0,0 +1,413 @@
+#include "../core/SDL2Game.h"
+#include "../core/AllocationTracker.h"
+#include "../core/GameState.h"
+#include "../core/Random.h"
+#include "../game/BattleState.h"
+#include "../entities/Enemy.h"
+#include "../entities/Player.h"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// ヘッドレスでゲームを動かし、決まった入力を与えたシナリオごとにフレーム時間・ヒープ確保・描画数を計測する
+
+namespace {
+    const char* const SAVE_DIRECTORY = "assets/saves/";
+    const char* const BENCH_SAVE_FILE = "bench_save.json";
+    const int BATTLE_LEVEL = 20;             // 戦闘シナリオのプレイヤーと敵のレベル
+    const int BATTLE_MAX_FRAMES = 3600;      // 戦闘が終わらない場合の打ち切り（フレーム）
+    const int ENTER_INTERVAL_FRAMES = 8;     // 決定キーを押す間隔（フレーム）
+    const int WALK_SEGMENT_FRAMES = 60;      // 同じ方向に歩き続けるフレーム数
+    const uint64_t BENCH_SEED = 0x2D52504742454E43ULL;  // 乱数のシードの元（シナリオ名と組み合わせる）
+
+    // EnemyTypeの順に並べた名前（--debugのbattle_*と揃える）
+    constexpr const char* ENEMY_TYPE_NAMES[] = {
+        "slime", "goblin", "orc", "dragon", "goblin_king", "orc_lord", "dragon_lord",
+        "skeleton", "ghost", "vampire", "demon_soldier", "werewolf", "minotaur", "cyclops",
+        "gargoyle", "phantom", "dark_knight", "ice_giant", "fire_demon", "shadow_lord",
+        "ancient_dragon", "chaos_beast", "elder_god", "demon_lord", "guard", "king"
+    };
+    constexpr int ENEMY_TYPE_COUNT = sizeof(ENEMY_TYPE_NAMES) / sizeof(ENEMY_TYPE_NAMES[0]);
+    static_assert(ENEMY_TYPE_COUNT == static_cast<int>(EnemyType::KING) + 1, "ENEMY_TYPE_NAMES must list every EnemyType");
+
+    /**
+     * @brief 計測シナリオ
+     */
+    struct Scenario {
+        std::string name;
+        std::string debugStartState;                     // 開始するデバッグ状態（SDL2Game::setDebugStartState）
+        int maxFrames;                                   // 打ち切りのフレーム数
+        std::function<void(SDL2Game&)> setup;            // initialize()の後、run()の前に呼び出す
+        std::function<bool(SDL2Game&, int)> script;      // 毎フレームの開始時に呼び出す（falseで終了）
+    };
+
+    /**
+     * @brief 1シナリオ分の計測結果（フレームごと）
+     */
+    struct ScenarioResult {
+        std::string name;
+        uint64_t seed = 0;       // 乱数のシード
+        bool completed = false;  // スクリプトが終了を返したか（falseはフレーム数の上限で打ち切り）
+        std::vector<double> frameMs;
+        std::vector<double> allocationCounts;
+        std::vector<double> allocationBytes;
+        std::vector<double> drawCalls;
+        std::vector<double> textureSwitches;
+    };
+
+    void pushKey(SDL_Keycode key, bool down) {
+        SDL_Event event;
+        std::memset(&event, 0, sizeof(event));
+        event.type = down ? SDL_KEYDOWN : SDL_KEYUP;
+        event.key.keysym.sym = key;
+        SDL_PushEvent(&event);
+    }
+
+    /**
+     * @brief 一定間隔で決定キーを押して離す
+     */
+    void tapEnter(int frame) {
+        if (frame % ENTER_INTERVAL_FRAMES == 0) {
+            pushKey(SDLK_RETURN, true);
+        } else if (frame % ENTER_INTERVAL_FRAMES == 1) {
+            pushKey(SDLK_RETURN, false);
+        }
+    }
+
+    /**
+     * @brief 右・下・左・上の順に一定フレームずつ歩く
+     */
+    void walkInSquare(int frame) {
+        static const SDL_Keycode directions[] = {SDLK_RIGHT, SDLK_DOWN, SDLK_LEFT, SDLK_UP};
+        if (frame % WALK_SEGMENT_FRAMES == 0) {
+            const int segment = frame / WALK_SEGMENT_FRAMES;
+            if (segment > 0) {
+                pushKey(directions[(segment - 1) % 4], false);
+            }
+            pushKey(directions[segment % 4], true);
+        }
+    }
+
+    double percentile(std::vector<double> values, double ratio) {
+        if (values.empty()) {
+            return 0.0;
+        }
+        std::sort(values.begin(), values.end());
+        const size_t index = static_cast<size_t>(ratio * (values.size() - 1) + 0.5);
+        return values[std::min(index, values.size() - 1)];
+    }
+
+    double mean(const std::vector<double>& values) {
+        if (values.empty()) {
+            return 0.0;
+        }
+        double sum = 0.0;
+        for (double value : values) {
+            sum += value;
+        }
+        return sum / values.size();
+    }
+
+    double maximum(const std::vector<double>& values) {
+        return values.empty() ? 0.0 : *std::max_element(values.begin(), values.end());
+    }
+
+    /**
+     * @brief 戦闘シナリオの作成
+     * @param type 敵の種類
+     * @param desperate 窮地モード（6ターン）で戦うか
+     */
+    Scenario makeBattleScenario(int type, bool desperate) {
+        Scenario scenario;
+        scenario.name = std::string("battle_") + ENEMY_TYPE_NAMES[type] + (desperate ? "_6turn" : "_3turn");
+        // フィールドから開始して戦闘に置き換える（デバッグ開始ではセーブデータを読み込まない）
+        scenario.debugStartState = "field";
+        scenario.maxFrames = BATTLE_MAX_FRAMES;
+        scenario.setup = [type, desperate](SDL2Game& game) {
+            std::shared_ptr<Player> player = game.getPlayer();
+            SDL2Game::setupPlayerForBattle(player, BATTLE_LEVEL);
+            if (desperate) {
+                // HPが30%以下だと最初のコマンド選択の前に窮地モードの選択肢が出る（決定キーで大勝負を選ぶ）
+                player->setHp(player->getMaxHp() * 3 / 10);
+            }
+            auto enemy = std::make_unique<Enemy>(static_cast<EnemyType>(type));
+            enemy->setLevel(BATTLE_LEVEL);
+            game.getStateManager().changeState(std::make_unique<BattleState>(player, std::move(enemy)));
+        };
+        auto enteredBattle = std::make_shared<bool>(false);
+        scenario.script = [enteredBattle](SDL2Game& game, int frame) {
+            const bool inBattle = game.getStateManager().getCurrentStateType() == StateType::BATTLE;
+            if (inBattle) {
+                *enteredBattle = true;
+            } else if (*enteredBattle) {
+                return false;  // 勝敗が決まって戦闘から抜けた
+            }
+            tapEnter(frame);
+            return true;
+        };
+        return scenario;
+    }
+
+    std::vector<Scenario> makeScenarios() {
+        std::vector<Scenario> scenarios;
+        for (int type = 0; type < ENEMY_TYPE_COUNT; type++) {
+            scenarios.push_back(makeBattleScenario(type, false));
+            scenarios.push_back(makeBattleScenario(type, true));
+        }
+
+        // フィールドを歩き回る（エンカウントした戦闘も決定キーで進める）
+        Scenario fieldWalk;
+        fieldWalk.name = "field_walk";
+        fieldWalk.debugStartState = "field";
+        fieldWalk.maxFrames = 1800;
+        fieldWalk.script = [](SDL2Game&, int frame) {
+            walkInSquare(frame);
+            tapEnter(frame);
+            return true;
+        };
+        scenarios.push_back(fieldWalk);
+
+        // 夜の街で衛兵の巡回を見ながら歩く
+        Scenario nightPatrol;
+        nightPatrol.name = "night_patrol";
+        nightPatrol.debugStartState = "night";
+        nightPatrol.maxFrames = 1200;
+        nightPatrol.script = [](SDL2Game&, int frame) {
+            walkInSquare(frame);
+            return true;
+        };
+        scenarios.push_back(nightPatrol);
+
+        // 毎フレームセーブし、別のプレイヤーに読み込み直す
+        Scenario saveLoad;
+        saveLoad.name = "save_load";
+        saveLoad.debugStartState = "night100";
+        saveLoad.maxFrames = 300;
+        saveLoad.script = [](SDL2Game& game, int) {
+            game.getPlayer()->saveGame(BENCH_SAVE_FILE);
+            Player loaded("勇者");
+            float nightTimer = 0.0f;
+            bool nightTimerActive = false;
+            if (!loaded.loadGame(BENCH_SAVE_FILE, nightTimer, nightTimerActive)) {
+                std::cerr << "警告: save_load: " << BENCH_SAVE_FILE << " の読み込みに失敗しました" << std::endl;
+                return false;
+            }
+            return true;
+        };
+        scenarios.push_back(saveLoad);
+
+        return scenarios;
+    }
+
+    bool runScenario(const Scenario& scenario, ScenarioResult& result) {
+        result.name = scenario.name;
+
+        // 実行ごと・コミットごとに結果を比べられるよう、戦闘の結果や敵の配置が毎回同じになるシードを使う
+        // （開始状態の作成でも乱数を使うため、initialize()の前に設定する）
+        result.seed = BENCH_SEED;
+        for (char c : scenario.name) {
+            result.seed = (result.seed ^ static_cast<unsigned char>(c)) * 0x100000001B3ULL;
+        }
+        Random::getInstance().seed(result.seed);
+
+        SDL2Game game;
+        game.setDebugStartState(scenario.debugStartState);
+        game.setHeadless(true);
+        game.setMaxFrames(scenario.maxFrames);
+        if (!game.initialize()) {
+            std::cerr << "警告: " << scenario.name << ": ゲームの初期化に失敗しました" << std::endl;
+            return false;
+        }
+        if (scenario.setup) {
+            scenario.setup(game);
+        }
+
+        // コールバックは各フレームの開始時に呼ばれるので、前回の呼び出しからの差分が直前の1フレーム分になる
+        // （スクリプトの処理も含む。入力の送信は無視できる程度で、save_loadではセーブとロードが計測対象になる）
+        auto lastTime = std::chrono::high_resolution_clock::now();
+        uint64_t lastCount = AllocationTracker::getTotalCount();
+        uint64_t lastBytes = AllocationTracker::getTotalBytes();
+        game.setFrameCallback([&](int frame) {
+            const auto now = std::chrono::high_resolution_clock::now();
+            const uint64_t count = AllocationTracker::getTotalCount();
+            const uint64_t bytes = AllocationTracker::getTotalBytes();
+            if (frame > 0) {
+                const RenderStats& stats = game.getGraphics().getRenderStats();
+                result.frameMs.push_back(std::chrono::duration<double, std::milli>(now - lastTime).count());
+                result.allocationCounts.push_back(static_cast<double>(count - lastCount));
+                result.allocationBytes.push_back(static_cast<double>(bytes - lastBytes));
+                result.drawCalls.push_back(stats.drawCalls);
+                result.textureSwitches.push_back(stats.textureSwitches);
+            }
+            lastTime = now;
+            lastCount = count;
+            lastBytes = bytes;
+            const bool keepRunning = !scenario.script || scenario.script(game, frame);
+            if (!keepRunning) {
+                result.completed = true;
+            }
+            return keepRunning;
+        });
+        game.run();
+        return true;
+    }
+
+    nlohmann::json toJson(const ScenarioResult& result) {
+        nlohmann::json j;
+        j["name"] = result.name;
+        j["seed"] = result.seed;
+        j["frames"] = result.frameMs.size();
+        j["completed"] = result.completed;
+        j["frame_ms"] = {
+            {"p50", percentile(result.frameMs, 0.50)},
+            {"p90", percentile(result.frameMs, 0.90)},
+            {"p99", percentile(result.frameMs, 0.99)},
+            {"max", maximum(result.frameMs)},
+            {"mean", mean(result.frameMs)}
+        };
+        if (AllocationTracker::isAvailable()) {
+            j["allocations"] = {
+                {"per_frame_mean", mean(result.allocationCounts)},
+                {"per_frame_p50", percentile(result.allocationCounts, 0.50)},
+                {"per_frame_max", maximum(result.allocationCounts)},
+                {"bytes_per_frame_mean", mean(result.allocationBytes)}
+            };
+        } else {
+            j["allocations"] = nullptr;
+        }
+        j["draw_calls"] = {
+            {"mean", mean(result.drawCalls)},
+            {"max", maximum(result.drawCalls)}
+        };
+        j["texture_switches"] = {
+            {"mean", mean(result.textureSwitches)},
+            {"max", maximum(result.textureSwitches)}
+        };
+        return j;
+    }
+
+    /**
+     * @brief ファイルの内容の退避（ベンチマーク中のオートセーブで上書きされるため）
+     */
+    bool readFile(const std::string& path, std::string& content) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+        std::ostringstream buffer;
+        buffer << file.rdbuf();
+        content = buffer.str();
+        return true;
+    }
+}
+
+void printUsage(const char* programName) {
+    std::cout << "Usage: " << programName << " [options]\n";
+    std::cout << "Runs scripted scenarios headlessly and reports frame time percentiles, heap allocations and draw calls.\n";
+    std::cout << "Options:\n";
+    std::cout << "  --output <json>    Write the results to the given file (default: bench_results.json)\n";
+    std::cout << "  --scenario <name>  Run only scenarios whose name contains <name> (e.g. battle_slime, 6turn, field_walk)\n";
+    std::cout << "  --list             List the scenario names and exit\n";
+    std::cout << "  -h, --help         Show this help message\n";
+}
+
+int main(int argc, char* argv[]) {
+    std::string outputPath = "bench_results.json";
+    std::string filter = "";
+    bool listOnly = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+            printUsage(argv[0]);
+            return 0;
+        } else if (strcmp(argv[i], "--output") == 0) {
+            if (i + 1 < argc) {
+                outputPath = argv[i + 1];
+                i++;
+            } else {
+                std::cerr << "Error: --output requires a file path\n";
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--scenario") == 0) {
+            if (i + 1 < argc) {
+                filter = argv[i + 1];
+                i++;
+            } else {
+                std::cerr << "Error: --scenario requires a scenario name\n";
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--list") == 0) {
+            listOnly = true;
+        } else {
+            std::cerr << "Unknown option: " << argv[i] << "\n";
+            std::cerr << "Use --help for usage information.\n";
+            return 1;
+        }
+    }
+
+    std::vector<Scenario> scenarios;
+    for (const Scenario& scenario : makeScenarios()) {
+        if (filter.empty() || scenario.name.find(filter) != std::string::npos) {
+            scenarios.push_back(scenario);
+        }
+    }
+    if (listOnly) {
+        for (const Scenario& scenario : scenarios) {
+            std::cout << scenario.name << "\n";
+        }
+        return 0;
+    }
+    if (scenarios.empty()) {
+        std::cerr << "Error: no scenario matches " << filter << "\n";
+        return 1;
+    }
+
+    // 戦闘の勝利時などにオートセーブが書き込まれるので、終了後に元に戻す
+    const std::string autosavePath = std::string(SAVE_DIRECTORY) + "autosave.json";
+    std::string autosave;
+    const bool hadAutosave = readFile(autosavePath, autosave);
+
+    nlohmann::json results;
+    results["allocation_tracking"] = AllocationTracker::isAvailable();
+    results["scenarios"] = nlohmann::json::array();
+    int exitCode = 0;
+    try {
+        for (const Scenario& scenario : scenarios) {
+            std::cout << "[bench] " << scenario.name << std::endl;
+            ScenarioResult result;
+            if (!runScenario(scenario, result)) {
+                exitCode = 1;
+                continue;
+            }
+            results["scenarios"].push_back(toJson(result));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "エラーが発生しました: " << e.what() << std::endl;
+        exitCode = 1;
+    }
+
+    if (hadAutosave) {
+        std::ofstream file(autosavePath, std::ios::binary);
+        file << autosave;
+    } else {
+        std::remove(autosavePath.c_str());
+    }
+    std::remove((std::string(SAVE_DIRECTORY) + BENCH_SAVE_FILE).c_str());
+
+    std::ofstream output(outputPath);
+    if (!output.is_open()) {
+        std::cerr << "Error: cannot open " << outputPath << "\n";
+        return 1;
+    }
+    output << results.dump(2) << std::endl;
+    std::cout << "Wrote " << scenarios.size() << " scenarios to " << outputPath << std::endl;
+    return exitCode;
+}
@@ -2,6 +2,7 @@
 #include <iostream>
 #include <string>
 #include <cstring>
+#include <cstdlib>
 
 void printUsage(const char* programName) {
     std::cout << "Usage: " << programName << " [options]\n";
@@ -14,6 +15,15 @@ void printUsage(const char* programName) {
     std::cout << "                                     battle_dark_knight, battle_ice_giant, battle_fire_demon, battle_shadow_lord,\n";
     std::cout << "                                     battle_ancient_dragon, battle_chaos_beast, battle_elder_god, battle_demon_lord,\n";
     std::cout << "                                     battle_guard, battle_king\n";
+    std::cout << "  --headless         Render offscreen with the software renderer (no window, no vsync)\n";
+    std::cout << "  --frames <n>       Exit after n frames and print the average frame time\n";
+    std::cout << "  --screenshot <png> Save the last frame as a PNG file on exit\n";
+    std::cout << "  --trace <json>     Record trace zones and write them on exit or F4 (chrome://tracing / Perfetto)\n";
+    std::cout << "  --render-stats <csv> Write per-frame renderer counters (draw calls, texture switches, ...) as CSV\n";
+    std::cout << "  --record <file>    Record input events (with frame numbers and the RNG seed) to a binary file (starts a new game without the save data)\n";
+    std::cout << "  --replay <file>    Replay recorded input as fast as possible and exit at the last recorded frame\n";
+    std::cout << "                     (sessions started from save data replay correctly only with the same autosave)\n";
+    std::cout << "  --no-render        Skip rendering and only update the game (use with --replay --headless)\n";
     std::cout << "  -h, --help         Show this help message\n";
     std::cout << "\nExamples:\n";
     std::cout << "  " << programName << "                    # Start from main menu (normal)\n";
@@ -34,10 +44,21 @@ void printUsage(const char* programName) {
     std::cout << "  " << programName << " --debug battle_orc # Start battle with orc (player and enemy both level 10)\n";
     std::cout << "  " << programName << " --debug battle_dragon # Start battle with dragon (player and enemy both level 15)\n";
     std::cout << "  " << programName << " --debug battle_demon_lord # Start battle with demon lord (player and enemy both level 100)\n";
+    std::cout << "  " << programName << " --headless --debug field --frames 600 # Render 600 field frames without a display\n";
+    std::cout << "  " << programName << " --debug field --record session.rec     # Play and record the input\n";
+    std::cout << "  " << programName << " --headless --no-render --replay session.rec # Replay the session without rendering\n";
 }
 
 int main(int argc, char* argv[]) {
     std::string debugStartState = "";
+    bool headless = false;
+    int maxFrames = 0;
+    std::string screenshotPath = "";
+    std::string tracePath = "";
+    std::string renderStatsPath = "";
+    std::string recordPath = "";
+    std::string replayPath = "";
+    bool renderEnabled = true;
     
     for (int i = 1; i < argc; i++) {
         if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
@@ -53,6 +74,58 @@ int main(int argc, char* argv[]) {
                 std::cerr << "Battle states: battle_slime, battle_goblin, battle_orc, battle_dragon, battle_skeleton, battle_ghost, battle_vampire, battle_demon_soldier, battle_werewolf, battle_minotaur, battle_cyclops, battle_gargoyle, battle_phantom, battle_dark_knight, battle_ice_giant, battle_fire_demon, battle_shadow_lord, battle_ancient_dragon, battle_chaos_beast, battle_elder_god, battle_demon_lord, battle_guard, battle_king\n";
                 return 1;
             }
+        } else if (strcmp(argv[i], "--headless") == 0) {
+            headless = true;
+        } else if (strcmp(argv[i], "--frames") == 0) {
+            if (i + 1 < argc && std::atoi(argv[i + 1]) > 0) {
+                maxFrames = std::atoi(argv[i + 1]);
+                i++;
+            } else {
+                std::cerr << "Error: --frames requires a positive frame count\n";
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--screenshot") == 0) {
+            if (i + 1 < argc) {
+                screenshotPath = argv[i + 1];
+                i++;
+            } else {
+                std::cerr << "Error: --screenshot requires a file path\n";
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--trace") == 0) {
+            if (i + 1 < argc) {
+                tracePath = argv[i + 1];
+                i++;
+            } else {
+                std::cerr << "Error: --trace requires a file path\n";
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--render-stats") == 0) {
+            if (i + 1 < argc) {
+                renderStatsPath = argv[i + 1];
+                i++;
+            } else {
+                std::cerr << "Error: --render-stats requires a file path\n";
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--record") == 0) {
+            if (i + 1 < argc) {
+                recordPath = argv[i + 1];
+                i++;
+            } else {
+                std::cerr << "Error: --record requires a file path\n";
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--replay") == 0) {
+            if (i + 1 < argc) {
+                replayPath = argv[i + 1];
+                i++;
+            } else {
+                std::cerr << "Error: --replay requires a file path\n";
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--no-render") == 0) {
+            renderEnabled = false;
         } else {
             std::cerr << "Unknown option: " << argv[i] << "\n";
             std::cerr << "Use --help for usage information.\n";
@@ -60,12 +133,35 @@ int main(int argc, char* argv[]) {
         }
     }
     
+    if (!recordPath.empty() && !replayPath.empty()) {
+        std::cerr << "Error: --record and --replay cannot be used together\n";
+        return 1;
+    }
+    
     try {
         SDL2Game game;
         
         if (!debugStartState.empty()) {
             game.setDebugStartState(debugStartState);
         }
+        game.setHeadless(headless);
+        game.setMaxFrames(maxFrames);
+        if (!screenshotPath.empty()) {
+            game.setScreenshotPath(screenshotPath);
+        }
+        if (!tracePath.empty()) {
+            game.setTracePath(tracePath);
+        }
+        if (!renderStatsPath.empty()) {
+            game.setRenderStatsPath(renderStatsPath);
+        }
+        if (!recordPath.empty()) {
+            game.setRecordPath(recordPath);
+        }
+        if (!replayPath.empty()) {
+            game.setReplayPath(replayPath);
+        }
+        game.setRenderEnabled(renderEnabled);
         
         if (!game.initialize()) {
             std::cerr << "ゲームの初期化に失敗しました。" << std::endl;
@@ -0,0 +1,56 @@
+#include "AllocationTracker.h"
+#include <cstdlib>
+#include <new>
+
+// グローバルなoperator new/deleteの置き換え（確保はmalloc/freeで行い、回数とバイト数だけを記録する）
+// このファイルは計測する実行ファイルにだけリンクする（CMakeのENABLE_ALLOCATION_TRACKINGとベンチマーク）
+
+namespace {
+    const bool hooksRegistered = AllocationTracker::registerHooks();
+}
+
+void* operator new(size_t size) {
+    AllocationTracker::recordAllocation(size);
+    void* pointer = std::malloc(size == 0 ? 1 : size);
+    if (!pointer) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    AllocationTracker::recordAllocation(size);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept {
+    return operator new(size, tag);
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+    std::free(pointer);
+}
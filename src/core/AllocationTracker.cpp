@@ -0,0 +1,190 @@
+#include "AllocationTracker.h"
+#include "GameState.h"
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+
+namespace {
+    constexpr size_t ZONE_TABLE_SIZE = 128;  // 集計できる区間名の数（超えた分は「その他」に加算）
+
+    /**
+     * @brief 区間名ごとの集計（operator new内で使うため、固定長の表にロックなしで加算する）
+     */
+    struct ZoneCounter {
+        std::atomic<const char*> name;
+        std::atomic<uint64_t> count;
+        std::atomic<uint64_t> bytes;
+    };
+
+    bool hooksLinked = false;  // AllocationHooks.cppがリンクされているか
+    std::atomic<uint64_t> totalCount(0);
+    std::atomic<uint64_t> totalBytes(0);
+    ZoneCounter zoneTable[ZONE_TABLE_SIZE];
+    ZoneCounter overflowZone;
+
+    thread_local const char* currentZone = nullptr;
+    thread_local int suppressDepth = 0;  // 計測自身の確保を数えないための深さ
+
+    /**
+     * @brief 計測自身の処理中は確保を数えないRAIIクラス
+     */
+    struct SuppressScope {
+        SuppressScope() { suppressDepth++; }
+        ~SuppressScope() { suppressDepth--; }
+    };
+
+    ZoneCounter& findZone(const char* name) {
+        // 区間名は文字列リテラルなので、ポインタをそのままキーにする
+        size_t index = (reinterpret_cast<uintptr_t>(name) >> 3) % ZONE_TABLE_SIZE;
+        for (size_t probe = 0; probe < ZONE_TABLE_SIZE; probe++) {
+            ZoneCounter& zone = zoneTable[(index + probe) % ZONE_TABLE_SIZE];
+            const char* current = zone.name.load(std::memory_order_acquire);
+            if (current == name) {
+                return zone;
+            }
+            if (!current) {
+                const char* expected = nullptr;
+                if (zone.name.compare_exchange_strong(expected, name, std::memory_order_acq_rel) || expected == name) {
+                    return zone;
+                }
+            }
+        }
+        return overflowZone;
+    }
+
+    uint64_t median(std::vector<uint64_t> values) {
+        if (values.empty()) {
+            return 0;
+        }
+        std::nth_element(values.begin(), values.begin() + values.size() / 2, values.end());
+        return values[values.size() / 2];
+    }
+}
+
+AllocationTracker::Zone::Zone(const char* name) : previous(currentZone) {
+    currentZone = name;
+}
+
+AllocationTracker::Zone::~Zone() {
+    currentZone = previous;
+}
+
+AllocationTracker::AllocationTracker()
+    : frameStartCount(0), frameStartBytes(0), trackedFrames(0), inFrame(false) {
+}
+
+AllocationTracker& AllocationTracker::getInstance() {
+    static AllocationTracker instance;
+    return instance;
+}
+
+bool AllocationTracker::isAvailable() {
+    return hooksLinked;
+}
+
+bool AllocationTracker::registerHooks() {
+    hooksLinked = true;
+    return true;
+}
+
+uint64_t AllocationTracker::getTotalCount() {
+    return totalCount.load(std::memory_order_relaxed);
+}
+
+uint64_t AllocationTracker::getTotalBytes() {
+    return totalBytes.load(std::memory_order_relaxed);
+}
+
+void AllocationTracker::recordAllocation(size_t bytes) {
+    if (suppressDepth > 0) {
+        return;
+    }
+    totalCount.fetch_add(1, std::memory_order_relaxed);
+    totalBytes.fetch_add(bytes, std::memory_order_relaxed);
+    if (currentZone) {
+        ZoneCounter& zone = findZone(currentZone);
+        zone.count.fetch_add(1, std::memory_order_relaxed);
+        zone.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+}
+
+void AllocationTracker::beginFrame() {
+    if (!isAvailable()) {
+        return;
+    }
+    inFrame = true;
+    frameStartCount = totalCount.load(std::memory_order_relaxed);
+    frameStartBytes = totalBytes.load(std::memory_order_relaxed);
+}
+
+void AllocationTracker::endFrame(StateType stateType) {
+    if (!isAvailable() || !inFrame) {
+        return;
+    }
+    inFrame = false;
+    const uint64_t count = totalCount.load(std::memory_order_relaxed) - frameStartCount;
+    const uint64_t bytes = totalBytes.load(std::memory_order_relaxed) - frameStartBytes;
+
+    SuppressScope suppress;
+    trackedFrames++;
+    StateHistory& history = histories[stateType];
+    if (history.recentCounts.empty()) {
+        history.recentCounts.resize(HISTORY_SIZE, 0);
+        history.recentBytes.resize(HISTORY_SIZE, 0);
+    }
+    history.frames++;
+    history.peakCount = std::max(history.peakCount, count);
+    history.peakBytes = std::max(history.peakBytes, bytes);
+    history.recentCounts[history.next] = static_cast<uint32_t>(std::min<uint64_t>(count, UINT32_MAX));
+    history.recentBytes[history.next] = bytes;
+    history.next = (history.next + 1) % HISTORY_SIZE;
+}
+
+void AllocationTracker::printReport(std::ostream& out) const {
+    if (!isAvailable()) {
+        return;
+    }
+    SuppressScope suppress;
+
+    out << "=== ヒープ確保（1フレームあたり） ===" << std::endl;
+    out << std::left << std::setw(14) << "state" << std::right
+        << std::setw(8) << "frames" << std::setw(12) << "steady" << std::setw(14) << "steady bytes"
+        << std::setw(10) << "peak" << std::setw(14) << "peak bytes" << std::endl;
+    for (const auto& pair : histories) {
+        const StateHistory& history = pair.second;
+        // 定常状態は直近のフレームの中央値とする（状態遷移直後などの一時的な確保の影響を受けにくい）
+        const size_t filled = static_cast<size_t>(std::min<uint64_t>(history.frames, HISTORY_SIZE));
+        std::vector<uint64_t> counts(history.recentCounts.begin(), history.recentCounts.begin() + filled);
+        std::vector<uint64_t> bytes(history.recentBytes.begin(), history.recentBytes.begin() + filled);
+        out << std::left << std::setw(14) << getStateTypeName(pair.first) << std::right
+            << std::setw(8) << history.frames << std::setw(12) << median(counts) << std::setw(14) << median(bytes)
+            << std::setw(10) << history.peakCount << std::setw(14) << history.peakBytes << std::endl;
+    }
+
+    // 区間ごとの合計（計測開始からの累計を、計測したフレーム数で割った平均も示す）
+    std::vector<const ZoneCounter*> zones;
+    for (const ZoneCounter& zone : zoneTable) {
+        if (zone.name.load() && zone.count.load() > 0) {
+            zones.push_back(&zone);
+        }
+    }
+    std::sort(zones.begin(), zones.end(), [](const ZoneCounter* a, const ZoneCounter* b) {
+        return a->count.load() > b->count.load();
+    });
+    const double frames = trackedFrames > 0 ? static_cast<double>(trackedFrames) : 1.0;
+    out << "=== ヒープ確保（区間別、" << trackedFrames << " フレーム） ===" << std::endl;
+    out << std::left << std::setw(44) << "zone" << std::right
+        << std::setw(12) << "count" << std::setw(14) << "bytes" << std::setw(12) << "count/frame" << std::endl;
+    out << std::fixed << std::setprecision(2);
+    for (const ZoneCounter* zone : zones) {
+        out << std::left << std::setw(44) << zone->name.load() << std::right
+            << std::setw(12) << zone->count.load() << std::setw(14) << zone->bytes.load()
+            << std::setw(12) << zone->count.load() / frames << std::endl;
+    }
+    if (overflowZone.count.load() > 0) {
+        out << std::left << std::setw(44) << "(other)" << std::right
+            << std::setw(12) << overflowZone.count.load() << std::setw(14) << overflowZone.bytes.load()
+            << std::setw(12) << overflowZone.count.load() / frames << std::endl;
+    }
+    out << std::defaultfloat;
+}
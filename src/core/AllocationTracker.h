@@ -0,0 +1,117 @@
+/**
+ * @file AllocationTracker.h
+ * @brief ヒープ確保の計測を担当するクラス
+ * @details AllocationHooks.cppをリンクした実行ファイルでのみ、グローバルなoperator newを置き換えて
+ * 確保回数と確保バイト数を数える。リンクしない場合は何も計測せず、各関数は即座に戻る。
+ */
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <vector>
+
+enum class StateType;
+
+/**
+ * @brief ヒープ確保の計測を担当するクラス（シングルトン）
+ * @details フレームごとの確保数をゲーム状態ごとに集計し、ピークと定常状態（中央値）を報告する。
+ * Zoneで囲んだ区間（TRACE_SCOPEを含む）の確保は、最も内側の区間名ごとにも集計する。
+ */
+class AllocationTracker {
+public:
+    /**
+     * @brief 確保を区間名に割り当てるRAIIクラス
+     */
+    class Zone {
+    public:
+        explicit Zone(const char* name);
+        ~Zone();
+        Zone(const Zone&) = delete;
+        Zone& operator=(const Zone&) = delete;
+
+    private:
+        const char* previous;
+    };
+
+    AllocationTracker(const AllocationTracker&) = delete;
+    AllocationTracker& operator=(const AllocationTracker&) = delete;
+
+    /**
+     * @brief インスタンスの取得
+     * @return AllocationTrackerへの参照
+     */
+    static AllocationTracker& getInstance();
+
+    /**
+     * @brief 計測がビルドに含まれているか
+     * @return AllocationHooks.cppがリンクされているか
+     */
+    static bool isAvailable();
+
+    /**
+     * @brief 計測の有効化（AllocationHooks.cppの静的変数の初期化で呼び出す）
+     * @return 常にtrue
+     */
+    static bool registerHooks();
+
+    /**
+     * @brief 起動からの確保回数の合計
+     * @return 確保回数
+     */
+    static uint64_t getTotalCount();
+
+    /**
+     * @brief 起動からの確保バイト数の合計
+     * @return バイト数
+     */
+    static uint64_t getTotalBytes();
+
+    /**
+     * @brief ヒープ確保の記録（operator newから呼び出す）
+     * @param bytes 確保したバイト数
+     */
+    static void recordAllocation(size_t bytes);
+
+    /**
+     * @brief フレームの計測開始
+     */
+    void beginFrame();
+
+    /**
+     * @brief フレームの計測終了
+     * @param stateType このフレームを処理したゲーム状態
+     */
+    void endFrame(StateType stateType);
+
+    /**
+     * @brief 集計結果の出力
+     * @param out 出力先
+     */
+    void printReport(std::ostream& out) const;
+
+private:
+    AllocationTracker();
+
+    static constexpr size_t HISTORY_SIZE = 600;  // 定常状態の算出に使うフレーム数（ゲーム状態ごと）
+
+    /**
+     * @brief ゲーム状態ごとのフレーム単位の集計
+     */
+    struct StateHistory {
+        uint64_t frames = 0;
+        uint64_t peakCount = 0;
+        uint64_t peakBytes = 0;
+        std::vector<uint32_t> recentCounts;  // 直近HISTORY_SIZEフレームの確保回数（リングバッファ）
+        std::vector<uint64_t> recentBytes;   // 直近HISTORY_SIZEフレームの確保バイト数（リングバッファ）
+        size_t next = 0;
+    };
+
+    uint64_t frameStartCount;
+    uint64_t frameStartBytes;
+    uint64_t trackedFrames;
+    bool inFrame;
+    std::map<StateType, StateHistory> histories;
+};
@@ -0,0 +1,126 @@
+#include "AssetLoader.h"
+#include "AudioManager.h"
+#include "Trace.h"
+#include <algorithm>
+#include <iostream>
+
+AssetLoader::AssetLoader() : nextJob(0), uploadedCount(0) {
+}
+
+AssetLoader::~AssetLoader() {
+    joinWorkers();
+    for (auto& job : jobs) {
+        Graphics::freeDecodedImage(job.image);
+        if (job.chunk) {
+            Mix_FreeChunk(job.chunk);
+        }
+    }
+}
+
+void AssetLoader::addImage(const std::string& filepath, const std::string& name) {
+    if (!workers.empty()) {
+        std::cerr << "警告: AssetLoader::addImage: start()後は登録できません: " << filepath << std::endl;
+        return;
+    }
+    for (auto& job : jobs) {
+        if (job.type == Job::Type::IMAGE && job.filepath == filepath) {
+            job.names.push_back(name);
+            return;
+        }
+    }
+    jobs.push_back({Job::Type::IMAGE, filepath, {name}, DecodedImage(), nullptr, ""});
+}
+
+void AssetLoader::addSound(const std::string& filepath, const std::string& name) {
+    if (!workers.empty()) {
+        std::cerr << "警告: AssetLoader::addSound: start()後は登録できません: " << filepath << std::endl;
+        return;
+    }
+    jobs.push_back({Job::Type::SOUND, filepath, {name}, DecodedImage(), nullptr, ""});
+}
+
+void AssetLoader::start() {
+    if (!workers.empty() || jobs.empty()) {
+        return;
+    }
+    // メインスレッドは転送と描画を行うだけなので、全コアをデコードに使う
+    const int workerCount = std::max(1, std::min(SDL_GetCPUCount(), static_cast<int>(jobs.size())));
+    workers.reserve(workerCount);
+    for (int i = 0; i < workerCount; i++) {
+        workers.emplace_back(&AssetLoader::workerLoop, this);
+    }
+}
+
+void AssetLoader::workerLoop() {
+    Trace::setThreadName("AssetLoader");
+    while (true) {
+        const size_t index = nextJob.fetch_add(1);
+        if (index >= jobs.size()) {
+            return;
+        }
+
+        // 各ジョブは1つのワーカーだけが書き込み、completedに積まれるまでメインスレッドは読まない
+        Job& job = jobs[index];
+        TRACE_SCOPE("AssetLoader::decode");
+        if (job.type == Job::Type::IMAGE) {
+            Graphics::decodeImage(job.filepath, job.image);
+        } else {
+            job.chunk = Mix_LoadWAV(job.filepath.c_str());
+            if (!job.chunk) {
+                job.error = Mix_GetError();
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(completedMutex);
+        completed.push_back(index);
+    }
+}
+
+int AssetLoader::upload(Graphics& graphics, int maxItems) {
+    std::vector<size_t> ready;
+    {
+        std::lock_guard<std::mutex> lock(completedMutex);
+        if (maxItems > 0 && static_cast<int>(completed.size()) > maxItems) {
+            ready.assign(completed.begin(), completed.begin() + maxItems);
+            completed.erase(completed.begin(), completed.begin() + maxItems);
+        } else {
+            ready.swap(completed);
+        }
+    }
+
+    for (size_t index : ready) {
+        Job& job = jobs[index];
+        if (job.type == Job::Type::IMAGE) {
+            if (!job.image.error.empty()) {
+                std::cerr << job.image.error << std::endl;
+            } else {
+                // 最初の名前でテクスチャを作成し、残りの名前は同じテクスチャを参照する
+                graphics.loadTexture(job.filepath, job.names.front(), job.image);
+                for (size_t i = 1; i < job.names.size(); i++) {
+                    graphics.loadTexture(job.filepath, job.names[i]);
+                }
+            }
+        } else {
+            if (!job.chunk) {
+                std::cerr << "効果音読み込みエラー (" << job.filepath << "): " << job.error << std::endl;
+            } else {
+                AudioManager::getInstance().addSound(job.names.front(), job.chunk);
+                job.chunk = nullptr;
+            }
+        }
+        uploadedCount++;
+    }
+
+    if (isFinished()) {
+        joinWorkers();
+    }
+    return static_cast<int>(ready.size());
+}
+
+void AssetLoader::joinWorkers() {
+    for (auto& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
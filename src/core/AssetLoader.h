@@ -0,0 +1,118 @@
+/**
+ * @file AssetLoader.h
+ * @brief 起動時のアセットを並列に読み込むクラス
+ * @details 画像と効果音のデコードをワーカースレッドで行い、
+ * テクスチャの転送と効果音の登録はメインスレッドで少しずつ行う。
+ */
+
+#pragma once
+#include "../gfx/Graphics.h"
+#include <SDL2/SDL_mixer.h>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief 起動時のアセットを並列に読み込むクラス
+ * @details addImage()/addSound()で登録したアセットを、start()でCPUコア数分のワーカースレッドに分配する。
+ * ワーカーはファイルの読み込みとデコード（IMG_Load、不透明判定、アトラス用の縮小、Mix_LoadWAV）のみを行い、
+ * レンダラーやミキサーの状態を変更する処理はupload()でメインスレッドから行う。
+ * 起動時間はアセット数ではなくコア数に応じて短くなる。
+ */
+class AssetLoader {
+public:
+    /**
+     * @brief コンストラクタ
+     */
+    AssetLoader();
+
+    /**
+     * @brief デストラクタ
+     * @details ワーカースレッドの終了を待ち、転送されなかったデコード結果を破棄する。
+     */
+    ~AssetLoader();
+
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    /**
+     * @brief 画像の登録
+     * @details 同じファイルを複数の名前で登録した場合、デコードは一度だけ行われる。
+     * @param filepath ファイルパス
+     * @param name テクスチャ名
+     */
+    void addImage(const std::string& filepath, const std::string& name);
+
+    /**
+     * @brief 効果音の登録
+     * @param filepath ファイルパス
+     * @param name 登録名
+     */
+    void addSound(const std::string& filepath, const std::string& name);
+
+    /**
+     * @brief ワーカースレッドでのデコードの開始
+     */
+    void start();
+
+    /**
+     * @brief デコードが完了したアセットの転送（メインスレッドから呼び出す）
+     * @param graphics テクスチャを作成するグラフィックスオブジェクト
+     * @param maxItems 1回の呼び出しで転送する最大数（0の場合は無制限）
+     * @return 転送したアセット数
+     */
+    int upload(Graphics& graphics, int maxItems = 0);
+
+    /**
+     * @brief 全てのアセットの転送が完了したか
+     * @return 完了したか
+     */
+    bool isFinished() const { return uploadedCount == jobs.size(); }
+
+    /**
+     * @brief 読み込みの進捗の取得
+     * @return 進捗（0.0〜1.0、転送が完了したアセットの割合）
+     */
+    float getProgress() const {
+        return jobs.empty() ? 1.0f : static_cast<float>(uploadedCount) / static_cast<float>(jobs.size());
+    }
+
+    /**
+     * @brief ワーカースレッド数の取得
+     * @return ワーカースレッド数
+     */
+    int getWorkerCount() const { return static_cast<int>(workers.size()); }
+
+private:
+    /**
+     * @brief 読み込み処理の単位
+     */
+    struct Job {
+        enum class Type { IMAGE, SOUND };
+        Type type;
+        std::string filepath;
+        std::vector<std::string> names;   // 画像の場合は同じファイルを参照する全てのテクスチャ名
+        DecodedImage image;               // IMAGEのデコード結果
+        Mix_Chunk* chunk;                 // SOUNDのデコード結果
+        std::string error;                // SOUNDのデコードに失敗した場合のエラーメッセージ
+    };
+
+    /**
+     * @brief ワーカースレッドの処理
+     */
+    void workerLoop();
+
+    /**
+     * @brief ワーカースレッドの終了待ち
+     */
+    void joinWorkers();
+
+    std::vector<Job> jobs;
+    std::vector<std::thread> workers;
+    std::atomic<size_t> nextJob;       // 次にデコードするjobsの添字
+    std::mutex completedMutex;
+    std::vector<size_t> completed;     // デコードが完了し、転送待ちのjobsの添字
+    size_t uploadedCount;
+};
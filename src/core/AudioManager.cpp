@@ -136,17 +136,31 @@ bool AudioManager::loadSound(const std::string& filePath, const std::string& nam
         return false;
     }
     
-    // 既に読み込まれている場合は解放
-    if (soundMap.find(name) != soundMap.end()) {
-        Mix_FreeChunk(soundMap[name]);
-    }
-    
     Mix_Chunk* chunk = Mix_LoadWAV(filePath.c_str());
     if (!chunk) {
         std::cerr << "効果音読み込みエラー (" << filePath << "): " << Mix_GetError() << std::endl;
         return false;
     }
     
+    return addSound(name, chunk);
+}
+
+bool AudioManager::addSound(const std::string& name, Mix_Chunk* chunk) {
+    if (!chunk) {
+        return false;
+    }
+    if (!isInitialized) {
+        std::cerr << "AudioManagerが初期化されていません" << std::endl;
+        Mix_FreeChunk(chunk);
+        return false;
+    }
+    
+    // 既に読み込まれている場合は解放
+    auto it = soundMap.find(name);
+    if (it != soundMap.end()) {
+        Mix_FreeChunk(it->second);
+    }
+    
     soundMap[name] = chunk;
     return true;
 }
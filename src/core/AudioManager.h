@@ -110,6 +110,15 @@ public:
      */
     bool loadSound(const std::string& filePath, const std::string& name);
     
+    /**
+     * @brief デコード済みの効果音の登録
+     * @details 別スレッドでMix_LoadWAVした効果音をメインスレッドで登録するために使用する。
+     * @param name 登録名
+     * @param chunk 効果音（所有権を受け取る。登録に失敗した場合は解放する）
+     * @return 登録が成功したか
+     */
+    bool addSound(const std::string& name, Mix_Chunk* chunk);
+    
     /**
      * @brief 効果音の再生
      * @param name 登録名
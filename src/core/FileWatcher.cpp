@@ -0,0 +1,157 @@
+#include "FileWatcher.h"
+#include <chrono>
+#include <iostream>
+#include <sys/stat.h>
+#ifdef __linux__
+    #include <sys/inotify.h>
+    #include <poll.h>
+    #include <unistd.h>
+#endif
+
+FileWatcher::FileWatcher() : running(false), inotifyFd(-1) {
+}
+
+FileWatcher::~FileWatcher() {
+    stop();
+}
+
+bool FileWatcher::start(const std::vector<std::string>& paths, std::function<void()> onChanged) {
+    stop();
+    if (paths.empty() || !onChanged) {
+        std::cerr << "警告: FileWatcher::start: 監視するファイルまたはコールバックが指定されていません" << std::endl;
+        return false;
+    }
+    watchedPaths = paths;
+    callback = std::move(onChanged);
+    running = true;
+    if (setupInotify()) {
+        thread = std::thread(&FileWatcher::runInotify, this);
+    } else {
+        thread = std::thread(&FileWatcher::runPolling, this);
+    }
+    return true;
+}
+
+void FileWatcher::stop() {
+    {
+        std::lock_guard<std::mutex> lock(stopMutex);
+        running = false;
+    }
+    stopCondition.notify_all();
+    if (thread.joinable()) {
+        thread.join();
+    }
+#ifdef __linux__
+    if (inotifyFd >= 0) {
+        close(inotifyFd);
+    }
+#endif
+    inotifyFd = -1;
+    watchDescriptors.clear();
+    watchedNames.clear();
+}
+
+bool FileWatcher::setupInotify() {
+#ifdef __linux__
+    inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd < 0) {
+        return false;
+    }
+    // エディタは一時ファイルに書いてから置き換えることが多いので、ファイルではなく親ディレクトリを監視する
+    for (const std::string& path : watchedPaths) {
+        size_t slash = path.find_last_of('/');
+        std::string directory = slash == std::string::npos ? "." : path.substr(0, slash);
+        std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+        int wd = inotify_add_watch(inotifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+        if (wd >= 0) {
+            watchDescriptors.push_back(wd);
+            watchedNames.push_back(name);
+        }
+    }
+    if (watchDescriptors.empty()) {
+        close(inotifyFd);
+        inotifyFd = -1;
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+void FileWatcher::runInotify() {
+#ifdef __linux__
+    alignas(inotify_event) char buffer[4096];
+
+    // 溜まっている通知を読み出し、監視対象のファイルが含まれていたかを返す
+    auto readEvents = [&]() {
+        bool matched = false;
+        ssize_t length;
+        while ((length = read(inotifyFd, buffer, sizeof(buffer))) > 0) {
+            for (char* ptr = buffer; ptr < buffer + length; ) {
+                const inotify_event* event = reinterpret_cast<const inotify_event*>(ptr);
+                if (event->len > 0) {
+                    for (size_t i = 0; i < watchDescriptors.size(); i++) {
+                        if (watchDescriptors[i] == event->wd && watchedNames[i] == event->name) {
+                            matched = true;
+                        }
+                    }
+                }
+                ptr += sizeof(inotify_event) + event->len;
+            }
+        }
+        return matched;
+    };
+
+    while (running) {
+        pollfd fd = {inotifyFd, POLLIN, 0};
+        if (poll(&fd, 1, POLL_TIMEOUT_MS) <= 0 || !readEvents()) {
+            continue;
+        }
+        // 保存の途中で読み込まないよう、続く通知が落ち着くのを待ってから1回だけ知らせる
+        do {
+            std::this_thread::sleep_for(std::chrono::milliseconds(DEBOUNCE_MS));
+        } while (running && readEvents());
+        if (running) {
+            callback();
+        }
+    }
+#endif
+}
+
+void FileWatcher::runPolling() {
+    std::vector<time_t> lastTimes;
+    for (const std::string& path : watchedPaths) {
+        lastTimes.push_back(getModificationTime(path));
+    }
+
+    std::unique_lock<std::mutex> lock(stopMutex);
+    while (running) {
+        stopCondition.wait_for(lock, std::chrono::milliseconds(STAT_POLL_INTERVAL_MS), [this]() { return !running; });
+        if (!running) {
+            break;
+        }
+        bool changed = false;
+        for (size_t i = 0; i < watchedPaths.size(); i++) {
+            time_t current = getModificationTime(watchedPaths[i]);
+            if (current != lastTimes[i]) {
+                lastTimes[i] = current;
+                changed = true;
+            }
+        }
+        if (changed) {
+            // コールバック中に停止要求を受け付けられるよう、ロックを外して呼び出す
+            lock.unlock();
+            callback();
+            lock.lock();
+        }
+    }
+}
+
+time_t FileWatcher::getModificationTime(const std::string& path) {
+    struct stat fileInfo;
+    if (stat(path.c_str(), &fileInfo) == 0) {
+        return fileInfo.st_mtime;
+    }
+    return 0;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file FileWatcher.h
+ * @brief ファイルの変更監視を担当するクラス
+ * @details 監視用のスレッドでファイルの書き込みを待ち、変更があればコールバックを呼び出す。
+ * Linuxではinotifyで親ディレクトリを監視し、使えない環境では更新時刻の定期確認で代用する。
+ */
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <ctime>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief ファイルの変更監視を担当するクラス
+ * @details コールバックは監視用のスレッドから呼び出されるため、呼び出し側でスレッド間の受け渡しを行う。
+ * エディタの保存で連続して届く通知は短い間隔でまとめ、1回の変更として扱う。
+ */
+class FileWatcher {
+public:
+    FileWatcher();
+    ~FileWatcher();
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    /**
+     * @brief 監視の開始
+     * @param paths 監視するファイルのパス（存在しないファイルも、作成された時点で変更として扱う）
+     * @param onChanged 変更時に監視用のスレッドから呼び出すコールバック
+     * @return 監視を開始できたか
+     */
+    bool start(const std::vector<std::string>& paths, std::function<void()> onChanged);
+
+    /**
+     * @brief 監視の停止（スレッドの終了を待つ）
+     */
+    void stop();
+
+    /**
+     * @brief 監視中か
+     * @return 監視中か
+     */
+    bool isWatching() const { return running.load(); }
+
+private:
+    static constexpr int POLL_TIMEOUT_MS = 200;      // inotifyの待機の上限（停止要求の確認間隔）
+    static constexpr int DEBOUNCE_MS = 50;           // 連続する通知をまとめる間隔
+    static constexpr int STAT_POLL_INTERVAL_MS = 500; // inotifyが使えない場合の更新時刻の確認間隔
+
+    /**
+     * @brief inotifyによる監視（Linuxのみ）
+     * @return 監視を開始できたか（falseの場合は更新時刻の確認で代用する）
+     */
+    bool setupInotify();
+
+    void runInotify();
+    void runPolling();
+
+    /**
+     * @brief ファイルの更新時刻の取得
+     * @param path ファイルパス
+     * @return 更新時刻（存在しない場合は0）
+     */
+    static time_t getModificationTime(const std::string& path);
+
+    std::vector<std::string> watchedPaths;
+    std::function<void()> callback;
+    std::thread thread;
+    std::atomic<bool> running;
+    std::mutex stopMutex;
+    std::condition_variable stopCondition;
+    int inotifyFd;                    // inotifyのファイル記述子（使わない場合は-1）
+    std::vector<int> watchDescriptors;
+    std::vector<std::string> watchedNames;  // 変更を検出するファイル名（ディレクトリを除いた部分）
+};
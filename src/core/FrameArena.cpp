@@ -0,0 +1,96 @@
+#include "FrameArena.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+FrameArena::FrameArena() : currentBlock(0), offset(0), usedBytes(0), peakBytes(0) {
+    addBlock(INITIAL_BLOCK_SIZE);
+}
+
+FrameArena& FrameArena::getInstance() {
+    static FrameArena instance;
+    return instance;
+}
+
+void FrameArena::addBlock(size_t minimumBytes) {
+    const size_t lastSize = blocks.empty() ? 0 : blocks.back().size;
+    Block block;
+    block.size = std::max({minimumBytes, lastSize * 2, INITIAL_BLOCK_SIZE});
+    block.data.reset(new char[block.size]);
+    blocks.push_back(std::move(block));
+}
+
+void* FrameArena::allocate(size_t bytes, size_t alignment) {
+    if (bytes == 0) {
+        bytes = 1;
+    }
+    while (true) {
+        Block& block = blocks[currentBlock];
+        const uintptr_t base = reinterpret_cast<uintptr_t>(block.data.get());
+        const size_t aligned = ((base + offset + alignment - 1) & ~(uintptr_t(alignment) - 1)) - base;
+        if (aligned + bytes <= block.size) {
+            usedBytes += aligned + bytes - offset;
+            offset = aligned + bytes;
+            return block.data.get() + aligned;
+        }
+        // 次のブロックへ（足りなければ追加する）
+        if (currentBlock + 1 == blocks.size()) {
+            addBlock(bytes + alignment);
+        }
+        currentBlock++;
+        offset = 0;
+    }
+}
+
+const char* FrameArena::format(const char* formatString, ...) {
+    // まず現在のブロックの残りに直接書き込み、収まらなかった場合だけ必要な長さで確保し直す
+    Block& block = blocks[currentBlock];
+    const size_t available = block.size - offset;
+
+    va_list args;
+    va_start(args, formatString);
+    const int length = std::vsnprintf(block.data.get() + offset, available, formatString, args);
+    va_end(args);
+    if (length < 0) {
+        return "";
+    }
+    if (static_cast<size_t>(length) < available) {
+        return static_cast<const char*>(allocate(length + 1, 1));
+    }
+
+    char* text = static_cast<char*>(allocate(length + 1, 1));
+    va_start(args, formatString);
+    std::vsnprintf(text, length + 1, formatString, args);
+    va_end(args);
+    return text;
+}
+
+const char* FrameArena::copy(const std::string& text) {
+    char* result = static_cast<char*>(allocate(text.size() + 1, 1));
+    std::memcpy(result, text.c_str(), text.size() + 1);
+    return result;
+}
+
+void FrameArena::reset() {
+    peakBytes = std::max(peakBytes, usedBytes);
+    if (blocks.size() > 1) {
+        // 1フレームに収まらなかった場合は、次のフレームから1つのブロックで足りるようにまとめ直す
+        size_t totalSize = 0;
+        for (const Block& block : blocks) {
+            totalSize += block.size;
+        }
+        blocks.clear();
+        addBlock(totalSize);
+    }
+    currentBlock = 0;
+    offset = 0;
+    usedBytes = 0;
+}
+
+void replacePlaceholder(ArenaString& text, const char* placeholder, const char* value) {
+    const size_t pos = text.find(placeholder);
+    if (pos != ArenaString::npos) {
+        text.replace(pos, std::strlen(placeholder), value);
+    }
+}
@@ -0,0 +1,142 @@
+/**
+ * @file FrameArena.h
+ * @brief 1フレームの描画中だけ使う一時メモリを管理するクラス
+ * @details 描画処理で作る整形済み文字列や一時的な配列を、ヒープではなく連続したバッファから切り出す。
+ * 確保したメモリはSDL2Game::render()の終わりにまとめて解放される。
+ */
+
+#pragma once
+#include <cstdarg>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief フレーム単位のバンプアロケータ（シングルトン）
+ * @details 確保はポインタを進めるだけで、個別の解放は行わない。バッファが足りない場合は
+ * ブロックを追加し、次のreset()で1つのブロックにまとめ直すため、定常状態ではヒープ確保が発生しない。
+ * メインスレッドの描画処理からのみ使用する。確保したメモリをフレームをまたいで保持してはならない。
+ */
+class FrameArena {
+public:
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    /**
+     * @brief インスタンスの取得
+     * @return FrameArenaへの参照
+     */
+    static FrameArena& getInstance();
+
+    /**
+     * @brief メモリの確保
+     * @param bytes 確保するバイト数
+     * @param alignment アラインメント（2の累乗）
+     * @return 確保したメモリへのポインタ（reset()まで有効）
+     */
+    void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * @brief printf形式で整形した文字列の作成
+     * @param formatString 書式文字列
+     * @return 終端文字付きの文字列（reset()まで有効）
+     */
+    const char* format(const char* formatString, ...)
+#if defined(__GNUC__)
+        __attribute__((format(printf, 2, 3)))
+#endif
+        ;
+
+    /**
+     * @brief 文字列の複製
+     * @param text 複製する文字列
+     * @return 終端文字付きの文字列（reset()まで有効）
+     */
+    const char* copy(const std::string& text);
+
+    /**
+     * @brief 確保した全てのメモリの解放（SDL2Game::render()の終わりに呼び出す）
+     */
+    void reset();
+
+    /**
+     * @brief 現在のフレームで確保したバイト数
+     * @return バイト数
+     */
+    size_t getUsedBytes() const { return usedBytes; }
+
+    /**
+     * @brief 1フレームで確保したバイト数の最大値
+     * @return バイト数
+     */
+    size_t getPeakBytes() const { return peakBytes; }
+
+private:
+    FrameArena();
+
+    static constexpr size_t INITIAL_BLOCK_SIZE = 64 * 1024;  // 最初のブロックのサイズ（バイト）
+
+    /**
+     * @brief 連続したメモリのブロック
+     */
+    struct Block {
+        std::unique_ptr<char[]> data;
+        size_t size;
+    };
+
+    /**
+     * @brief ブロックの追加
+     * @param minimumBytes 必要なバイト数
+     */
+    void addBlock(size_t minimumBytes);
+
+    std::vector<Block> blocks;
+    size_t currentBlock;  // 確保中のブロックの添字
+    size_t offset;        // 確保中のブロック内の次の確保位置
+    size_t usedBytes;
+    size_t peakBytes;
+};
+
+/**
+ * @brief FrameArenaから確保する標準ライブラリ用のアロケータ
+ * @details deallocateは何もしない。要素数が分かっている場合はreserve()で再確保を避ける。
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    ArenaAllocator() noexcept = default;
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>&) noexcept {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(FrameArena::getInstance().allocate(count * sizeof(T), alignof(T)));
+    }
+    void deallocate(T*, size_t) noexcept {}
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>&) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>&) const noexcept { return false; }
+};
+
+/**
+ * @brief FrameArenaに確保される文字列（描画に渡す場合はc_str()を使う）
+ */
+using ArenaString = std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>>;
+
+/**
+ * @brief FrameArenaに確保される配列
+ */
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+/**
+ * @brief 文字列中の最初のプレースホルダーの置換
+ * @param text 置換する文字列
+ * @param placeholder プレースホルダー（例: "{playerName}"）
+ * @param value 置換後の文字列
+ */
+void replacePlaceholder(ArenaString& text, const char* placeholder, const char* value);
@@ -0,0 +1,226 @@
+#include "FrameProfiler.h"
+#include "../gfx/Graphics.h"
+#include <algorithm>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+    constexpr int PANEL_X = 10;
+    constexpr int PANEL_Y = 10;
+    constexpr int PANEL_WIDTH = 540;
+    constexpr int PANEL_PADDING = 8;
+    constexpr int LINE_HEIGHT = 20;
+    constexpr int SECTION_BAR_X = 440;     // 区間の平均時間のバーの開始位置（パネル左端から）
+    constexpr int SECTION_BAR_WIDTH = 90;  // 1フレーム分（60fps）の時間に相当するバーの幅
+    constexpr int HISTOGRAM_HEIGHT = 60;
+    constexpr float TARGET_FRAME_MS = 1000.0f / 60.0f;
+}
+
+FrameProfiler::FrameProfiler()
+    : enabled(false), inFrame(false), lastStateType(StateType::MAIN_MENU), framesSinceTextRefresh(0) {
+    sectionDepth.fill(0);
+    currentSectionMs.fill(0.0f);
+    histogram.fill(0);
+    sectionAverageMs.fill(0.0f);
+}
+
+FrameProfiler& FrameProfiler::getInstance() {
+    static FrameProfiler instance;
+    return instance;
+}
+
+void FrameProfiler::setEnabled(bool newEnabled) {
+    if (enabled == newEnabled) {
+        return;
+    }
+    enabled = newEnabled;
+    inFrame = false;
+    sectionDepth.fill(0);
+    // 無効の間の記録はないので、再開時は履歴を作り直す
+    histories.clear();
+    textLines.clear();
+    framesSinceTextRefresh = 0;
+}
+
+void FrameProfiler::beginFrame() {
+    if (!enabled) {
+        return;
+    }
+    inFrame = true;
+    frameStart = Clock::now();
+    currentSectionMs.fill(0.0f);
+}
+
+void FrameProfiler::endFrame(StateType stateType) {
+    if (!enabled || !inFrame) {
+        return;
+    }
+    inFrame = false;
+
+    FrameSample sample;
+    sample.frameMs = std::chrono::duration<float, std::milli>(Clock::now() - frameStart).count();
+    sample.sectionMs = currentSectionMs;
+
+    History& history = histories[stateType];
+    if (history.samples.empty()) {
+        history.samples.resize(HISTORY_SIZE);
+    }
+    history.samples[history.next] = sample;
+    history.next = (history.next + 1) % HISTORY_SIZE;
+    history.count = std::min(history.count + 1, HISTORY_SIZE);
+
+    // 状態が変わった直後は、古い状態の数値が残らないようすぐに表示を更新する
+    if (stateType != lastStateType || textLines.empty() || ++framesSinceTextRefresh >= TEXT_REFRESH_FRAMES) {
+        lastStateType = stateType;
+        framesSinceTextRefresh = 0;
+        rebuildText(history, stateType);
+    }
+}
+
+void FrameProfiler::beginSection(Section section) {
+    if (!enabled || !inFrame) {
+        return;
+    }
+    const int index = static_cast<int>(section);
+    if (sectionDepth[index]++ == 0) {
+        sectionStart[index] = Clock::now();
+    }
+}
+
+void FrameProfiler::endSection(Section section) {
+    if (!enabled || !inFrame) {
+        return;
+    }
+    const int index = static_cast<int>(section);
+    if (sectionDepth[index] == 0) {
+        return;
+    }
+    if (--sectionDepth[index] == 0) {
+        currentSectionMs[index] += std::chrono::duration<float, std::milli>(Clock::now() - sectionStart[index]).count();
+    }
+}
+
+void FrameProfiler::rebuildText(const History& history, StateType stateType) {
+    textLines.clear();
+    histogram.fill(0);
+    sectionAverageMs.fill(0.0f);
+    if (history.count == 0) {
+        return;
+    }
+
+    std::vector<float> frameTimes;
+    frameTimes.reserve(history.count);
+    std::array<float, SECTION_COUNT> sectionMaxMs;
+    sectionMaxMs.fill(0.0f);
+    float frameTotalMs = 0.0f;
+    for (int i = 0; i < history.count; i++) {
+        const FrameSample& sample = history.samples[i];
+        frameTimes.push_back(sample.frameMs);
+        frameTotalMs += sample.frameMs;
+        for (int s = 0; s < SECTION_COUNT; s++) {
+            sectionAverageMs[s] += sample.sectionMs[s];
+            sectionMaxMs[s] = std::max(sectionMaxMs[s], sample.sectionMs[s]);
+        }
+        const int bucket = std::min(HISTOGRAM_BUCKETS - 1, static_cast<int>(sample.frameMs / HISTOGRAM_BUCKET_MS));
+        histogram[bucket]++;
+    }
+    for (int s = 0; s < SECTION_COUNT; s++) {
+        sectionAverageMs[s] /= static_cast<float>(history.count);
+    }
+
+    // 1% low: 遅い方から1%のフレームの平均時間をfpsに換算したもの
+    const int worstCount = std::max(1, history.count / 100);
+    std::partial_sort(frameTimes.begin(), frameTimes.begin() + worstCount, frameTimes.end(), std::greater<float>());
+    float worstTotalMs = 0.0f;
+    for (int i = 0; i < worstCount; i++) {
+        worstTotalMs += frameTimes[i];
+    }
+    const float worstAverageMs = worstTotalMs / static_cast<float>(worstCount);
+    const float onePercentLowFps = worstAverageMs > 0.0f ? 1000.0f / worstAverageMs : 0.0f;
+
+    std::ostringstream line;
+    line << std::fixed << std::setprecision(2);
+    line << "FrameProfiler [" << getStateTypeName(stateType) << "] " << history.count << " frames (F3)";
+    textLines.push_back(line.str());
+
+    line.str("");
+    line << "frame  avg " << frameTotalMs / static_cast<float>(history.count) << " ms  max " << frameTimes.front()
+         << " ms  1% low " << std::setprecision(1) << onePercentLowFps << " fps";
+    textLines.push_back(line.str());
+
+    for (int s = 0; s < SECTION_COUNT; s++) {
+        line.str("");
+        line << std::setprecision(2) << "  " << getSectionName(static_cast<Section>(s))
+             << "  avg " << sectionAverageMs[s] << " ms  max " << sectionMaxMs[s] << " ms";
+        textLines.push_back(line.str());
+    }
+
+    line.str("");
+    line << std::setprecision(0) << "histogram (" << HISTOGRAM_BUCKET_MS << " ms/bin, last bin "
+         << HISTOGRAM_BUCKET_MS * (HISTOGRAM_BUCKETS - 1) << "+ ms)";
+    textLines.push_back(line.str());
+}
+
+void FrameProfiler::render(Graphics& graphics) {
+    if (!enabled || textLines.empty()) {
+        return;
+    }
+
+    const int panelHeight = PANEL_PADDING * 2 + static_cast<int>(textLines.size()) * LINE_HEIGHT + HISTOGRAM_HEIGHT;
+    SDL_SetRenderDrawBlendMode(graphics.getRenderer(), SDL_BLENDMODE_BLEND);
+    graphics.setDrawColor(0, 0, 0, 190);
+    graphics.drawRect(PANEL_X, PANEL_Y, PANEL_WIDTH, panelHeight, true);
+    graphics.setDrawColor(255, 255, 255, 255);
+    graphics.drawRect(PANEL_X, PANEL_Y, PANEL_WIDTH, panelHeight);
+
+    const FontId font = graphics.getFontId("default");
+    const SDL_Color textColor = {255, 255, 255, 255};
+    int y = PANEL_Y + PANEL_PADDING;
+    for (size_t i = 0; i < textLines.size(); i++) {
+        graphics.drawText(textLines[i], PANEL_X + PANEL_PADDING, y, font, textColor);
+
+        // 区間の行には平均時間のバーを添える（幅は60fpsの1フレーム分を基準とする）
+        const int sectionLine = static_cast<int>(i) - 2;
+        if (sectionLine >= 0 && sectionLine < SECTION_COUNT) {
+            const float ratio = std::min(1.0f, sectionAverageMs[sectionLine] / TARGET_FRAME_MS);
+            const int barWidth = static_cast<int>(ratio * SECTION_BAR_WIDTH);
+            graphics.setDrawColor(80, 200, 255, 255);
+            if (barWidth > 0) {
+                graphics.drawRect(PANEL_X + SECTION_BAR_X, y + 4, barWidth, LINE_HEIGHT - 8, true);
+            }
+        }
+        y += LINE_HEIGHT;
+    }
+
+    // フレーム時間のヒストグラム（60fpsの目標を超える区間は赤で表示）
+    const int maxCount = *std::max_element(histogram.begin(), histogram.end());
+    const int binWidth = (PANEL_WIDTH - PANEL_PADDING * 2) / HISTOGRAM_BUCKETS;
+    for (int b = 0; b < HISTOGRAM_BUCKETS; b++) {
+        const int height = maxCount > 0 ? histogram[b] * (HISTOGRAM_HEIGHT - PANEL_PADDING) / maxCount : 0;
+        if (height <= 0) {
+            continue;
+        }
+        const bool overBudget = HISTOGRAM_BUCKET_MS * (b + 1) > TARGET_FRAME_MS;
+        if (overBudget) {
+            graphics.setDrawColor(255, 90, 90, 255);
+        } else {
+            graphics.setDrawColor(90, 220, 90, 255);
+        }
+        graphics.drawRect(PANEL_X + PANEL_PADDING + b * binWidth, y + HISTOGRAM_HEIGHT - PANEL_PADDING - height,
+                          binWidth - 2, height, true);
+    }
+}
+
+const char* FrameProfiler::getSectionName(Section section) {
+    switch (section) {
+        case Section::HANDLE_EVENTS: return "handleEvents";
+        case Section::UPDATE: return "update";
+        case Section::RENDER: return "render";
+        case Section::BATTLE_UI: return "  BattleUI";
+        case Section::BATTLE_EFFECTS: return "  BattleEffectManager";
+        case Section::COMMON_UI: return "  CommonUI";
+        case Section::COUNT: break;
+    }
+    return "UNKNOWN";
+}
@@ -0,0 +1,168 @@
+/**
+ * @file FrameProfiler.h
+ * @brief フレーム時間の計測とオーバーレイ表示を担当するクラス
+ * @details メインループの各処理とサブシステムの処理時間をフレームごとに集計し、
+ * ゲーム状態ごとの履歴から平均・最大・ヒストグラム・1% lowを画面に表示する。
+ */
+
+#pragma once
+#include "GameState.h"
+#include <array>
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+class Graphics;
+
+/**
+ * @brief フレーム時間の計測とオーバーレイ表示を担当するクラス（シングルトン）
+ * @details 計測する区間はScopeで囲む。同じ区間の入れ子は外側の1回として計測される。
+ * 無効の間は計測を行わないため、区間の出入りのコストはフラグの確認のみとなる。
+ */
+class FrameProfiler {
+public:
+    /**
+     * @brief 計測区間
+     */
+    enum class Section {
+        HANDLE_EVENTS,   /**< @brief SDL2Game::handleEvents */
+        UPDATE,          /**< @brief SDL2Game::update（1フレーム内の全ての固定間隔更新の合計） */
+        RENDER,          /**< @brief SDL2Game::render */
+        BATTLE_UI,       /**< @brief BattleUIの描画 */
+        BATTLE_EFFECTS,  /**< @brief BattleEffectManagerの更新と描画 */
+        COMMON_UI,       /**< @brief CommonUIの描画 */
+        COUNT
+    };
+
+    /**
+     * @brief 区間の計測を行うRAIIクラス
+     */
+    class Scope {
+    public:
+        explicit Scope(Section section) : section(section) {
+            FrameProfiler::getInstance().beginSection(section);
+        }
+        ~Scope() {
+            FrameProfiler::getInstance().endSection(section);
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Section section;
+    };
+
+    FrameProfiler(const FrameProfiler&) = delete;
+    FrameProfiler& operator=(const FrameProfiler&) = delete;
+
+    /**
+     * @brief インスタンスの取得
+     * @return FrameProfilerへの参照
+     */
+    static FrameProfiler& getInstance();
+
+    /**
+     * @brief 計測と表示の有効/無効の設定
+     * @param enabled 有効にするか
+     */
+    void setEnabled(bool enabled);
+
+    /**
+     * @brief 計測と表示の有効/無効の切り替え
+     */
+    void toggle() { setEnabled(!enabled); }
+
+    /**
+     * @brief 計測と表示が有効か
+     * @return 有効か
+     */
+    bool isEnabled() const { return enabled; }
+
+    /**
+     * @brief フレームの計測開始
+     */
+    void beginFrame();
+
+    /**
+     * @brief フレームの計測終了
+     * @param stateType このフレームを描画したゲーム状態
+     */
+    void endFrame(StateType stateType);
+
+    /**
+     * @brief 区間の計測開始（通常はScopeを使用する）
+     * @param section 計測区間
+     */
+    void beginSection(Section section);
+
+    /**
+     * @brief 区間の計測終了（通常はScopeを使用する）
+     * @param section 計測区間
+     */
+    void endSection(Section section);
+
+    /**
+     * @brief オーバーレイの描画
+     * @details 現在のゲーム状態の履歴を表示する。Graphics::present()の直前に呼び出す。
+     * @param graphics グラフィックスオブジェクトへの参照
+     */
+    void render(Graphics& graphics);
+
+private:
+    FrameProfiler();
+
+    using Clock = std::chrono::high_resolution_clock;
+
+    static constexpr int SECTION_COUNT = static_cast<int>(Section::COUNT);
+    static constexpr int HISTORY_SIZE = 300;          // ゲーム状態ごとに保持するフレーム数
+    static constexpr int HISTOGRAM_BUCKETS = 10;      // ヒストグラムの区間数（最後の区間はそれ以上の全て）
+    static constexpr float HISTOGRAM_BUCKET_MS = 4.0f;  // ヒストグラムの1区間の幅（ミリ秒）
+    static constexpr int TEXT_REFRESH_FRAMES = 30;    // 数値の表示を更新する間隔（フレーム）
+
+    /**
+     * @brief 1フレーム分の計測結果
+     */
+    struct FrameSample {
+        float frameMs;                               // フレーム全体の時間（ミリ秒）
+        std::array<float, SECTION_COUNT> sectionMs;  // 区間ごとの時間（ミリ秒）
+    };
+
+    /**
+     * @brief ゲーム状態ごとの計測結果のリングバッファ
+     */
+    struct History {
+        std::vector<FrameSample> samples;
+        int next = 0;
+        int count = 0;
+    };
+
+    /**
+     * @brief 表示する文字列の再計算
+     * @param history 表示するゲーム状態の履歴
+     * @param stateType 表示するゲーム状態
+     */
+    void rebuildText(const History& history, StateType stateType);
+
+    /**
+     * @brief 区間の表示名の取得
+     * @param section 計測区間
+     * @return 表示名
+     */
+    static const char* getSectionName(Section section);
+
+    bool enabled;
+    bool inFrame;
+    Clock::time_point frameStart;
+    std::array<Clock::time_point, SECTION_COUNT> sectionStart;
+    std::array<int, SECTION_COUNT> sectionDepth;     // 入れ子の深さ（外側の区間だけを計測する）
+    std::array<float, SECTION_COUNT> currentSectionMs;  // 計測中のフレームの区間ごとの合計
+    std::map<StateType, History> histories;
+    StateType lastStateType;
+
+    // 表示内容（数値が毎フレーム変わって読めないため、一定間隔で更新する）
+    std::vector<std::string> textLines;
+    std::array<int, HISTOGRAM_BUCKETS> histogram;
+    std::array<float, SECTION_COUNT> sectionAverageMs;
+    int framesSinceTextRefresh;
+};
@@ -2,11 +2,28 @@
 #include "../entities/Player.h"
 #include "../game/TownState.h"
 #include "../core/AudioManager.h"
+#include "Trace.h"
 #include <iostream>
 #include <cmath>
 #include <algorithm>
 #include <nlohmann/json.hpp>
 
+const char* getStateTypeName(StateType type) {
+    switch (type) {
+        case StateType::MAIN_MENU: return "MAIN_MENU";
+        case StateType::FIELD: return "FIELD";
+        case StateType::BATTLE: return "BATTLE";
+        case StateType::TOWN: return "TOWN";
+        case StateType::CASTLE: return "CASTLE";
+        case StateType::ROOM: return "ROOM";
+        case StateType::NIGHT: return "NIGHT";
+        case StateType::DEMON_CASTLE: return "DEMON_CASTLE";
+        case StateType::GAME_OVER: return "GAME_OVER";
+        case StateType::ENDING: return "ENDING";
+    }
+    return "UNKNOWN";
+}
+
 GameStateManager::GameStateManager() : shouldChangeState(false) {
 }
 
@@ -29,8 +46,9 @@ void GameStateManager::update(float deltaTime) {
     }
 }
 
-void GameStateManager::render(Graphics& graphics) {
+void GameStateManager::render(Graphics& graphics, float interpolationTime) {
     if (currentState) {
+        currentState->setInterpolationTime(interpolationTime);
         currentState->render(graphics);
     }
 }
@@ -49,6 +67,7 @@ StateType GameStateManager::getCurrentStateType() const {
 }
 
 void GameStateManager::performStateChange() {
+    TRACE_SCOPE("GameStateManager::performStateChange");
     if (currentState) {
         currentState->exit();
     }
@@ -325,8 +344,9 @@ void GameState::updateFade(float deltaTime) {
 }
 
 void GameState::renderFade(Graphics& graphics) {
+    // 最後の更新からの経過時間を加えて、更新間隔より細かくフェードを進める
     if (isFadingOut) {
-        float fadeProgress = std::min(1.0f, fadeTimer / fadeDuration);
+        float fadeProgress = std::min(1.0f, (fadeTimer + interpolationTime) / fadeDuration);
         Uint8 alpha = static_cast<Uint8>(fadeProgress * 255.0f);
         
         // アルファブレンディングを有効化して描画
@@ -342,7 +362,7 @@ void GameState::renderFade(Graphics& graphics) {
             graphics.drawRect(0, 0, screenWidth, screenHeight, true);
         }
     } else if (isFadingIn) {
-        float fadeProgress = std::min(1.0f, fadeTimer / fadeDuration);
+        float fadeProgress = std::min(1.0f, (fadeTimer + interpolationTime) / fadeDuration);
         Uint8 alpha = static_cast<Uint8>((1.0f - fadeProgress) * 255.0f); // 255から0へ
         
         // アルファブレンディングを有効化して描画
@@ -30,6 +30,13 @@ enum class StateType {
     ENDING
 };
 
+/**
+ * @brief 状態タイプの表示名の取得
+ * @param type 状態タイプ
+ * @return 表示名（"MAIN_MENU"など）
+ */
+const char* getStateTypeName(StateType type);
+
 // 前方宣言
 class GameStateManager;
 
@@ -62,6 +69,14 @@ public:
      */
     virtual void fromJson(const nlohmann::json& j) {}
     
+    /**
+     * @brief 入力待ちで画面が変化しない状態か（オプショナル）
+     * @details trueの間、メインループは入力が来るまでスリープし、更新と描画を省く。
+     * メニューなど、入力以外で画面が変化しない状態でオーバーライドする。
+     * @return 入力待ちで画面が変化しない状態か（デフォルト: false）
+     */
+    virtual bool isIdle() const { return false; }
+    
     /**
      * @brief 現在のStateの状態を保存（共通ヘルパー関数）
      * @param player プレイヤーへの共有ポインタ
@@ -77,8 +92,17 @@ protected:
     float fadeTimer;  /**< @brief フェードタイマー（秒） */
     float fadeDuration;  /**< @brief フェード時間（秒） */
     std::function<void()> fadeOutCompleteCallback;  /**< @brief フェードアウト完了時のコールバック */
+    float interpolationTime = 0.0f;  /**< @brief 最後の更新から描画までの経過時間（秒）。描画の補間に使用する */
     
 public:
+    /**
+     * @brief 描画補間用の経過時間の設定
+     * @details 更新は固定間隔で行われるため、描画時点の時刻は最後の更新より進んでいる。
+     * render()ではタイマーにこの時間を加えることで、更新間隔より細かく滑らかに描画できる。
+     * @param seconds 最後の更新から描画までの経過時間（秒、0以上で更新間隔未満）
+     */
+    void setInterpolationTime(float seconds) { interpolationTime = seconds; }
+    
     /**
      * @brief 状態マネージャーの設定
      * @param manager 状態マネージャーへのポインタ
@@ -326,8 +350,9 @@ public:
     /**
      * @brief 描画処理
      * @param graphics グラフィックスオブジェクトへの参照
+     * @param interpolationTime 最後の更新から描画までの経過時間（秒）
      */
-    void render(Graphics& graphics);
+    void render(Graphics& graphics, float interpolationTime = 0.0f);
     
     /**
      * @brief 入力処理
@@ -347,6 +372,12 @@ public:
      */
     StateType getCurrentStateType() const;
     
+    /**
+     * @brief 現在の状態が入力待ちか
+     * @return 状態遷移の予定がなく、現在の状態が入力待ちか
+     */
+    bool isIdle() const { return currentState && !shouldChangeState && currentState->isIdle(); }
+    
 private:
     /**
      * @brief 状態変更の実行
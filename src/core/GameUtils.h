@@ -5,6 +5,7 @@
  */
 
 #pragma once
+#include "Random.h"
 #include <cmath>
 
 /**
@@ -90,7 +91,7 @@ namespace GameUtils {
      * @return ランダムな角度（ラジアン、0～2π）
      */
     inline float randomAngle() {
-        return static_cast<float>(rand()) / RAND_MAX * 2.0f * M_PI;
+        return Random::get(RandomStream::MISC).nextFloat(0.0f, 2.0f * static_cast<float>(M_PI));
     }
     
     /**
@@ -102,8 +103,9 @@ namespace GameUtils {
      * @return ランダムな位置（X, Y）
      */
     inline std::pair<int, int> randomPosition(int minX, int minY, int maxX, int maxY) {
-        int x = minX + rand() % (maxX - minX);
-        int y = minY + rand() % (maxY - minY);
+        RandomGenerator& gen = Random::get(RandomStream::MISC);
+        int x = gen.nextInt(minX, maxX - 1);
+        int y = gen.nextInt(minY, maxY - 1);
         return {x, y};
     }
 } 
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "Random.h"
+#include <iostream>
+#include <random>
+
+namespace {
+    uint64_t splitMix64(uint64_t& x) {
+        uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+}
+
+void RandomGenerator::seed(uint64_t seed) {
+    for (uint64_t& word : state) {
+        word = splitMix64(seed);
+    }
+}
+
+void RandomGenerator::fillInt(int* values, size_t count, int min, int max) {
+    for (size_t i = 0; i < count; i++) {
+        values[i] = nextInt(min, max);
+    }
+}
+
+void RandomGenerator::fillFloat(float* values, size_t count, float min, float max) {
+    for (size_t i = 0; i < count; i++) {
+        values[i] = nextFloat(min, max);
+    }
+}
+
+bool RandomGenerator::setState(const std::array<uint64_t, 4>& newState) {
+    if (newState[0] == 0 && newState[1] == 0 && newState[2] == 0 && newState[3] == 0) {
+        return false;
+    }
+    state = newState;
+    return true;
+}
+
+Random::Random() : currentSeed(0) {
+    // seed()が呼ばれるまでも乱数列が同じにならないよう、起動ごとに異なるシードで初期化する
+    std::random_device rd;
+    seed((static_cast<uint64_t>(rd()) << 32) | rd());
+}
+
+Random& Random::getInstance() {
+    static Random instance;
+    return instance;
+}
+
+void Random::seed(uint64_t seed) {
+    currentSeed = seed;
+    for (size_t i = 0; i < STREAM_COUNT; i++) {
+        // 乱数列ごとに異なる値からsplitmix64で展開し、同じシードでも乱数列どうしが重ならないようにする
+        uint64_t streamSeed = seed ^ (0xD1B54A32D192ED03ULL * (i + 1));
+        streams[i].seed(splitMix64(streamSeed));
+    }
+}
+
+nlohmann::json Random::toJson() const {
+    nlohmann::json j;
+    j["seed"] = currentSeed;
+    for (size_t i = 0; i < STREAM_COUNT; i++) {
+        const std::array<uint64_t, 4>& state = streams[i].getState();
+        j["streams"][getStreamName(static_cast<RandomStream>(i))] = {state[0], state[1], state[2], state[3]};
+    }
+    return j;
+}
+
+bool Random::fromJson(const nlohmann::json& j) {
+    if (!j.is_object() || !j.contains("streams") || !j["streams"].is_object()) {
+        std::cerr << "警告: Random::fromJson: 乱数の状態が不正です" << std::endl;
+        return false;
+    }
+    if (j.contains("seed") && j["seed"].is_number_unsigned()) {
+        currentSeed = j["seed"].get<uint64_t>();
+    }
+    bool restored = true;
+    const nlohmann::json& streamsJson = j["streams"];
+    for (size_t i = 0; i < STREAM_COUNT; i++) {
+        const char* name = getStreamName(static_cast<RandomStream>(i));
+        if (!streamsJson.contains(name)) {
+            continue;
+        }
+        const nlohmann::json& stateJson = streamsJson[name];
+        std::array<uint64_t, 4> state;
+        if (!stateJson.is_array() || stateJson.size() != state.size()) {
+            std::cerr << "警告: Random::fromJson: 乱数列 " << name << " の状態が不正です" << std::endl;
+            restored = false;
+            continue;
+        }
+        for (size_t k = 0; k < state.size(); k++) {
+            state[k] = stateJson[k].is_number_unsigned() ? stateJson[k].get<uint64_t>() : 0;
+        }
+        if (!streams[i].setState(state)) {
+            std::cerr << "警告: Random::fromJson: 乱数列 " << name << " の状態が不正です" << std::endl;
+            restored = false;
+        }
+    }
+    return restored;
+}
+
+const char* Random::getStreamName(RandomStream stream) {
+    switch (stream) {
+        case RandomStream::BATTLE:    return "battle";
+        case RandomStream::EFFECTS:   return "effects";
+        case RandomStream::ENCOUNTER: return "encounter";
+        case RandomStream::MAP:       return "map";
+        case RandomStream::NIGHT:     return "night";
+        case RandomStream::MISC:      return "misc";
+        default:                      return "unknown";
+    }
+}
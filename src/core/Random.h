@@ -0,0 +1,187 @@
+/**
+ * @file Random.h
+ * @brief 乱数の生成を担当するクラス
+ * @details 用途ごとに独立した乱数列（ストリーム）を持ち、1つのシードから全てを再現できるようにする。
+ * 状態はセーブデータに保存でき、入力の記録と再生でも同じ乱数列が得られる。
+ */
+
+#pragma once
+#include <nlohmann/json.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief 乱数列の種類
+ * @details 用途ごとに分けることで、ある処理の乱数の消費回数が変わっても他の処理の乱数列に影響しない。
+ */
+enum class RandomStream {
+    BATTLE,     /**< @brief 戦闘の判定（命中、会心、敵の行動など） */
+    EFFECTS,    /**< @brief 演出（パーティクル、画面の揺れ） */
+    ENCOUNTER,  /**< @brief フィールドのモンスターの配置と種類 */
+    MAP,        /**< @brief 地形の生成 */
+    NIGHT,      /**< @brief 夜の街（衛兵の巡回など） */
+    MISC,       /**< @brief その他 */
+    COUNT
+};
+
+/**
+ * @brief 乱数生成器（xoshiro256**）
+ * @details std::mt19937より状態が小さく（32バイト）高速。結果は実装に依存しないため、
+ * 標準ライブラリの分布クラスではなくnextInt()などを使う。
+ */
+class RandomGenerator {
+public:
+    using result_type = uint64_t;
+
+    /**
+     * @brief シードの設定
+     * @param seed シード（splitmix64で4語の状態に展開する）
+     */
+    void seed(uint64_t seed);
+
+    /**
+     * @brief 64ビットの乱数
+     * @return 乱数
+     */
+    uint64_t next() {
+        const uint64_t result = rotl(state[1] * 5, 7) * 9;
+        const uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+        return result;
+    }
+
+    uint64_t operator()() { return next(); }
+    static constexpr uint64_t min() { return 0; }
+    static constexpr uint64_t max() { return UINT64_MAX; }
+
+    /**
+     * @brief 範囲内の整数の乱数
+     * @param min 最小値
+     * @param max 最大値（この値を含む）
+     * @return min以上max以下の整数
+     */
+    int nextInt(int min, int max) {
+        const uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(max) - min) + 1;
+        return static_cast<int>(min + static_cast<int64_t>(((next() >> 32) * range) >> 32));
+    }
+
+    /**
+     * @brief 範囲内の小数の乱数
+     * @param min 最小値
+     * @param max 最大値（この値を含まない）
+     * @return min以上max未満の小数
+     */
+    float nextFloat(float min, float max) {
+        return min + (max - min) * (static_cast<float>(next() >> 40) * (1.0f / 16777216.0f));
+    }
+
+    /**
+     * @brief 範囲内の整数の乱数をまとめて生成
+     * @param values 出力先
+     * @param count 生成する個数
+     * @param min 最小値
+     * @param max 最大値（この値を含む）
+     */
+    void fillInt(int* values, size_t count, int min, int max);
+
+    /**
+     * @brief 範囲内の小数の乱数をまとめて生成
+     * @param values 出力先
+     * @param count 生成する個数
+     * @param min 最小値
+     * @param max 最大値（この値を含まない）
+     */
+    void fillFloat(float* values, size_t count, float min, float max);
+
+    /**
+     * @brief 状態の取得（セーブデータ用）
+     * @return 内部状態
+     */
+    const std::array<uint64_t, 4>& getState() const { return state; }
+
+    /**
+     * @brief 状態の設定（セーブデータ用）
+     * @param newState 内部状態（全て0は不可）
+     * @return 設定できたか
+     */
+    bool setState(const std::array<uint64_t, 4>& newState);
+
+private:
+    static uint64_t rotl(uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    std::array<uint64_t, 4> state = {{1, 2, 3, 4}};
+};
+
+/**
+ * @brief 乱数列を管理するクラス（シングルトン）
+ * @details 起動時にseed()で全ての乱数列を初期化する。呼び出し側はRandom::get()で用途の乱数列を取得する。
+ */
+class Random {
+public:
+    Random(const Random&) = delete;
+    Random& operator=(const Random&) = delete;
+
+    /**
+     * @brief インスタンスの取得
+     * @return Randomへの参照
+     */
+    static Random& getInstance();
+
+    /**
+     * @brief 乱数列の取得
+     * @param stream 乱数列の種類
+     * @return 乱数生成器への参照
+     */
+    static RandomGenerator& get(RandomStream stream) {
+        return getInstance().streams[static_cast<size_t>(stream)];
+    }
+
+    /**
+     * @brief 全ての乱数列の初期化
+     * @param seed シード（乱数列ごとに異なる状態に展開する）
+     */
+    void seed(uint64_t seed);
+
+    /**
+     * @brief 最後に設定したシードの取得
+     * @return シード
+     */
+    uint64_t getSeed() const { return currentSeed; }
+
+    /**
+     * @brief 全ての乱数列の状態をJSONに変換（セーブデータ用）
+     * @return JSONオブジェクト
+     */
+    nlohmann::json toJson() const;
+
+    /**
+     * @brief JSONから乱数列の状態を復元（セーブデータ用）
+     * @details JSONに含まれない乱数列は現在の状態のまま残す。
+     * @param j JSONオブジェクト
+     * @return 復元できたか
+     */
+    bool fromJson(const nlohmann::json& j);
+
+    /**
+     * @brief 乱数列の名前の取得
+     * @param stream 乱数列の種類
+     * @return 名前（セーブデータのキー）
+     */
+    static const char* getStreamName(RandomStream stream);
+
+private:
+    Random();
+
+    static constexpr size_t STREAM_COUNT = static_cast<size_t>(RandomStream::COUNT);
+
+    std::array<RandomGenerator, STREAM_COUNT> streams;
+    uint64_t currentSeed;
+};
@@ -11,12 +11,20 @@
 #include "../core/utils/ui_config_manager.h"
 #include "../core/GameState.h"
 #include "../core/AudioManager.h"
+#include "../core/AssetLoader.h"
+#include "../core/FrameProfiler.h"
+#include "../core/AllocationTracker.h"
+#include "../core/FrameArena.h"
+#include "../core/Random.h"
+#include "../core/Trace.h"
 #include "../utils/TownLayout.h"
 #include <iostream>
 #include <string>
 #include <memory>
+#include <iomanip>
+#include <random>
 
-SDL2Game::SDL2Game() : isRunning(false), uiConfigCheckTimer(0.0f), debugStartState("") {
+SDL2Game::SDL2Game() : isRunning(false), updateAccumulator(0.0f), configReloadEvent(static_cast<Uint32>(-1)), debugStartState(""), maxFrames(0), frameCount(0), screenshotPath(""), renderEnabled(true), tracePath("") {
 }
 
 SDL2Game::~SDL2Game() {
@@ -29,16 +37,52 @@ bool SDL2Game::initialize() {
         return false;
     }
     
+    // フレームプロファイラーは各Stateの描画の後、画面更新の直前に重ねて描画する
+    graphics.setPresentOverlay([](Graphics& g) {
+        FrameProfiler::getInstance().render(g);
+    });
+    
     if (!AudioManager::getInstance().initialize()) {
         std::cerr << "オーディオ初期化に失敗しました。" << std::endl;
         return false;
     }
     
+    // 入力の記録と再生（再生時は記録時と同じ乱数シードと開始状態を使う）
+    // セーブデータは記録後に書き換わるため、記録と再生ではセーブデータを読まずに新しいゲームから開始する
+    if (!replayPath.empty()) {
+        if (!inputManager.startReplay(replayPath)) {
+            return false;
+        }
+        if (debugStartState.empty()) {
+            debugStartState = inputManager.getRecordedStartState();
+        }
+        Random::getInstance().seed(inputManager.getSeed());
+    } else if (!recordPath.empty()) {
+        if (!inputManager.startRecording(recordPath, std::random_device()(), debugStartState)) {
+            return false;
+        }
+        Random::getInstance().seed(inputManager.getSeed());
+    }
+    
     loadResources();
     initializeGame();
     
     UIConfig::UIConfigManager::getInstance().loadConfig("assets/config/ui_config.json");
     
+    // UI設定ファイルの変更を監視する（ヘッドレス実行と再生では結果が変わらないよう監視しない）
+    if (!graphics.isHeadless() && !inputManager.isReplaying()) {
+        configReloadEvent = SDL_RegisterEvents(1);
+        if (configReloadEvent != static_cast<Uint32>(-1)) {
+            Uint32 eventType = configReloadEvent;
+            UIConfig::UIConfigManager::getInstance().startWatching([eventType]() {
+                SDL_Event event;
+                SDL_zero(event);
+                event.type = eventType;
+                SDL_PushEvent(&event);
+            });
+        }
+    }
+    
     lastTime = std::chrono::high_resolution_clock::now();
     isRunning = true;
     
@@ -46,16 +90,138 @@ bool SDL2Game::initialize() {
 }
 
 void SDL2Game::run() {
+    auto startTime = std::chrono::high_resolution_clock::now();
+    
     while (isRunning) {
-        float deltaTime = calculateDeltaTime();
+        FrameProfiler& profiler = FrameProfiler::getInstance();
+        AllocationTracker& allocationTracker = AllocationTracker::getInstance();
+        
+        // 入力待ちの状態では、イベントが来るまでスリープして更新と描画を省く
+        // （UI設定の再読み込みもイベントで届く。プロファイラーの表示中は計測を続けるためスリープしない）
+        if (!graphics.isHeadless() && !inputManager.isReplaying() && !profiler.isEnabled() && stateManager.isIdle()) {
+            SDL_WaitEvent(nullptr);
+            // 待機した時間は状態に影響しないので捨て、起床後は1回分だけ更新する
+            lastTime = std::chrono::high_resolution_clock::now();
+            updateAccumulator = FIXED_TIMESTEP;
+        }
+        
+        if (frameCallback && !frameCallback(frameCount)) {
+            isRunning = false;
+            break;
+        }
+        
+        // ヘッドレス実行と再生では計測結果が実行速度に左右されないよう、1フレームを常に1回の更新として扱う
+        float frameTime = (graphics.isHeadless() || inputManager.isReplaying()) ? FIXED_TIMESTEP : calculateDeltaTime();
+        updateAccumulator += frameTime;
         
-        handleEvents();
-        update(deltaTime);
-        render();
+        profiler.beginFrame();
+        allocationTracker.beginFrame();
+        {
+            FrameProfiler::Scope profile(FrameProfiler::Section::HANDLE_EVENTS);
+            handleEvents();
+        }
+        
+        // 溜まった時間を固定間隔で消化する（遅いフレームでは複数回、速いフレームでは0回）
+        {
+            FrameProfiler::Scope profile(FrameProfiler::Section::UPDATE);
+            int updates = 0;
+            if (inputManager.isReplaying()) {
+                // 再生では記録時と同じ回数だけ更新する
+                for (; updates < inputManager.getReplayUpdateCount(); updates++) {
+                    update(FIXED_TIMESTEP);
+                }
+                updateAccumulator = 0.0f;
+            } else {
+                while (updateAccumulator >= FIXED_TIMESTEP && updates < MAX_UPDATES_PER_FRAME) {
+                    update(FIXED_TIMESTEP);
+                    updateAccumulator -= FIXED_TIMESTEP;
+                    updates++;
+                }
+                if (updates == MAX_UPDATES_PER_FRAME && updateAccumulator >= FIXED_TIMESTEP) {
+                    // 上限に達した場合は遅れを諦め、次のフレームに持ち越さない
+                    updateAccumulator = 0.0f;
+                }
+            }
+            inputManager.recordUpdateCount(updates);
+        }
+        
+        if (renderEnabled) {
+            FrameProfiler::Scope profile(FrameProfiler::Section::RENDER);
+            render(updateAccumulator);
+        }
+        profiler.endFrame(stateManager.getCurrentStateType());
+        allocationTracker.endFrame(stateManager.getCurrentStateType());
+        
+        frameCount++;
+        if (maxFrames > 0 && frameCount >= maxFrames) {
+            isRunning = false;
+        }
+        if (inputManager.isReplayFinished()) {
+            isRunning = false;
+        }
+    }
+    
+    inputManager.stopRecording();
+    
+    if (maxFrames > 0 && frameCount > 0) {
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - startTime;
+        std::cout << frameCount << " frames, " << std::fixed << std::setprecision(3)
+                  << elapsed.count() << " ms (" << elapsed.count() / frameCount << " ms/frame)" << std::endl;
+    }
+    
+    if (AllocationTracker::isAvailable()) {
+        AllocationTracker::getInstance().printReport(std::cout);
+    }
+    
+    if (!screenshotPath.empty()) {
+        graphics.saveScreenshot(screenshotPath);
+    }
+    
+    if (!tracePath.empty()) {
+        Trace::writeChromeJson(tracePath);
     }
 }
 
+void SDL2Game::setHeadless(bool enabled) {
+    graphics.setHeadless(enabled);
+}
+
+void SDL2Game::setMaxFrames(int frames) {
+    maxFrames = frames;
+}
+
+void SDL2Game::setScreenshotPath(const std::string& path) {
+    screenshotPath = path;
+}
+
+void SDL2Game::setRenderStatsPath(const std::string& path) {
+    graphics.setRenderStatsCsv(path);
+}
+
+void SDL2Game::setRecordPath(const std::string& path) {
+    recordPath = path;
+}
+
+void SDL2Game::setReplayPath(const std::string& path) {
+    replayPath = path;
+}
+
+void SDL2Game::setRenderEnabled(bool enabled) {
+    renderEnabled = enabled;
+}
+
+void SDL2Game::setFrameCallback(std::function<bool(int frame)> callback) {
+    frameCallback = std::move(callback);
+}
+
+void SDL2Game::setTracePath(const std::string& path) {
+    tracePath = path;
+    Trace::setThreadName("main");
+    Trace::setEnabled(!path.empty());
+}
+
 void SDL2Game::cleanup() {
+    UIConfig::UIConfigManager::getInstance().stopWatching();
     AudioManager::getInstance().cleanup();
     graphics.cleanup();
 }
@@ -66,8 +232,8 @@ void SDL2Game::handleEvents() {
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
         if (event.type == SDL_QUIT) {
-            // 終了前にセーブ
-            if (player) {
+            // 終了前にセーブ（ヘッドレス実行、入力の記録と再生ではセーブデータを書き換えない）
+            if (player && !graphics.isHeadless() && !inputManager.isRecording() && !inputManager.isReplaying()) {
                 float nightTimer = TownState::s_nightTimer;
                 bool nightTimerActive = TownState::s_nightTimerActive;
                 // 現在のStateの状態を取得して保存
@@ -85,12 +251,34 @@ void SDL2Game::handleEvents() {
             break;
         }
         
-        inputManager.handleEvent(event);
+        // 監視用のスレッドで読み込んだUI設定は、フレームの先頭のここで入れ替える
+        if (event.type == configReloadEvent) {
+            UIConfig::UIConfigManager::getInstance().applyPendingReload();
+            continue;
+        }
+        
+        // レンダーターゲットの内容が失われた場合は、各Stateが次の描画で焼き直す
+        if (event.type == SDL_RENDER_TARGETS_RESET || event.type == SDL_RENDER_DEVICE_RESET) {
+            graphics.invalidateRenderTargets();
+        }
+        
+        // 再生中は実際の入力を無視する（記録した入力はinputManager.update()で渡される）
+        if (!inputManager.isReplaying()) {
+            inputManager.handleEvent(event);
+        }
+    }
+    
+    if (inputManager.isKeyJustPressed(InputKey::F3)) {
+        FrameProfiler::getInstance().toggle();
+    }
+    
+    if (inputManager.isKeyJustPressed(InputKey::F4) && !tracePath.empty()) {
+        Trace::writeChromeJson(tracePath);
     }
     
     if (inputManager.isKeyJustPressed(InputKey::ESCAPE)) {
-        // 終了前にセーブ
-        if (player) {
+        // 終了前にセーブ（ヘッドレス実行、入力の記録と再生ではセーブデータを書き換えない）
+        if (player && !graphics.isHeadless() && !inputManager.isRecording() && !inputManager.isReplaying()) {
             float nightTimer = TownState::s_nightTimer;
             bool nightTimerActive = TownState::s_nightTimerActive;
             // 現在のStateの状態を取得して保存
@@ -120,17 +308,15 @@ void SDL2Game::handleEvents() {
 }
 
 void SDL2Game::update(float deltaTime) {
-    uiConfigCheckTimer += deltaTime;
-    if (uiConfigCheckTimer >= UI_CONFIG_CHECK_INTERVAL) {
-        uiConfigCheckTimer = 0.0f;
-        UIConfig::UIConfigManager::getInstance().checkAndReloadConfig();
-    }
-    
+    TRACE_SCOPE("SDL2Game::update");
     stateManager.update(deltaTime);
 }
 
-void SDL2Game::render() {
-    stateManager.render(graphics);
+void SDL2Game::render(float interpolationTime) {
+    TRACE_SCOPE("SDL2Game::render");
+    stateManager.render(graphics, interpolationTime);
+    // 描画中に作った一時的な文字列や配列はここでまとめて解放する
+    FrameArena::getInstance().reset();
 }
 
 void SDL2Game::setDebugStartState(const std::string& state) {
@@ -146,11 +332,11 @@ void SDL2Game::initializeGame() {
     
     player = std::make_shared<Player>(playerName);
     
-    // セーブファイルからロードを試みる（デバッグモードの場合はスキップ）
+    // セーブファイルからロードを試みる（デバッグモード、入力の記録と再生の場合はスキップ）
     float nightTimer = 0.0f;
     bool nightTimerActive = false;
     bool loaded = false;
-    if (debugStartState.empty()) {
+    if (debugStartState.empty() && !inputManager.isRecording() && !inputManager.isReplaying()) {
         loaded = player->autoLoad(nightTimer, nightTimerActive);
     }
     
@@ -160,7 +346,8 @@ void SDL2Game::initializeGame() {
     }
     
     if (loaded) {
-        // セーブファイルからロード成功
+        // セーブファイルからロード成功（乱数列の状態は起動時のロードでのみ復元する）
+        player->restoreRandomState();
         TownState::s_nightTimer = nightTimer;
         TownState::s_nightTimerActive = nightTimerActive;
         
@@ -854,10 +1041,26 @@ void SDL2Game::loadResources() {
         }
     }
 #endif
-    // 画像リソース読み込み
-    loadGameImages();
+    // 画像と効果音はワーカースレッドでデコードし、転送しながら進捗を表示する
+    AssetLoader loader;
+    loadGameImages(loader);
     
-    // BGM読み込み
+    // 効果音読み込み
+    loader.addSound("assets/audio/se/decide.ogg", "decide");
+    loader.addSound("assets/audio/se/button.ogg", "button");
+    loader.addSound("assets/audio/se/drum.ogg", "drum");
+    loader.addSound("assets/audio/se/drum2.ogg", "drum2");
+    loader.addSound("assets/audio/se/attack.ogg", "attack");
+    loader.addSound("assets/audio/se/result.ogg", "result");
+    loader.addSound("assets/audio/se/rush.ogg", "rush");
+    loader.addSound("assets/audio/se/command.ogg", "command");
+    loader.addSound("assets/audio/se/intro.ogg", "intro");
+    
+    // まとめてアトラスに配置するため、転送を一括登録で囲む
+    graphics.beginTextureAtlas();
+    loader.start();
+    
+    // BGMはストリーミング再生のためファイルを開くだけで済むので、デコードを待つ間にメインスレッドで読み込む
     AudioManager::getInstance().loadMusic("assets/audio/bgm/title.ogg", "title");
     AudioManager::getInstance().loadMusic("assets/audio/bgm/room.ogg", "room");
     AudioManager::getInstance().loadMusic("assets/audio/bgm/demon.ogg", "demon");
@@ -866,19 +1069,42 @@ void SDL2Game::loadResources() {
     AudioManager::getInstance().loadMusic("assets/audio/bgm/adversity.ogg", "adversity");
     AudioManager::getInstance().loadMusic("assets/audio/bgm/gameover.ogg", "gameover");
     AudioManager::getInstance().loadMusic("assets/audio/bgm/night.ogg", "night");
-    
-    // 効果音読み込み
-    AudioManager::getInstance().loadSound("assets/audio/se/decide.ogg", "decide");
-    AudioManager::getInstance().loadSound("assets/audio/se/button.ogg", "button");
-    AudioManager::getInstance().loadSound("assets/audio/se/drum.ogg", "drum");
-    AudioManager::getInstance().loadSound("assets/audio/se/drum2.ogg", "drum2");
-    AudioManager::getInstance().loadSound("assets/audio/se/attack.ogg", "attack");
-    AudioManager::getInstance().loadSound("assets/audio/se/result.ogg", "result");
-    AudioManager::getInstance().loadSound("assets/audio/se/rush.ogg", "rush");
-    AudioManager::getInstance().loadSound("assets/audio/se/command.ogg", "command");
-    AudioManager::getInstance().loadSound("assets/audio/se/intro.ogg", "intro");
     // BGM読み込み（クリア曲）
     AudioManager::getInstance().loadMusic("assets/audio/se/clear.ogg", "clear");
+    
+    while (!loader.isFinished()) {
+        // 読み込み中もウィンドウが応答なしにならないようにイベントを処理する
+        SDL_PumpEvents();
+        if (loader.upload(graphics) == 0) {
+            SDL_Delay(1);
+        }
+        renderLoadingScreen(loader.getProgress());
+    }
+    graphics.endTextureAtlas();
+}
+
+void SDL2Game::renderLoadingScreen(float progress) {
+    const int barWidth = SCREEN_WIDTH / 2;
+    const int barHeight = 16;
+    const int barX = (SCREEN_WIDTH - barWidth) / 2;
+    const int barY = SCREEN_HEIGHT / 2;
+    
+    graphics.setDrawColor(0, 0, 0, 255);
+    graphics.clear();
+    
+    graphics.setDrawColor(60, 60, 60, 255);
+    graphics.drawRect(barX, barY, barWidth, barHeight, true);
+    graphics.setDrawColor(255, 215, 0, 255);
+    graphics.drawRect(barX, barY, static_cast<int>(barWidth * progress), barHeight, true);
+    graphics.setDrawColor(255, 255, 255, 255);
+    graphics.drawRect(barX, barY, barWidth, barHeight, false);
+    
+    if (graphics.getFont("default")) {
+        std::string text = "読み込み中... " + std::to_string(static_cast<int>(progress * 100.0f)) + "%";
+        graphics.drawText(text, barX, barY - 30, "default");
+    }
+    
+    graphics.present();
 }
 
 float SDL2Game::calculateDeltaTime() {
@@ -886,89 +1112,89 @@ float SDL2Game::calculateDeltaTime() {
     float deltaTime = std::chrono::duration<float>(currentTime - lastTime).count();
     lastTime = currentTime;
     
-    if (deltaTime > 0.1f) {
-        deltaTime = 0.1f;
+    if (deltaTime > MAX_FRAME_TIME) {
+        deltaTime = MAX_FRAME_TIME;
     }
     
     return deltaTime;
 }
 
-void SDL2Game::loadGameImages() {
-    graphics.loadTexture("assets/textures/characters/player.png", "player");
-    graphics.loadTexture("assets/textures/characters/player_field.png", "player_field");
-    graphics.loadTexture("assets/textures/characters/player_defeat.png", "player_defeat");
-    graphics.loadTexture("assets/textures/characters/player_captured.png", "player_captured");
-    graphics.loadTexture("assets/textures/characters/player_adversity.png", "player_adversity");
-    graphics.loadTexture("assets/textures/characters/king.png", "king");
-    graphics.loadTexture("assets/textures/characters/king.png", "enemy_王様"); // 戦闘画面用
-    graphics.loadTexture("assets/textures/characters/guard.png", "guard");
-    graphics.loadTexture("assets/textures/characters/guard.png", "enemy_衛兵"); // 戦闘画面用
-    graphics.loadTexture("assets/textures/characters/demon.png", "demon");
+void SDL2Game::loadGameImages(AssetLoader& loader) {
+    loader.addImage("assets/textures/characters/player.png", "player");
+    loader.addImage("assets/textures/characters/player_field.png", "player_field");
+    loader.addImage("assets/textures/characters/player_defeat.png", "player_defeat");
+    loader.addImage("assets/textures/characters/player_captured.png", "player_captured");
+    loader.addImage("assets/textures/characters/player_adversity.png", "player_adversity");
+    loader.addImage("assets/textures/characters/king.png", "king");
+    loader.addImage("assets/textures/characters/king.png", "enemy_王様"); // 戦闘画面用
+    loader.addImage("assets/textures/characters/guard.png", "guard");
+    loader.addImage("assets/textures/characters/guard.png", "enemy_衛兵"); // 戦闘画面用
+    loader.addImage("assets/textures/characters/demon.png", "demon");
     
     // 住人画像
-    graphics.loadTexture("assets/textures/characters/resident_1.png", "resident_1");
-    graphics.loadTexture("assets/textures/characters/resident_2.png", "resident_2");
-    graphics.loadTexture("assets/textures/characters/resident_3.png", "resident_3");
-    graphics.loadTexture("assets/textures/characters/resident_4.png", "resident_4");
-    graphics.loadTexture("assets/textures/characters/resident_5.png", "resident_5");
-    graphics.loadTexture("assets/textures/characters/resident_6.png", "resident_6");
-    
-    graphics.loadTexture("assets/textures/enemies/slime.png", "enemy_スライム");
-    graphics.loadTexture("assets/textures/enemies/goblin.png", "enemy_ゴブリン");
-    graphics.loadTexture("assets/textures/enemies/ork.png", "enemy_オーク");
-    graphics.loadTexture("assets/textures/enemies/dragon.png", "enemy_ドラゴン");
-    graphics.loadTexture("assets/textures/enemies/skeleton.png", "enemy_スケルトン");
-    graphics.loadTexture("assets/textures/enemies/ghost.png", "enemy_ゴースト");
-    graphics.loadTexture("assets/textures/enemies/vampire.png", "enemy_ヴァンパイア");
-    graphics.loadTexture("assets/textures/enemies/demon_soldier.png", "enemy_デーモンソルジャー");
-    graphics.loadTexture("assets/textures/enemies/werewolf.png", "enemy_ウェアウルフ");
-    graphics.loadTexture("assets/textures/enemies/minotaur.png", "enemy_ミノタウロス");
-    graphics.loadTexture("assets/textures/enemies/cyclops.png", "enemy_サイクロプス");
-    graphics.loadTexture("assets/textures/enemies/gargoyle.png", "enemy_ガーゴイル");
-    graphics.loadTexture("assets/textures/enemies/phantom.png", "enemy_ファントム");
-    graphics.loadTexture("assets/textures/enemies/dark_knight.png", "enemy_ダークナイト");
-    graphics.loadTexture("assets/textures/enemies/ice_giant.png", "enemy_アイスジャイアント");
-    graphics.loadTexture("assets/textures/enemies/fire_demon.png", "enemy_ファイアデーモン");
-    graphics.loadTexture("assets/textures/enemies/shadow_lord.png", "enemy_シャドウロード");
-    graphics.loadTexture("assets/textures/enemies/ancient_dragon.png", "enemy_エンシェントドラゴン");
-    graphics.loadTexture("assets/textures/enemies/chaos_beast.png", "enemy_カオスビースト");
-    graphics.loadTexture("assets/textures/enemies/elder_god.png", "enemy_エルダーゴッド");
-    graphics.loadTexture("assets/textures/characters/demon.png", "enemy_魔王");
+    loader.addImage("assets/textures/characters/resident_1.png", "resident_1");
+    loader.addImage("assets/textures/characters/resident_2.png", "resident_2");
+    loader.addImage("assets/textures/characters/resident_3.png", "resident_3");
+    loader.addImage("assets/textures/characters/resident_4.png", "resident_4");
+    loader.addImage("assets/textures/characters/resident_5.png", "resident_5");
+    loader.addImage("assets/textures/characters/resident_6.png", "resident_6");
+    
+    loader.addImage("assets/textures/enemies/slime.png", "enemy_スライム");
+    loader.addImage("assets/textures/enemies/goblin.png", "enemy_ゴブリン");
+    loader.addImage("assets/textures/enemies/ork.png", "enemy_オーク");
+    loader.addImage("assets/textures/enemies/dragon.png", "enemy_ドラゴン");
+    loader.addImage("assets/textures/enemies/skeleton.png", "enemy_スケルトン");
+    loader.addImage("assets/textures/enemies/ghost.png", "enemy_ゴースト");
+    loader.addImage("assets/textures/enemies/vampire.png", "enemy_ヴァンパイア");
+    loader.addImage("assets/textures/enemies/demon_soldier.png", "enemy_デーモンソルジャー");
+    loader.addImage("assets/textures/enemies/werewolf.png", "enemy_ウェアウルフ");
+    loader.addImage("assets/textures/enemies/minotaur.png", "enemy_ミノタウロス");
+    loader.addImage("assets/textures/enemies/cyclops.png", "enemy_サイクロプス");
+    loader.addImage("assets/textures/enemies/gargoyle.png", "enemy_ガーゴイル");
+    loader.addImage("assets/textures/enemies/phantom.png", "enemy_ファントム");
+    loader.addImage("assets/textures/enemies/dark_knight.png", "enemy_ダークナイト");
+    loader.addImage("assets/textures/enemies/ice_giant.png", "enemy_アイスジャイアント");
+    loader.addImage("assets/textures/enemies/fire_demon.png", "enemy_ファイアデーモン");
+    loader.addImage("assets/textures/enemies/shadow_lord.png", "enemy_シャドウロード");
+    loader.addImage("assets/textures/enemies/ancient_dragon.png", "enemy_エンシェントドラゴン");
+    loader.addImage("assets/textures/enemies/chaos_beast.png", "enemy_カオスビースト");
+    loader.addImage("assets/textures/enemies/elder_god.png", "enemy_エルダーゴッド");
+    loader.addImage("assets/textures/characters/demon.png", "enemy_魔王");
     
     // フィールド用タイル画像
-    graphics.loadTexture("assets/textures/tiles/grass.png", "grass");
-    graphics.loadTexture("assets/textures/tiles/forest.png", "forest");
-    graphics.loadTexture("assets/textures/tiles/river.png", "river");
-    graphics.loadTexture("assets/textures/tiles/bridge.png", "bridge");
-    graphics.loadTexture("assets/textures/tiles/rock.png", "rock");
-    // graphics.loadTexture("assets/textures/tiles/town_entrance.png", "town_entrance");
+    loader.addImage("assets/textures/tiles/grass.png", "grass");
+    loader.addImage("assets/textures/tiles/forest.png", "forest");
+    loader.addImage("assets/textures/tiles/river.png", "river");
+    loader.addImage("assets/textures/tiles/bridge.png", "bridge");
+    loader.addImage("assets/textures/tiles/rock.png", "rock");
+    // loader.addImage("assets/textures/tiles/town_entrance.png", "town_entrance");
     
     // 建物画像
-    graphics.loadTexture("assets/textures/buildings/house.png", "house");
-    graphics.loadTexture("assets/textures/buildings/castle.png", "castle");
+    loader.addImage("assets/textures/buildings/house.png", "house");
+    loader.addImage("assets/textures/buildings/castle.png", "castle");
     
     // 鳥居画像
-    graphics.loadTexture("assets/textures/objects/torii.png", "torii");
+    loader.addImage("assets/textures/objects/torii.png", "torii");
     
-    graphics.loadTexture("assets/textures/buildings/resident_home.png", "resident_home");
+    loader.addImage("assets/textures/buildings/resident_home.png", "resident_home");
     
     // UI画像
-    graphics.loadTexture("assets/textures/UI/Rock-Paper-Scissors.png", "rock_paper_scissors");
-    graphics.loadTexture("assets/textures/UI/attack.png", "command_attack");
-    graphics.loadTexture("assets/textures/UI/defend.png", "command_defend");
-    graphics.loadTexture("assets/textures/UI/magic.png", "command_magic");
-    graphics.loadTexture("assets/textures/UI/hide.png", "command_hide");
-    graphics.loadTexture("assets/textures/UI/fear.png", "command_fear");
-    graphics.loadTexture("assets/textures/UI/help.png", "command_help");
-    graphics.loadTexture("assets/textures/UI/vs.png", "vs_image");
-    graphics.loadTexture("assets/textures/UI/title_logo.png", "title_logo");
-    graphics.loadTexture("assets/textures/UI/title_bg.png", "title_bg");
-    graphics.loadTexture("assets/textures/UI/life.png", "life");
+    loader.addImage("assets/textures/UI/Rock-Paper-Scissors.png", "rock_paper_scissors");
+    loader.addImage("assets/textures/UI/attack.png", "command_attack");
+    loader.addImage("assets/textures/UI/defend.png", "command_defend");
+    loader.addImage("assets/textures/UI/magic.png", "command_magic");
+    loader.addImage("assets/textures/UI/hide.png", "command_hide");
+    loader.addImage("assets/textures/UI/fear.png", "command_fear");
+    loader.addImage("assets/textures/UI/help.png", "command_help");
+    loader.addImage("assets/textures/UI/vs.png", "vs_image");
+    loader.addImage("assets/textures/UI/title_logo.png", "title_logo");
+    loader.addImage("assets/textures/UI/title_bg.png", "title_bg");
+    loader.addImage("assets/textures/UI/life.png", "life");
     // オブジェクト画像
-    graphics.loadTexture("assets/textures/objects/bed.png", "bed");
-    graphics.loadTexture("assets/textures/objects/desk.png", "desk");
-    graphics.loadTexture("assets/textures/objects/closed_box.png", "closed_box");
-    graphics.loadTexture("assets/textures/objects/open_box.png", "open_box");
+    loader.addImage("assets/textures/objects/bed.png", "bed");
+    loader.addImage("assets/textures/objects/desk.png", "desk");
+    loader.addImage("assets/textures/objects/closed_box.png", "closed_box");
+    loader.addImage("assets/textures/objects/open_box.png", "open_box");
 }
 
 void SDL2Game::setupPlayerForBattle(std::shared_ptr<Player> player, int level) {
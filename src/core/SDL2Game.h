@@ -9,8 +9,10 @@
 #include "../io/InputManager.h"
 #include "GameState.h"
 #include "../entities/Player.h"
+#include "AssetLoader.h"
 #include <memory>
 #include <chrono>
+#include <functional>
 #include <string>
 
 /**
@@ -27,15 +29,36 @@ private:
     bool isRunning;
     std::chrono::high_resolution_clock::time_point lastTime;
     
-    // UI設定ファイルのホットリロード用タイマー
-    float uiConfigCheckTimer;
-    const float UI_CONFIG_CHECK_INTERVAL = 0.1f;  // 0.1秒ごとにチェック（より頻繁にチェック）
+    // 固定間隔の更新（フレームレートに依存せずにゲームロジックを進める）
+    const float FIXED_TIMESTEP = 1.0f / 60.0f;  // 1回の更新で進める時間（秒）
+    const int MAX_UPDATES_PER_FRAME = 15;      // 1フレームで実行する更新の上限（処理落ちが続いた場合に追いつこうとして止まらないように）
+    const float MAX_FRAME_TIME = 0.25f;        // 1フレームの経過時間の上限（秒）
+    float updateAccumulator;                   // まだ更新に消化していない経過時間（秒）
+    
+    // UI設定ファイルのホットリロード用（監視用のスレッドが読み込みを終えるとこのイベントを送る）
+    Uint32 configReloadEvent;
     
     const int SCREEN_WIDTH = 1100;
     const int SCREEN_HEIGHT = 650;
     
     // デバッグモード用
     std::string debugStartState;
+    
+    // ヘッドレス実行用
+    int maxFrames;                  // 実行するフレーム数（0の場合は無制限）
+    int frameCount;
+    std::string screenshotPath;     // 終了時に保存するスクリーンショット（空の場合は保存しない）
+    bool renderEnabled;             // falseの場合は描画を省き、更新だけを行う
+    
+    // 入力の記録と再生用
+    std::string recordPath;         // 入力の記録先（空の場合は記録しない）
+    std::string replayPath;         // 再生する入力の記録ファイル（空の場合は再生しない）
+    
+    // トレース出力用
+    std::string tracePath;          // トレースの書き出し先（空の場合は記録しない）
+    
+    // ベンチマーク用
+    std::function<bool(int)> frameCallback;  // 毎フレームの開始時に呼び出す（falseを返すとゲームループを終了する）
 
 public:
     /**
@@ -70,6 +93,95 @@ public:
      */
     void setDebugStartState(const std::string& state);
     
+    /**
+     * @brief ヘッドレスモードの設定
+     * @details initialize()の前に呼び出す。ウィンドウを作らずオフスクリーンに描画し、オートセーブも行わない。
+     * @param enabled ヘッドレスモードにするか
+     */
+    void setHeadless(bool enabled);
+    
+    /**
+     * @brief 実行するフレーム数の設定
+     * @details 指定したフレーム数を実行するとゲームループを終了し、平均フレーム時間を出力する。
+     * @param frames フレーム数（0の場合は無制限）
+     */
+    void setMaxFrames(int frames);
+    
+    /**
+     * @brief 終了時に保存するスクリーンショットの設定
+     * @param path 保存先のPNGファイルパス
+     */
+    void setScreenshotPath(const std::string& path);
+    
+    /**
+     * @brief トレースの記録と書き出し先の設定
+     * @details 設定時点から記録を開始し、F4キーの入力時と終了時に書き出す。
+     * 初期化中の処理も記録するため、initialize()より前に呼び出す。
+     * @param path 書き出し先のJSONファイルパス（chrome://tracing / Perfetto形式）
+     */
+    void setTracePath(const std::string& path);
+    
+    /**
+     * @brief 描画統計のCSV出力先の設定
+     * @param path 出力先のCSVファイルパス（1フレーム1行）
+     */
+    void setRenderStatsPath(const std::string& path);
+    
+    /**
+     * @brief 入力の記録先の設定
+     * @details initialize()の前に呼び出す。乱数シードとデバッグ開始状態も記録し、終了時にファイルを閉じる。
+     * @param path 記録先のファイルパス
+     */
+    void setRecordPath(const std::string& path);
+    
+    /**
+     * @brief 再生する入力の記録ファイルの設定
+     * @details initialize()の前に呼び出す。記録時と同じフレームに同じ入力を与え、記録した最後のフレームで終了する。
+     * 更新は記録時のフレームごとの回数に合わせ、実時間を待たずに進める。
+     * @param path 記録ファイルのパス
+     */
+    void setReplayPath(const std::string& path);
+    
+    /**
+     * @brief 描画の有効/無効の設定
+     * @details 無効の場合は各Stateの描画と画面更新を省く（長い記録を短時間で再生する場合に使う）。
+     * @param enabled 描画するか
+     */
+    void setRenderEnabled(bool enabled);
+    
+    /**
+     * @brief フレーム開始時に呼び出すコールバックの設定
+     * @details イベント処理の前に呼び出すため、コールバック内でSDL_PushEventした入力はそのフレームで処理される。
+     * ベンチマークのスクリプト入力と終了判定に使用する。
+     * @param callback 実行済みのフレーム数を受け取り、続行する場合にtrueを返す関数
+     */
+    void setFrameCallback(std::function<bool(int frame)> callback);
+    
+    /**
+     * @brief プレイヤーの取得
+     * @return プレイヤーへの共有ポインタ（initialize()の前はnullptr）
+     */
+    std::shared_ptr<Player> getPlayer() const { return player; }
+    
+    /**
+     * @brief 状態管理の取得
+     * @return GameStateManagerへの参照
+     */
+    GameStateManager& getStateManager() { return stateManager; }
+    
+    /**
+     * @brief グラフィックスの取得
+     * @return Graphicsへの参照
+     */
+    const Graphics& getGraphics() const { return graphics; }
+    
+    /**
+     * @brief 戦闘用にプレイヤーのレベルとステータスを設定
+     * @param player プレイヤーへの共有ポインタ
+     * @param level 設定するレベル
+     */
+    static void setupPlayerForBattle(std::shared_ptr<Player> player, int level);
+    
 private:
     /**
      * @brief イベント処理
@@ -84,8 +196,9 @@ private:
     
     /**
      * @brief 描画処理
+     * @param interpolationTime 最後の更新から描画までの経過時間（秒）
      */
-    void render();
+    void render(float interpolationTime);
     
     /**
      * @brief ゲームの初期化
@@ -98,20 +211,20 @@ private:
     void loadResources();
     
     /**
-     * @brief ゲーム画像の読み込み
+     * @brief ゲーム画像の登録
+     * @param loader 画像を登録するアセットローダー
      */
-    void loadGameImages();
+    void loadGameImages(AssetLoader& loader);
     
     /**
-     * @brief デルタタイムの計算
-     * @return 前フレームからの経過時間（秒）
+     * @brief 読み込み画面の描画
+     * @param progress 読み込みの進捗（0.0〜1.0）
      */
-    float calculateDeltaTime();
+    void renderLoadingScreen(float progress);
     
     /**
-     * @brief 戦闘用にプレイヤーのレベルとステータスを設定
-     * @param player プレイヤーへの共有ポインタ
-     * @param level 設定するレベル
+     * @brief デルタタイムの計算
+     * @return 前フレームからの経過時間（秒）
      */
-    static void setupPlayerForBattle(std::shared_ptr<Player> player, int level);
+    float calculateDeltaTime();
 }; 
\ No newline at end of file
@@ -0,0 +1,132 @@
+#include "Trace.h"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+std::atomic<bool> Trace::enabledFlag(false);
+
+namespace {
+    constexpr uint64_t BUFFER_CAPACITY = 1 << 16;  // スレッドごとに保持する区間数
+
+    struct Event {
+        const char* name;
+        int64_t begin;
+        int64_t end;
+    };
+
+    /**
+     * @brief スレッドごとのリングバッファ
+     * @details 書き込みは所有スレッドのみが行う。writtenは書き込み済みの区間の総数で、
+     * 区間を書き終えてから更新するため、書き出し側はwritten未満の区間を読める。
+     */
+    struct ThreadBuffer {
+        int threadId;
+        std::atomic<const char*> threadName;
+        std::vector<Event> events;
+        std::atomic<uint64_t> written;
+    };
+
+    // バッファの登録と書き出しでのみロックする（区間の記録ではロックしない）
+    std::mutex registryMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> registry;
+
+    thread_local ThreadBuffer* localBuffer = nullptr;
+    thread_local const char* localThreadName = nullptr;
+
+    const std::chrono::steady_clock::time_point traceEpoch = std::chrono::steady_clock::now();
+
+    ThreadBuffer& getLocalBuffer() {
+        if (!localBuffer) {
+            // スレッドの終了後も書き出せるよう、バッファはレジストリが所有する
+            auto buffer = std::make_unique<ThreadBuffer>();
+            buffer->threadName.store(localThreadName);
+            buffer->events.resize(BUFFER_CAPACITY);
+            buffer->written.store(0);
+
+            std::lock_guard<std::mutex> lock(registryMutex);
+            buffer->threadId = static_cast<int>(registry.size()) + 1;
+            localBuffer = buffer.get();
+            registry.push_back(std::move(buffer));
+        }
+        return *localBuffer;
+    }
+
+    void writeEscaped(std::ostream& out, const char* text) {
+        for (const char* p = text; *p; p++) {
+            if (*p == '"' || *p == '\\') {
+                out << '\\';
+            }
+            out << *p;
+        }
+    }
+}
+
+void Trace::setThreadName(const char* name) {
+    localThreadName = name;
+    if (localBuffer) {
+        localBuffer->threadName.store(name);
+    }
+}
+
+void Trace::record(const char* name, int64_t begin, int64_t end) {
+    ThreadBuffer& buffer = getLocalBuffer();
+    const uint64_t index = buffer.written.load(std::memory_order_relaxed);
+    buffer.events[index % BUFFER_CAPACITY] = {name, begin, end};
+    buffer.written.store(index + 1, std::memory_order_release);
+}
+
+int64_t Trace::now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - traceEpoch).count();
+}
+
+bool Trace::writeChromeJson(const std::string& filepath) {
+    std::ofstream file(filepath);
+    if (!file.is_open()) {
+        std::cerr << "警告: Trace::writeChromeJson: ファイルを開けません: " << filepath << std::endl;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    file << "{\"traceEvents\":[\n";
+    file << std::fixed << std::setprecision(3);
+    bool first = true;
+    size_t eventCount = 0;
+    for (const auto& buffer : registry) {
+        // スレッド名のメタデータ
+        const char* threadName = buffer->threadName.load();
+        if (!first) file << ",\n";
+        first = false;
+        file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId << ",\"args\":{\"name\":\"";
+        if (threadName) {
+            writeEscaped(file, threadName);
+        } else {
+            file << "thread " << buffer->threadId;
+        }
+        file << "\"}}";
+
+        // バッファが一周している場合は、残っている最新のBUFFER_CAPACITY件だけを書き出す
+        const uint64_t written = buffer->written.load(std::memory_order_acquire);
+        const uint64_t count = written < BUFFER_CAPACITY ? written : BUFFER_CAPACITY;
+        for (uint64_t i = written - count; i < written; i++) {
+            const Event& event = buffer->events[i % BUFFER_CAPACITY];
+            file << ",\n{\"name\":\"";
+            writeEscaped(file, event.name);
+            file << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadId
+                 << ",\"ts\":" << event.begin / 1000.0
+                 << ",\"dur\":" << (event.end - event.begin) / 1000.0 << "}";
+        }
+        eventCount += count;
+    }
+    file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    if (!file.good()) {
+        std::cerr << "警告: Trace::writeChromeJson: 書き込みエラー: " << filepath << std::endl;
+        return false;
+    }
+    std::cout << "トレースを書き出しました: " << filepath << " (" << eventCount << " 区間)" << std::endl;
+    return true;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file Trace.h
+ * @brief 処理区間のトレース記録を担当するクラス
+ * @details TRACE_SCOPE("名前")で囲んだ区間の開始・終了時刻をスレッドごとのリングバッファに記録し、
+ * chrome://tracing / Perfetto で読み込めるJSON形式で書き出す。
+ */
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include "AllocationTracker.h"
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+
+/**
+ * @brief 現在のスコープをトレース区間として記録する
+ * @param name 区間名（文字列リテラル。ポインタのまま保持されるため一時文字列は渡さない）
+ */
+#define TRACE_SCOPE(name) Trace::Scope TRACE_CONCAT(traceScope_, __LINE__)(name)
+
+/**
+ * @brief 処理区間のトレース記録を担当するクラス
+ * @details 記録はスレッドごとのリングバッファへの書き込みのみで、ロックを取らない。
+ * バッファが一周すると古い区間から上書きされる。
+ * 無効の間は区間の出入りでフラグを確認するだけで、時刻の取得も行わない。
+ */
+class Trace {
+public:
+    /**
+     * @brief トレース区間を記録するRAIIクラス
+     */
+    class Scope {
+    public:
+        // ヒープ確保はトレースの有効/無効に関わらず区間名ごとに集計する
+        explicit Scope(const char* name) : name(nullptr), begin(0), allocationZone(name) {
+            if (isEnabled()) {
+                this->name = name;
+                begin = now();
+            }
+        }
+        ~Scope() {
+            if (name) {
+                record(name, begin, now());
+            }
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        const char* name;
+        int64_t begin;
+        AllocationTracker::Zone allocationZone;
+    };
+
+    /**
+     * @brief 記録の有効/無効の設定
+     * @param enabled 有効にするか
+     */
+    static void setEnabled(bool enabled) { enabledFlag.store(enabled, std::memory_order_relaxed); }
+
+    /**
+     * @brief 記録が有効か
+     * @return 有効か
+     */
+    static bool isEnabled() { return enabledFlag.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 現在のスレッドの表示名の設定
+     * @param name 表示名（文字列リテラル）
+     */
+    static void setThreadName(const char* name);
+
+    /**
+     * @brief 記録した区間をChrome Trace Event形式のJSONで書き出す
+     * @details 全スレッドのバッファを読み出す。書き出し中に他のスレッドが記録している場合、
+     * そのスレッドの最新の数件は欠けることがある。
+     * @param filepath 書き出し先のファイルパス
+     * @return 書き出しが成功したか
+     */
+    static bool writeChromeJson(const std::string& filepath);
+
+private:
+    /**
+     * @brief 区間の記録
+     * @param name 区間名
+     * @param begin 開始時刻（ナノ秒）
+     * @param end 終了時刻（ナノ秒）
+     */
+    static void record(const char* name, int64_t begin, int64_t end);
+
+    /**
+     * @brief 現在時刻の取得
+     * @return トレース開始からの経過時間（ナノ秒）
+     */
+    static int64_t now();
+
+    static std::atomic<bool> enabledFlag;
+};
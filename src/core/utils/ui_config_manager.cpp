@@ -1,6 +1,13 @@
 #include "ui_config_manager.h"
+#include "../Trace.h"
+#include "../FileWatcher.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <utility>
 #include <nlohmann/json.hpp>
 #include <ctime>
 #ifdef _WIN32
@@ -12,473 +19,1163 @@
 #endif
 
 namespace UIConfig {
+    namespace {
+        /**
+         * @brief 設定値の型
+         */
+        enum class BindingType {
+            FLOAT,
+            INT,
+            BOOL,
+            UINT8,
+            STRING,
+            COLOR,      // [r, g, b] または [r, g, b, a]
+            POSITION    // absoluteX、absoluteY、offsetX、offsetY、useRelativeのうち指定されたもの
+        };
+        
+        template <typename T> struct BindingTypeOf;
+        template <> struct BindingTypeOf<float> { static constexpr BindingType value = BindingType::FLOAT; };
+        template <> struct BindingTypeOf<int> { static constexpr BindingType value = BindingType::INT; };
+        template <> struct BindingTypeOf<bool> { static constexpr BindingType value = BindingType::BOOL; };
+        template <> struct BindingTypeOf<Uint8> { static constexpr BindingType value = BindingType::UINT8; };
+        template <> struct BindingTypeOf<std::string> { static constexpr BindingType value = BindingType::STRING; };
+        template <> struct BindingTypeOf<SDL_Color> { static constexpr BindingType value = BindingType::COLOR; };
+        template <> struct BindingTypeOf<UIPosition> { static constexpr BindingType value = BindingType::POSITION; };
+        
+        /**
+         * @brief JSONの値と設定のメンバーの対応
+         */
+        struct Binding {
+            UIConfigSection section;
+            const char* path;                       // セクションからのパス（"/"区切り）
+            BindingType type;
+            void* (*target)(UIConfigSnapshot&);     // 設定先のメンバー
+            const char* unlessKeys[2];              // 親オブジェクトにこれらのキーがある場合は適用しない（旧形式との互換用）
+        };
+        
+        #define UI_CONFIG_BIND(section, path, member) \
+            {UIConfigSection::section, path, BindingTypeOf<decltype(std::declval<UIConfigSnapshot&>().member)>::value, \
+             [](UIConfigSnapshot& config) -> void* { return &config.member; }, {nullptr, nullptr}}
+        #define UI_CONFIG_BIND_UNLESS(section, path, member, ...) \
+            {UIConfigSection::section, path, BindingTypeOf<decltype(std::declval<UIConfigSnapshot&>().member)>::value, \
+             [](UIConfigSnapshot& config) -> void* { return &config.member; }, {__VA_ARGS__}}
+        
+        // 同じメンバーに複数のパスが対応する場合は、後のものが優先される
+        const Binding BINDINGS[] = {
+            // メッセージボード設定
+            UI_CONFIG_BIND(MESSAGE_BOARD, "background/position", messageBoardConfig.background.position),
+            UI_CONFIG_BIND(MESSAGE_BOARD, "background/width", messageBoardConfig.background.width),
+            UI_CONFIG_BIND(MESSAGE_BOARD, "background/height", messageBoardConfig.background.height),
+            UI_CONFIG_BIND(MESSAGE_BOARD, "text/position", messageBoardConfig.text.position),
+            UI_CONFIG_BIND(MESSAGE_BOARD, "text/color", messageBoardConfig.text.color),
+            UI_CONFIG_BIND(MESSAGE_BOARD, "backgroundColor", messageBoardConfig.backgroundColor),
+            UI_CONFIG_BIND(MESSAGE_BOARD, "borderColor", messageBoardConfig.borderColor),
+            
+            // CommonUI設定
+            UI_CONFIG_BIND(COMMON_UI, "nightTimer/position", commonUIConfig.nightTimer.position),
+            UI_CONFIG_BIND(COMMON_UI, "nightTimer/width", commonUIConfig.nightTimer.width),
+            UI_CONFIG_BIND(COMMON_UI, "nightTimer/height", commonUIConfig.nightTimer.height),
+            UI_CONFIG_BIND(COMMON_UI, "nightTimerText/position", commonUIConfig.nightTimerText.position),
+            UI_CONFIG_BIND(COMMON_UI, "nightTimerText/color", commonUIConfig.nightTimerText.color),
+            UI_CONFIG_BIND(COMMON_UI, "targetLevel/position", commonUIConfig.targetLevel.position),
+            UI_CONFIG_BIND(COMMON_UI, "targetLevel/width", commonUIConfig.targetLevel.width),
+            UI_CONFIG_BIND(COMMON_UI, "targetLevel/height", commonUIConfig.targetLevel.height),
+            UI_CONFIG_BIND(COMMON_UI, "targetLevelText/position", commonUIConfig.targetLevelText.position),
+            UI_CONFIG_BIND(COMMON_UI, "targetLevelText/color", commonUIConfig.targetLevelText.color),
+            UI_CONFIG_BIND(COMMON_UI, "trustLevels/position", commonUIConfig.trustLevels.position),
+            UI_CONFIG_BIND(COMMON_UI, "trustLevels/width", commonUIConfig.trustLevels.width),
+            UI_CONFIG_BIND(COMMON_UI, "trustLevels/height", commonUIConfig.trustLevels.height),
+            UI_CONFIG_BIND(COMMON_UI, "trustLevelsText/position", commonUIConfig.trustLevelsText.position),
+            UI_CONFIG_BIND(COMMON_UI, "trustLevelsText/color", commonUIConfig.trustLevelsText.color),
+            UI_CONFIG_BIND(COMMON_UI, "gameControllerStatus/position", commonUIConfig.gameControllerStatus.position),
+            UI_CONFIG_BIND(COMMON_UI, "gameControllerStatus/width", commonUIConfig.gameControllerStatus.width),
+            UI_CONFIG_BIND(COMMON_UI, "gameControllerStatus/height", commonUIConfig.gameControllerStatus.height),
+            UI_CONFIG_BIND(COMMON_UI, "targetLevelAchievedColor", commonUIConfig.targetLevelAchievedColor),
+            UI_CONFIG_BIND(COMMON_UI, "targetLevelRemainingColor", commonUIConfig.targetLevelRemainingColor),
+            UI_CONFIG_BIND(COMMON_UI, "targetLevelLineSpacing", commonUIConfig.targetLevelLineSpacing),
+            UI_CONFIG_BIND(COMMON_UI, "trustLevelsLineSpacing1", commonUIConfig.trustLevelsLineSpacing1),
+            UI_CONFIG_BIND(COMMON_UI, "trustLevelsLineSpacing2", commonUIConfig.trustLevelsLineSpacing2),
+            UI_CONFIG_BIND(COMMON_UI, "gameControllerStatusColor", commonUIConfig.gameControllerStatusColor),
+            UI_CONFIG_BIND(COMMON_UI, "backgroundColor", commonUIConfig.backgroundColor),
+            UI_CONFIG_BIND(COMMON_UI, "borderColor", commonUIConfig.borderColor),
+            UI_CONFIG_BIND(COMMON_UI, "backgroundAlpha", commonUIConfig.backgroundAlpha),
+            
+            // MainMenuState設定
+            UI_CONFIG_BIND(MAIN_MENU, "title/position", mainMenuConfig.title.position),
+            UI_CONFIG_BIND(MAIN_MENU, "title/color", mainMenuConfig.title.color),
+            UI_CONFIG_BIND(MAIN_MENU, "playerInfo/position", mainMenuConfig.playerInfo.position),
+            UI_CONFIG_BIND(MAIN_MENU, "playerInfo/color", mainMenuConfig.playerInfo.color),
+            UI_CONFIG_BIND(MAIN_MENU, "adventureButton/position", mainMenuConfig.adventureButton.position),
+            UI_CONFIG_BIND(MAIN_MENU, "adventureButton/width", mainMenuConfig.adventureButton.width),
+            UI_CONFIG_BIND(MAIN_MENU, "adventureButton/height", mainMenuConfig.adventureButton.height),
+            UI_CONFIG_BIND(MAIN_MENU, "adventureButton/normalColor", mainMenuConfig.adventureButton.normalColor),
+            UI_CONFIG_BIND(MAIN_MENU, "adventureButton/hoverColor", mainMenuConfig.adventureButton.hoverColor),
+            UI_CONFIG_BIND(MAIN_MENU, "adventureButton/pressedColor", mainMenuConfig.adventureButton.pressedColor),
+            UI_CONFIG_BIND(MAIN_MENU, "adventureButton/textColor", mainMenuConfig.adventureButton.textColor),
+            UI_CONFIG_BIND(MAIN_MENU, "startGameText/position", mainMenuConfig.startGameText.position),
+            UI_CONFIG_BIND(MAIN_MENU, "startGameText/color", mainMenuConfig.startGameText.color),
+            
+            // BattleState設定
+            UI_CONFIG_BIND(BATTLE, "battleLog/position", battleConfig.battleLog.position),
+            UI_CONFIG_BIND(BATTLE, "battleLog/color", battleConfig.battleLog.color),
+            UI_CONFIG_BIND(BATTLE, "playerStatus/position", battleConfig.playerStatus.position),
+            UI_CONFIG_BIND(BATTLE, "playerStatus/color", battleConfig.playerStatus.color),
+            UI_CONFIG_BIND(BATTLE, "enemyStatus/position", battleConfig.enemyStatus.position),
+            UI_CONFIG_BIND(BATTLE, "enemyStatus/color", battleConfig.enemyStatus.color),
+            UI_CONFIG_BIND(BATTLE, "message/position", battleConfig.message.position),
+            UI_CONFIG_BIND(BATTLE, "message/color", battleConfig.message.color),
+            UI_CONFIG_BIND(BATTLE, "playerHp/position", battleConfig.playerHp.position),
+            UI_CONFIG_BIND(BATTLE, "playerHp/color", battleConfig.playerHp.color),
+            UI_CONFIG_BIND(BATTLE, "playerMp/position", battleConfig.playerMp.position),
+            UI_CONFIG_BIND(BATTLE, "playerMp/color", battleConfig.playerMp.color),
+            UI_CONFIG_BIND(BATTLE, "enemyHp/position", battleConfig.enemyHp.position),
+            UI_CONFIG_BIND(BATTLE, "enemyHp/color", battleConfig.enemyHp.color),
+            UI_CONFIG_BIND(BATTLE, "enemyPosition/position", battleConfig.enemyPosition),
+            UI_CONFIG_BIND(BATTLE, "enemyPosition/width", battleConfig.enemyWidth),
+            UI_CONFIG_BIND(BATTLE, "enemyPosition/height", battleConfig.enemyHeight),
+            UI_CONFIG_BIND(BATTLE, "playerPosition/position", battleConfig.playerPosition),
+            UI_CONFIG_BIND(BATTLE, "playerPosition/width", battleConfig.playerWidth),
+            UI_CONFIG_BIND(BATTLE, "playerPosition/height", battleConfig.playerHeight),
+            UI_CONFIG_BIND(BATTLE, "explanationMessageBoard/background/position", battleConfig.explanationMessageBoard.background.position),
+            UI_CONFIG_BIND(BATTLE, "explanationMessageBoard/background/width", battleConfig.explanationMessageBoard.background.width),
+            UI_CONFIG_BIND(BATTLE, "explanationMessageBoard/background/height", battleConfig.explanationMessageBoard.background.height),
+            UI_CONFIG_BIND(BATTLE, "explanationMessageBoard/text/position", battleConfig.explanationMessageBoard.text.position),
+            UI_CONFIG_BIND(BATTLE, "explanationMessageBoard/text/color", battleConfig.explanationMessageBoard.text.color),
+            UI_CONFIG_BIND(BATTLE, "explanationMessageBoard/backgroundColor", battleConfig.explanationMessageBoard.backgroundColor),
+            UI_CONFIG_BIND(BATTLE, "explanationMessageBoard/borderColor", battleConfig.explanationMessageBoard.borderColor),
+            UI_CONFIG_BIND(BATTLE, "playerName/offsetX", battleConfig.playerName.offsetX),
+            UI_CONFIG_BIND(BATTLE, "playerName/offsetY", battleConfig.playerName.offsetY),
+            UI_CONFIG_BIND(BATTLE, "playerName/color", battleConfig.playerName.color),
+            UI_CONFIG_BIND(BATTLE, "healthBar/offsetX", battleConfig.healthBar.offsetX),
+            UI_CONFIG_BIND(BATTLE, "healthBar/offsetY", battleConfig.healthBar.offsetY),
+            UI_CONFIG_BIND(BATTLE, "healthBar/width", battleConfig.healthBar.width),
+            UI_CONFIG_BIND(BATTLE, "healthBar/height", battleConfig.healthBar.height),
+            UI_CONFIG_BIND(BATTLE, "healthBar/barColor", battleConfig.healthBar.barColor),
+            UI_CONFIG_BIND(BATTLE, "healthBar/bgColor", battleConfig.healthBar.bgColor),
+            UI_CONFIG_BIND(BATTLE, "healthBar/borderColor", battleConfig.healthBar.borderColor),
+            UI_CONFIG_BIND(BATTLE, "commandSelection/selectedCommandOffsetY", battleConfig.commandSelection.selectedCommandOffsetY),
+            UI_CONFIG_BIND(BATTLE, "commandSelection/selectedCommandImageSize", battleConfig.commandSelection.selectedCommandImageSize),
+            UI_CONFIG_BIND(BATTLE, "commandSelection/imageSpacing", battleConfig.commandSelection.imageSpacing),
+            UI_CONFIG_BIND(BATTLE, "commandSelection/arrowSpacing", battleConfig.commandSelection.arrowSpacing),
+            UI_CONFIG_BIND(BATTLE, "commandSelection/buttonBaseOffsetY", battleConfig.commandSelection.buttonBaseOffsetY),
+            UI_CONFIG_BIND(BATTLE, "commandSelection/buttonWidth", battleConfig.commandSelection.buttonWidth),
+            UI_CONFIG_BIND(BATTLE, "commandSelection/buttonHeight", battleConfig.commandSelection.buttonHeight),
+            UI_CONFIG_BIND(BATTLE, "commandSelection/buttonSpacing", battleConfig.commandSelection.buttonSpacing),
+            UI_CONFIG_BIND(BATTLE, "commandSelection/buttonImageSize", battleConfig.commandSelection.buttonImageSize),
+            UI_CONFIG_BIND(BATTLE, "commandSelection/selectedBgColor", battleConfig.commandSelection.selectedBgColor),
+            UI_CONFIG_BIND(BATTLE, "commandSelection/unselectedBgColor", battleConfig.commandSelection.unselectedBgColor),
+            UI_CONFIG_BIND(BATTLE, "commandSelection/selectedBorderColor", battleConfig.commandSelection.selectedBorderColor),
+            UI_CONFIG_BIND(BATTLE, "commandSelection/unselectedBorderColor", battleConfig.commandSelection.unselectedBorderColor),
+            UI_CONFIG_BIND(BATTLE, "commandSelection/selectedTextColor", battleConfig.commandSelection.selectedTextColor),
+            UI_CONFIG_BIND(BATTLE, "commandSelection/unselectedTextColor", battleConfig.commandSelection.unselectedTextColor),
+            UI_CONFIG_BIND(BATTLE, "commandSelection/arrowColor", battleConfig.commandSelection.arrowColor),
+            UI_CONFIG_BIND(BATTLE, "rockPaperScissors/position", battleConfig.rockPaperScissors.position),
+            UI_CONFIG_BIND(BATTLE, "rockPaperScissors/width", battleConfig.rockPaperScissors.width),
+            UI_CONFIG_BIND(BATTLE, "judgeResult/resultText/position", battleConfig.judgeResult.resultText.position),
+            UI_CONFIG_BIND(BATTLE, "judgeResult/resultText/offsetY", battleConfig.judgeResult.resultText.offsetY),
+            UI_CONFIG_BIND(BATTLE, "judgeResult/resultText/baseWidth", battleConfig.judgeResult.resultText.baseWidth),
+            UI_CONFIG_BIND(BATTLE, "judgeResult/resultText/baseHeight", battleConfig.judgeResult.resultText.baseHeight),
+            UI_CONFIG_BIND(BATTLE, "judgeResult/resultText/victory/textColor", battleConfig.judgeResult.resultText.victory.textColor),
+            UI_CONFIG_BIND(BATTLE, "judgeResult/resultText/victory/backgroundColor", battleConfig.judgeResult.resultText.victory.backgroundColor),
+            UI_CONFIG_BIND_UNLESS(BATTLE, "judgeResult/resultText/victoryColor", battleConfig.judgeResult.resultText.victory.textColor, "victory"),
+            UI_CONFIG_BIND_UNLESS(BATTLE, "judgeResult/resultText/victoryColor", battleConfig.judgeResult.resultText.victory.backgroundColor, "victory"),
+            UI_CONFIG_BIND(BATTLE, "judgeResult/resultText/defeat/textColor", battleConfig.judgeResult.resultText.defeat.textColor),
+            UI_CONFIG_BIND(BATTLE, "judgeResult/resultText/defeat/backgroundColor", battleConfig.judgeResult.resultText.defeat.backgroundColor),
+            UI_CONFIG_BIND_UNLESS(BATTLE, "judgeResult/resultText/defeatColor", battleConfig.judgeResult.resultText.defeat.textColor, "defeat"),
+            UI_CONFIG_BIND_UNLESS(BATTLE, "judgeResult/resultText/defeatColor", battleConfig.judgeResult.resultText.defeat.backgroundColor, "defeat"),
+            UI_CONFIG_BIND(BATTLE, "judgeResult/resultText/draw/textColor", battleConfig.judgeResult.resultText.draw.textColor),
+            UI_CONFIG_BIND(BATTLE, "judgeResult/resultText/draw/backgroundColor", battleConfig.judgeResult.resultText.draw.backgroundColor),
+            UI_CONFIG_BIND_UNLESS(BATTLE, "judgeResult/resultText/drawColor", battleConfig.judgeResult.resultText.draw.textColor, "draw"),
+            UI_CONFIG_BIND_UNLESS(BATTLE, "judgeResult/resultText/drawColor", battleConfig.judgeResult.resultText.draw.backgroundColor, "draw"),
+            UI_CONFIG_BIND(BATTLE, "judgeResult/resultText/desperateVictory/textColor", battleConfig.judgeResult.resultText.desperateVictory.textColor),
+            UI_CONFIG_BIND(BATTLE, "judgeResult/resultText/desperateVictory/backgroundColor", battleConfig.judgeResult.resultText.desperateVictory.backgroundColor),
+            UI_CONFIG_BIND_UNLESS(BATTLE, "judgeResult/resultText/desperateVictoryColor", battleConfig.judgeResult.resultText.desperateVictory.textColor, "desperateVictory"),
+            UI_CONFIG_BIND_UNLESS(BATTLE, "judgeResult/resultText/desperateVictoryColor", battleConfig.judgeResult.resultText.desperateVictory.backgroundColor, "desperateVictory"),
+            UI_CONFIG_BIND(BATTLE, "judgeResult/resultText/desperateDefeat/textColor", battleConfig.judgeResult.resultText.desperateDefeat.textColor),
+            UI_CONFIG_BIND(BATTLE, "judgeResult/resultText/desperateDefeat/backgroundColor", battleConfig.judgeResult.resultText.desperateDefeat.backgroundColor),
+            UI_CONFIG_BIND_UNLESS(BATTLE, "judgeResult/resultText/desperateDefeatColor", battleConfig.judgeResult.resultText.desperateDefeat.textColor, "desperateDefeat"),
+            UI_CONFIG_BIND_UNLESS(BATTLE, "judgeResult/resultText/desperateDefeatColor", battleConfig.judgeResult.resultText.desperateDefeat.backgroundColor, "desperateDefeat"),
+            UI_CONFIG_BIND(BATTLE, "judgeResult/damageBonus/position", battleConfig.judgeResult.damageBonus.position),
+            UI_CONFIG_BIND(BATTLE, "judgeResult/damageBonus/offsetY", battleConfig.judgeResult.damageBonus.offsetY),
+            UI_CONFIG_BIND(BATTLE, "judgeResult/damageBonus/offsetX", battleConfig.judgeResult.damageBonus.offsetX),
+            UI_CONFIG_BIND(BATTLE, "judgeResult/damageBonus/color", battleConfig.judgeResult.damageBonus.color),
+            UI_CONFIG_BIND(BATTLE, "judgeResult/damageBonus/format", battleConfig.judgeResult.damageBonus.format),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/winLossText/position", battleConfig.winLossUI.winLossText.position),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/winLossText/color", battleConfig.winLossUI.winLossText.color),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/winLossText/padding", battleConfig.winLossUI.winLossText.padding),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/winLossText/format", battleConfig.winLossUI.winLossText.format),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/totalAttackText/position", battleConfig.winLossUI.totalAttackText.position),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/totalAttackText/color", battleConfig.winLossUI.totalAttackText.color),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/totalAttackText/padding", battleConfig.winLossUI.totalAttackText.padding),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/totalAttackText/playerWinFormat", battleConfig.winLossUI.totalAttackText.playerWinFormat),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/totalAttackText/enemyWinFormat", battleConfig.winLossUI.totalAttackText.enemyWinFormat),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/totalAttackText/drawFormat", battleConfig.winLossUI.totalAttackText.drawFormat),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/totalAttackText/hesitateFormat", battleConfig.winLossUI.totalAttackText.hesitateFormat),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/attackText/position", battleConfig.winLossUI.attackText.position),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/attackText/color", battleConfig.winLossUI.attackText.color),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/attackText/padding", battleConfig.winLossUI.attackText.padding),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/attackText/attackFormat", battleConfig.winLossUI.attackText.attackFormat),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/attackText/rushFormat", battleConfig.winLossUI.attackText.rushFormat),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/attackText/statusUpSpellFormat", battleConfig.winLossUI.attackText.statusUpSpellFormat),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/attackText/healSpellFormat", battleConfig.winLossUI.attackText.healSpellFormat),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/attackText/attackSpellFormat", battleConfig.winLossUI.attackText.attackSpellFormat),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/attackText/defaultSpellFormat", battleConfig.winLossUI.attackText.defaultSpellFormat),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/attackText/defaultAttackFormat", battleConfig.winLossUI.attackText.defaultAttackFormat),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/effectMessageText/position", battleConfig.winLossUI.effectMessageText.position),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/effectMessageText/position/offsetY", battleConfig.winLossUI.effectMessageText.offsetY),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/effectMessageText/offsetY", battleConfig.winLossUI.effectMessageText.offsetY),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/effectMessageText/offsetY", battleConfig.winLossUI.effectMessageText.position.offsetY),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/effectMessageText/color", battleConfig.winLossUI.effectMessageText.color),
+            UI_CONFIG_BIND(BATTLE, "winLossUI/effectMessageText/padding", battleConfig.winLossUI.effectMessageText.padding),
+            UI_CONFIG_BIND(BATTLE, "commandHint/position", battleConfig.commandHint.position),
+            UI_CONFIG_BIND(BATTLE, "commandHint/offsetY", battleConfig.commandHint.offsetY),
+            UI_CONFIG_BIND(BATTLE, "commandHint/offsetX", battleConfig.commandHint.offsetX),
+            UI_CONFIG_BIND(BATTLE, "commandHint/color", battleConfig.commandHint.color),
+            UI_CONFIG_BIND(BATTLE, "commandHint/padding", battleConfig.commandHint.padding),
+            UI_CONFIG_BIND(BATTLE, "commandHint/normalText", battleConfig.commandHint.normalText),
+            UI_CONFIG_BIND(BATTLE, "commandHint/residentText", battleConfig.commandHint.residentText),
+            UI_CONFIG_BIND(BATTLE, "judgePhase/position", battleConfig.judgePhase.position),
+            UI_CONFIG_BIND(BATTLE, "judgePhase/win/text", battleConfig.judgePhase.win.text),
+            UI_CONFIG_BIND(BATTLE, "judgePhase/win/textColor", battleConfig.judgePhase.win.textColor),
+            UI_CONFIG_BIND(BATTLE, "judgePhase/win/backgroundColor", battleConfig.judgePhase.win.backgroundColor),
+            UI_CONFIG_BIND_UNLESS(BATTLE, "judgePhase/win/color", battleConfig.judgePhase.win.textColor, "textColor", "backgroundColor"),
+            UI_CONFIG_BIND_UNLESS(BATTLE, "judgePhase/win/color", battleConfig.judgePhase.win.backgroundColor, "textColor", "backgroundColor"),
+            UI_CONFIG_BIND(BATTLE, "judgePhase/lose/text", battleConfig.judgePhase.lose.text),
+            UI_CONFIG_BIND(BATTLE, "judgePhase/lose/textColor", battleConfig.judgePhase.lose.textColor),
+            UI_CONFIG_BIND(BATTLE, "judgePhase/lose/backgroundColor", battleConfig.judgePhase.lose.backgroundColor),
+            UI_CONFIG_BIND_UNLESS(BATTLE, "judgePhase/lose/color", battleConfig.judgePhase.lose.textColor, "textColor", "backgroundColor"),
+            UI_CONFIG_BIND_UNLESS(BATTLE, "judgePhase/lose/color", battleConfig.judgePhase.lose.backgroundColor, "textColor", "backgroundColor"),
+            UI_CONFIG_BIND(BATTLE, "judgePhase/draw/text", battleConfig.judgePhase.draw.text),
+            UI_CONFIG_BIND(BATTLE, "judgePhase/draw/textColor", battleConfig.judgePhase.draw.textColor),
+            UI_CONFIG_BIND(BATTLE, "judgePhase/draw/backgroundColor", battleConfig.judgePhase.draw.backgroundColor),
+            UI_CONFIG_BIND_UNLESS(BATTLE, "judgePhase/draw/color", battleConfig.judgePhase.draw.textColor, "textColor", "backgroundColor"),
+            UI_CONFIG_BIND_UNLESS(BATTLE, "judgePhase/draw/color", battleConfig.judgePhase.draw.backgroundColor, "textColor", "backgroundColor"),
+            UI_CONFIG_BIND(BATTLE, "judgePhase/baseWidth", battleConfig.judgePhase.baseWidth),
+            UI_CONFIG_BIND(BATTLE, "judgePhase/baseHeight", battleConfig.judgePhase.baseHeight),
+            UI_CONFIG_BIND(BATTLE, "judgePhase/backgroundPadding", battleConfig.judgePhase.backgroundPadding),
+            UI_CONFIG_BIND(BATTLE, "judgePhase/glowColor", battleConfig.judgePhase.glowColor),
+            UI_CONFIG_BIND(BATTLE, "victoryDisplay/position", battleConfig.victoryDisplay.position),
+            UI_CONFIG_BIND(BATTLE, "victoryDisplay/textColor", battleConfig.victoryDisplay.textColor),
+            UI_CONFIG_BIND(BATTLE, "victoryDisplay/backgroundColor", battleConfig.victoryDisplay.backgroundColor),
+            UI_CONFIG_BIND(BATTLE, "victoryDisplay/borderColor", battleConfig.victoryDisplay.borderColor),
+            UI_CONFIG_BIND(BATTLE, "victoryDisplay/padding", battleConfig.victoryDisplay.padding),
+            UI_CONFIG_BIND(BATTLE, "victoryDisplay/format", battleConfig.victoryDisplay.format),
+            UI_CONFIG_BIND(BATTLE, "levelUpDisplay/position", battleConfig.levelUpDisplay.position),
+            UI_CONFIG_BIND(BATTLE, "levelUpDisplay/textColor", battleConfig.levelUpDisplay.textColor),
+            UI_CONFIG_BIND(BATTLE, "levelUpDisplay/backgroundColor", battleConfig.levelUpDisplay.backgroundColor),
+            UI_CONFIG_BIND(BATTLE, "levelUpDisplay/borderColor", battleConfig.levelUpDisplay.borderColor),
+            UI_CONFIG_BIND(BATTLE, "levelUpDisplay/padding", battleConfig.levelUpDisplay.padding),
+            UI_CONFIG_BIND(BATTLE, "levelUpDisplay/singleLevelFormat", battleConfig.levelUpDisplay.singleLevelFormat),
+            UI_CONFIG_BIND(BATTLE, "levelUpDisplay/multiLevelFormat", battleConfig.levelUpDisplay.multiLevelFormat),
+            UI_CONFIG_BIND(BATTLE, "attackMultiplier/position", battleConfig.attackMultiplier.position),
+            UI_CONFIG_BIND(BATTLE, "attackMultiplier/offsetX", battleConfig.attackMultiplier.offsetX),
+            UI_CONFIG_BIND(BATTLE, "attackMultiplier/offsetY", battleConfig.attackMultiplier.offsetY),
+            UI_CONFIG_BIND(BATTLE, "attackMultiplier/textColor", battleConfig.attackMultiplier.textColor),
+            UI_CONFIG_BIND(BATTLE, "attackMultiplier/bgColor", battleConfig.attackMultiplier.bgColor),
+            UI_CONFIG_BIND(BATTLE, "attackMultiplier/borderColor", battleConfig.attackMultiplier.borderColor),
+            UI_CONFIG_BIND(BATTLE, "attackMultiplier/padding", battleConfig.attackMultiplier.padding),
+            UI_CONFIG_BIND(BATTLE, "attackMultiplier/format", battleConfig.attackMultiplier.format),
+            
+            // RoomState設定
+            UI_CONFIG_BIND(ROOM, "messageBoard/background/position", roomConfig.messageBoard.background.position),
+            UI_CONFIG_BIND(ROOM, "messageBoard/background/width", roomConfig.messageBoard.background.width),
+            UI_CONFIG_BIND(ROOM, "messageBoard/background/height", roomConfig.messageBoard.background.height),
+            UI_CONFIG_BIND(ROOM, "messageBoard/text/position", roomConfig.messageBoard.text.position),
+            UI_CONFIG_BIND(ROOM, "messageBoard/text/color", roomConfig.messageBoard.text.color),
+            UI_CONFIG_BIND(ROOM, "messageBoard/backgroundColor", roomConfig.messageBoard.backgroundColor),
+            UI_CONFIG_BIND(ROOM, "messageBoard/borderColor", roomConfig.messageBoard.borderColor),
+            UI_CONFIG_BIND(ROOM, "howToOperateBackground/position", roomConfig.howToOperateBackground.position),
+            UI_CONFIG_BIND(ROOM, "howToOperateBackground/width", roomConfig.howToOperateBackground.width),
+            UI_CONFIG_BIND(ROOM, "howToOperateBackground/height", roomConfig.howToOperateBackground.height),
+            UI_CONFIG_BIND(ROOM, "howToOperateText/position", roomConfig.howToOperateText.position),
+            UI_CONFIG_BIND(ROOM, "howToOperateText/color", roomConfig.howToOperateText.color),
+            
+            // TownState設定
+            UI_CONFIG_BIND(TOWN, "playerInfo/position", townConfig.playerInfo.position),
+            UI_CONFIG_BIND(TOWN, "playerInfo/color", townConfig.playerInfo.color),
+            UI_CONFIG_BIND(TOWN, "controls/position", townConfig.controls.position),
+            UI_CONFIG_BIND(TOWN, "controls/color", townConfig.controls.color),
+            
+            // CastleState設定
+            UI_CONFIG_BIND(CASTLE, "messageBoard/background/position", castleConfig.messageBoard.background.position),
+            UI_CONFIG_BIND(CASTLE, "messageBoard/background/width", castleConfig.messageBoard.background.width),
+            UI_CONFIG_BIND(CASTLE, "messageBoard/background/height", castleConfig.messageBoard.background.height),
+            UI_CONFIG_BIND(CASTLE, "messageBoard/text/position", castleConfig.messageBoard.text.position),
+            UI_CONFIG_BIND(CASTLE, "messageBoard/text/color", castleConfig.messageBoard.text.color),
+            UI_CONFIG_BIND(CASTLE, "messageBoard/backgroundColor", castleConfig.messageBoard.backgroundColor),
+            UI_CONFIG_BIND(CASTLE, "messageBoard/borderColor", castleConfig.messageBoard.borderColor),
+            
+            // DemonCastleState設定
+            UI_CONFIG_BIND(DEMON_CASTLE, "messageBoard/background/position", demonCastleConfig.messageBoard.background.position),
+            UI_CONFIG_BIND(DEMON_CASTLE, "messageBoard/background/width", demonCastleConfig.messageBoard.background.width),
+            UI_CONFIG_BIND(DEMON_CASTLE, "messageBoard/background/height", demonCastleConfig.messageBoard.background.height),
+            UI_CONFIG_BIND(DEMON_CASTLE, "messageBoard/text/position", demonCastleConfig.messageBoard.text.position),
+            UI_CONFIG_BIND(DEMON_CASTLE, "messageBoard/text/color", demonCastleConfig.messageBoard.text.color),
+            UI_CONFIG_BIND(DEMON_CASTLE, "messageBoard/backgroundColor", demonCastleConfig.messageBoard.backgroundColor),
+            UI_CONFIG_BIND(DEMON_CASTLE, "messageBoard/borderColor", demonCastleConfig.messageBoard.borderColor),
+            
+            // GameOverState設定
+            UI_CONFIG_BIND(GAME_OVER, "title/text/position", gameOverConfig.title.text.position),
+            UI_CONFIG_BIND(GAME_OVER, "title/text/color", gameOverConfig.title.text.color),
+            UI_CONFIG_BIND(GAME_OVER, "title/background/position", gameOverConfig.title.background.position),
+            UI_CONFIG_BIND(GAME_OVER, "title/background/width", gameOverConfig.title.background.width),
+            UI_CONFIG_BIND(GAME_OVER, "title/background/height", gameOverConfig.title.background.height),
+            UI_CONFIG_BIND(GAME_OVER, "title/backgroundColor", gameOverConfig.title.backgroundColor),
+            UI_CONFIG_BIND(GAME_OVER, "title/borderColor", gameOverConfig.title.borderColor),
+            UI_CONFIG_BIND(GAME_OVER, "reason/text/position", gameOverConfig.reason.text.position),
+            UI_CONFIG_BIND(GAME_OVER, "reason/text/color", gameOverConfig.reason.text.color),
+            UI_CONFIG_BIND(GAME_OVER, "reason/background/position", gameOverConfig.reason.background.position),
+            UI_CONFIG_BIND(GAME_OVER, "reason/background/width", gameOverConfig.reason.background.width),
+            UI_CONFIG_BIND(GAME_OVER, "reason/background/height", gameOverConfig.reason.background.height),
+            UI_CONFIG_BIND(GAME_OVER, "reason/backgroundColor", gameOverConfig.reason.backgroundColor),
+            UI_CONFIG_BIND(GAME_OVER, "reason/borderColor", gameOverConfig.reason.borderColor),
+            UI_CONFIG_BIND(GAME_OVER, "instruction/text/position", gameOverConfig.instruction.text.position),
+            UI_CONFIG_BIND(GAME_OVER, "instruction/text/color", gameOverConfig.instruction.text.color),
+            UI_CONFIG_BIND(GAME_OVER, "instruction/background/position", gameOverConfig.instruction.background.position),
+            UI_CONFIG_BIND(GAME_OVER, "instruction/background/width", gameOverConfig.instruction.background.width),
+            UI_CONFIG_BIND(GAME_OVER, "instruction/background/height", gameOverConfig.instruction.background.height),
+            UI_CONFIG_BIND(GAME_OVER, "instruction/backgroundColor", gameOverConfig.instruction.backgroundColor),
+            UI_CONFIG_BIND(GAME_OVER, "instruction/borderColor", gameOverConfig.instruction.borderColor),
+            UI_CONFIG_BIND(GAME_OVER, "retry/text/position", gameOverConfig.retry.text.position),
+            UI_CONFIG_BIND(GAME_OVER, "retry/text/color", gameOverConfig.retry.text.color),
+            UI_CONFIG_BIND(GAME_OVER, "retry/background/position", gameOverConfig.retry.background.position),
+            UI_CONFIG_BIND(GAME_OVER, "retry/background/width", gameOverConfig.retry.background.width),
+            UI_CONFIG_BIND(GAME_OVER, "retry/background/height", gameOverConfig.retry.background.height),
+            UI_CONFIG_BIND(GAME_OVER, "retry/backgroundColor", gameOverConfig.retry.backgroundColor),
+            UI_CONFIG_BIND(GAME_OVER, "retry/borderColor", gameOverConfig.retry.borderColor),
+            UI_CONFIG_BIND(GAME_OVER, "extendTime/text/position", gameOverConfig.extendTime.text.position),
+            UI_CONFIG_BIND(GAME_OVER, "extendTime/text/color", gameOverConfig.extendTime.text.color),
+            UI_CONFIG_BIND(GAME_OVER, "extendTime/background/position", gameOverConfig.extendTime.background.position),
+            UI_CONFIG_BIND(GAME_OVER, "extendTime/background/width", gameOverConfig.extendTime.background.width),
+            UI_CONFIG_BIND(GAME_OVER, "extendTime/background/height", gameOverConfig.extendTime.background.height),
+            UI_CONFIG_BIND(GAME_OVER, "extendTime/backgroundColor", gameOverConfig.extendTime.backgroundColor),
+            UI_CONFIG_BIND(GAME_OVER, "extendTime/borderColor", gameOverConfig.extendTime.borderColor),
+            UI_CONFIG_BIND(GAME_OVER, "image/baseSize", gameOverConfig.image.baseSize),
+            
+            // EndingState設定
+            UI_CONFIG_BIND(ENDING, "message/position", endingConfig.message.position),
+            UI_CONFIG_BIND(ENDING, "message/color", endingConfig.message.color),
+            UI_CONFIG_BIND(ENDING, "staffRoll/position", endingConfig.staffRoll.position),
+            UI_CONFIG_BIND(ENDING, "staffRoll/color", endingConfig.staffRoll.color),
+            UI_CONFIG_BIND(ENDING, "theEnd/position", endingConfig.theEnd.position),
+            UI_CONFIG_BIND(ENDING, "theEnd/color", endingConfig.theEnd.color),
+            UI_CONFIG_BIND(ENDING, "returnToMenu/position", endingConfig.returnToMenu.position),
+            UI_CONFIG_BIND(ENDING, "returnToMenu/color", endingConfig.returnToMenu.color),
+            
+            // NightState設定
+            UI_CONFIG_BIND(NIGHT, "nightDisplayBackground/position", nightConfig.nightDisplayBackground.position),
+            UI_CONFIG_BIND(NIGHT, "nightDisplayBackground/width", nightConfig.nightDisplayBackground.width),
+            UI_CONFIG_BIND(NIGHT, "nightDisplayBackground/height", nightConfig.nightDisplayBackground.height),
+            UI_CONFIG_BIND(NIGHT, "nightDisplayText/position", nightConfig.nightDisplayText.position),
+            UI_CONFIG_BIND(NIGHT, "nightDisplayText/color", nightConfig.nightDisplayText.color),
+            UI_CONFIG_BIND(NIGHT, "nightOperationBackground/position", nightConfig.nightOperationBackground.position),
+            UI_CONFIG_BIND(NIGHT, "nightOperationBackground/width", nightConfig.nightOperationBackground.width),
+            UI_CONFIG_BIND(NIGHT, "nightOperationBackground/height", nightConfig.nightOperationBackground.height),
+            UI_CONFIG_BIND(NIGHT, "nightOperationText/position", nightConfig.nightOperationText.position),
+            UI_CONFIG_BIND(NIGHT, "nightOperationText/color", nightConfig.nightOperationText.color),
+            UI_CONFIG_BIND(NIGHT, "messageBoard/background/position", nightConfig.messageBoard.background.position),
+            UI_CONFIG_BIND(NIGHT, "messageBoard/background/width", nightConfig.messageBoard.background.width),
+            UI_CONFIG_BIND(NIGHT, "messageBoard/background/height", nightConfig.messageBoard.background.height),
+            UI_CONFIG_BIND(NIGHT, "messageBoard/text/position", nightConfig.messageBoard.text.position),
+            UI_CONFIG_BIND(NIGHT, "messageBoard/text/color", nightConfig.messageBoard.text.color),
+            UI_CONFIG_BIND(NIGHT, "messageBoard/backgroundColor", nightConfig.messageBoard.backgroundColor),
+            UI_CONFIG_BIND(NIGHT, "messageBoard/borderColor", nightConfig.messageBoard.borderColor),
+            
+            // FieldState設定
+            UI_CONFIG_BIND(FIELD, "monsterLevel/position", fieldConfig.monsterLevel.position),
+            UI_CONFIG_BIND(FIELD, "monsterLevel/color", fieldConfig.monsterLevel.color),
+        };
+        
+        #undef UI_CONFIG_BIND
+        #undef UI_CONFIG_BIND_UNLESS
+        
+        // ui_config.jsonの最上位のキー（UIConfigSectionの順）
+        const char* const SECTION_NAMES[SECTION_COUNT] = {
+            "messageBoard", "commonUI", "mainMenu", "battle", "room", "town",
+            "castle", "demonCastle", "gameOver", "ending", "night", "field"
+        };
+        
+        const nlohmann::json* findMember(const nlohmann::json& object, const char* key) {
+            if (!object.is_object()) {
+                return nullptr;
+            }
+            auto it = object.find(key);
+            return it != object.end() ? &*it : nullptr;
+        }
+        
+        void loadPosition(const nlohmann::json& pos, UIPosition& uiPos) {
+            if (pos.contains("absoluteX")) uiPos.absoluteX = pos["absoluteX"];
+            if (pos.contains("absoluteY")) uiPos.absoluteY = pos["absoluteY"];
+            if (pos.contains("offsetX")) uiPos.offsetX = pos["offsetX"];
+            if (pos.contains("offsetY")) uiPos.offsetY = pos["offsetY"];
+            if (pos.contains("useRelative")) uiPos.useRelative = pos["useRelative"];
+        }
+        
+        void loadColor(const nlohmann::json& col, SDL_Color& color) {
+            if (col.is_array() && col.size() >= 4) {
+                color = {
+                    static_cast<Uint8>(col[0]),
+                    static_cast<Uint8>(col[1]),
+                    static_cast<Uint8>(col[2]),
+                    static_cast<Uint8>(col[3])
+                };
+            } else if (col.is_array() && col.size() >= 3) {
+                color = {
+                    static_cast<Uint8>(col[0]),
+                    static_cast<Uint8>(col[1]),
+                    static_cast<Uint8>(col[2]),
+                    255
+                };
+            }
+        }
+        
+        /**
+         * @brief 1つの対応の適用（パスがJSONにない場合は何もしない）
+         */
+        void applyBinding(const Binding& binding, const nlohmann::json& sectionJson, UIConfigSnapshot& config) {
+            const nlohmann::json* parent = &sectionJson;
+            const nlohmann::json* node = &sectionJson;
+            std::string key;
+            for (const char* c = binding.path; ; c++) {
+                if (*c != '/' && *c != '\0') {
+                    key += *c;
+                    continue;
+                }
+                parent = node;
+                node = findMember(*parent, key.c_str());
+                if (!node) {
+                    return;
+                }
+                key.clear();
+                if (*c == '\0') {
+                    break;
+                }
+            }
+            for (const char* unlessKey : binding.unlessKeys) {
+                if (unlessKey && parent->contains(unlessKey)) {
+                    return;
+                }
+            }
+            
+            void* target = binding.target(config);
+            switch (binding.type) {
+                case BindingType::FLOAT:    *static_cast<float*>(target) = node->get<float>(); break;
+                case BindingType::INT:      *static_cast<int*>(target) = node->get<int>(); break;
+                case BindingType::BOOL:     *static_cast<bool*>(target) = node->get<bool>(); break;
+                case BindingType::UINT8:    *static_cast<Uint8*>(target) = node->get<Uint8>(); break;
+                case BindingType::STRING:   *static_cast<std::string*>(target) = node->get<std::string>(); break;
+                case BindingType::COLOR:    loadColor(*node, *static_cast<SDL_Color*>(target)); break;
+                case BindingType::POSITION: loadPosition(*node, *static_cast<UIPosition*>(target)); break;
+            }
+        }
+        
+        /**
+         * @brief セクションに対応する設定のコピー
+         */
+        void copySection(UIConfigSection section, const UIConfigSnapshot& from, UIConfigSnapshot& to) {
+            switch (section) {
+                case UIConfigSection::MESSAGE_BOARD: to.messageBoardConfig = from.messageBoardConfig; break;
+                case UIConfigSection::COMMON_UI:     to.commonUIConfig = from.commonUIConfig; break;
+                case UIConfigSection::MAIN_MENU:     to.mainMenuConfig = from.mainMenuConfig; break;
+                case UIConfigSection::BATTLE:        to.battleConfig = from.battleConfig; break;
+                case UIConfigSection::ROOM:          to.roomConfig = from.roomConfig; break;
+                case UIConfigSection::TOWN:          to.townConfig = from.townConfig; break;
+                case UIConfigSection::CASTLE:        to.castleConfig = from.castleConfig; break;
+                case UIConfigSection::DEMON_CASTLE:  to.demonCastleConfig = from.demonCastleConfig; break;
+                case UIConfigSection::GAME_OVER:     to.gameOverConfig = from.gameOverConfig; break;
+                case UIConfigSection::ENDING:        to.endingConfig = from.endingConfig; break;
+                case UIConfigSection::NIGHT:         to.nightConfig = from.nightConfig; break;
+                case UIConfigSection::FIELD:         to.fieldConfig = from.fieldConfig; break;
+                default: break;
+            }
+        }
+        
+        // バイナリキャッシュの形式
+        const uint32_t CACHE_MAGIC = 0x43434955;  // "UICC"
+        const uint32_t CACHE_VERSION = 2;
+        const char* const CACHE_SUFFIX = ".cache";
+        
+        /**
+         * @brief バイナリキャッシュのヘッダー
+         * @details 同じ環境で書いて読むだけなので、バイト順と型のサイズは実行環境のものをそのまま使う。
+         */
+        struct CacheHeader {
+            uint32_t magic;
+            uint32_t version;
+            uint64_t layoutHash;    // 対応表とデフォルト値のハッシュ（コードが変わったら使わない）
+            uint64_t sourceSize;    // 元のJSONのサイズ
+            int64_t sourceMtime;    // 元のJSONの更新時刻（0の場合は常にハッシュで確認する）
+            uint64_t sourceHash;    // 元のJSONの内容のハッシュ
+            uint64_t payloadSize;
+            uint64_t payloadHash;
+            uint64_t sectionHashes[SECTION_COUNT];  // UIConfigSnapshot::sectionHashes（キャッシュから起動した後の再読み込みの差分用）
+        };
+        
+        uint64_t hashBytes(const void* data, size_t size, uint64_t hash = 0xCBF29CE484222325ULL) {
+            // FNV-1a
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+            for (size_t i = 0; i < size; i++) {
+                hash ^= bytes[i];
+                hash *= 0x100000001B3ULL;
+            }
+            return hash;
+        }
+        
+        template <typename T>
+        void writeRaw(std::string& out, const T& value) {
+            out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+        
+        template <typename T>
+        bool readRaw(const char*& ptr, const char* end, T& value) {
+            if (static_cast<size_t>(end - ptr) < sizeof(T)) {
+                return false;
+            }
+            std::memcpy(&value, ptr, sizeof(T));
+            ptr += sizeof(T);
+            return true;
+        }
+        
+        /**
+         * @brief 対応表の全てのメンバーの値の書き出し（対応表の順）
+         */
+        void writeBindingValues(const UIConfigSnapshot& config, std::string& out) {
+            // targetは書き込み用の参照を返すが、ここでは読むだけ
+            UIConfigSnapshot& source = const_cast<UIConfigSnapshot&>(config);
+            for (const Binding& binding : BINDINGS) {
+                void* target = binding.target(source);
+                switch (binding.type) {
+                    case BindingType::FLOAT:  writeRaw(out, *static_cast<float*>(target)); break;
+                    case BindingType::INT:    writeRaw(out, static_cast<int32_t>(*static_cast<int*>(target))); break;
+                    case BindingType::BOOL:   writeRaw(out, static_cast<uint8_t>(*static_cast<bool*>(target))); break;
+                    case BindingType::UINT8:  writeRaw(out, *static_cast<Uint8*>(target)); break;
+                    case BindingType::STRING: {
+                        const std::string& text = *static_cast<std::string*>(target);
+                        writeRaw(out, static_cast<uint32_t>(text.size()));
+                        out += text;
+                        break;
+                    }
+                    case BindingType::COLOR: {
+                        const SDL_Color& color = *static_cast<SDL_Color*>(target);
+                        const uint8_t rgba[4] = {color.r, color.g, color.b, color.a};
+                        writeRaw(out, rgba);
+                        break;
+                    }
+                    case BindingType::POSITION: {
+                        const UIPosition& pos = *static_cast<UIPosition*>(target);
+                        writeRaw(out, pos.absoluteX);
+                        writeRaw(out, pos.absoluteY);
+                        writeRaw(out, pos.offsetX);
+                        writeRaw(out, pos.offsetY);
+                        writeRaw(out, static_cast<uint8_t>(pos.useRelative));
+                        break;
+                    }
+                }
+            }
+        }
+        
+        /**
+         * @brief writeBindingValues()で書き出した値の読み込み
+         * @return 全ての値を過不足なく読み込めたか
+         */
+        bool readBindingValues(const char* ptr, const char* end, UIConfigSnapshot& config) {
+            for (const Binding& binding : BINDINGS) {
+                void* target = binding.target(config);
+                bool ok = true;
+                switch (binding.type) {
+                    case BindingType::FLOAT:
+                        ok = readRaw(ptr, end, *static_cast<float*>(target));
+                        break;
+                    case BindingType::INT: {
+                        int32_t value = 0;
+                        ok = readRaw(ptr, end, value);
+                        *static_cast<int*>(target) = value;
+                        break;
+                    }
+                    case BindingType::BOOL: {
+                        uint8_t value = 0;
+                        ok = readRaw(ptr, end, value);
+                        *static_cast<bool*>(target) = value != 0;
+                        break;
+                    }
+                    case BindingType::UINT8:
+                        ok = readRaw(ptr, end, *static_cast<Uint8*>(target));
+                        break;
+                    case BindingType::STRING: {
+                        uint32_t length = 0;
+                        ok = readRaw(ptr, end, length) && static_cast<size_t>(end - ptr) >= length;
+                        if (ok) {
+                            static_cast<std::string*>(target)->assign(ptr, length);
+                            ptr += length;
+                        }
+                        break;
+                    }
+                    case BindingType::COLOR: {
+                        uint8_t rgba[4] = {};
+                        ok = readRaw(ptr, end, rgba);
+                        *static_cast<SDL_Color*>(target) = {rgba[0], rgba[1], rgba[2], rgba[3]};
+                        break;
+                    }
+                    case BindingType::POSITION: {
+                        UIPosition& pos = *static_cast<UIPosition*>(target);
+                        uint8_t useRelative = 0;
+                        ok = readRaw(ptr, end, pos.absoluteX) && readRaw(ptr, end, pos.absoluteY) &&
+                             readRaw(ptr, end, pos.offsetX) && readRaw(ptr, end, pos.offsetY) &&
+                             readRaw(ptr, end, useRelative);
+                        pos.useRelative = useRelative != 0;
+                        break;
+                    }
+                }
+                if (!ok) {
+                    return false;
+                }
+            }
+            return ptr == end;
+        }
+        
+        bool readFileBytes(const std::string& path, std::string& bytes) {
+            std::ifstream file(path, std::ios::binary);
+            if (!file.is_open()) {
+                return false;
+            }
+            bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            return !file.bad();
+        }
+    }
+    
+    UIConfigManager::UIConfigManager() {
+        std::shared_ptr<UIConfigSnapshot> initial = std::make_shared<UIConfigSnapshot>();
+        setDefaultValues(*initial);
+        std::array<bool, SECTION_COUNT> changed;
+        changed.fill(true);
+        publishSnapshot(initial, changed);
+    }
+    
+    UIConfigManager::~UIConfigManager() {
+        stopWatching();
+    }
+    
     UIConfigManager& UIConfigManager::getInstance() {
         static UIConfigManager instance;
         return instance;
     }
     
-    void UIConfigManager::setDefaultValues() {
+    void UIConfigManager::setDefaultValues(UIConfigSnapshot& config) {
         // メッセージボード（デフォルト値）
-        messageBoardConfig.background.position.useRelative = false;
-        messageBoardConfig.background.position.absoluteX = 190.0f;
-        messageBoardConfig.background.position.absoluteY = 480.0f;
-        messageBoardConfig.background.width = 720;
-        messageBoardConfig.background.height = 100;
-        
-        messageBoardConfig.text.position.useRelative = false;
-        messageBoardConfig.text.position.absoluteX = 210.0f;
-        messageBoardConfig.text.position.absoluteY = 500.0f;
-        messageBoardConfig.text.color = {255, 255, 255, 255};
-        messageBoardConfig.backgroundColor = {0, 0, 0, 255};
-        messageBoardConfig.borderColor = {255, 255, 255, 255};
-        
-        commonUIConfig.nightTimer.position.useRelative = false;
-        commonUIConfig.nightTimer.position.absoluteX = 10.0f;
-        commonUIConfig.nightTimer.position.absoluteY = 10.0f;
-        commonUIConfig.nightTimer.width = 160;
-        commonUIConfig.nightTimer.height = 40;
-        
-        commonUIConfig.nightTimerText.position.useRelative = false;
-        commonUIConfig.nightTimerText.position.absoluteX = 25.0f;
-        commonUIConfig.nightTimerText.position.absoluteY = 20.0f;
-        commonUIConfig.nightTimerText.color = {255, 255, 255, 255};
+        config.messageBoardConfig.background.position.useRelative = false;
+        config.messageBoardConfig.background.position.absoluteX = 190.0f;
+        config.messageBoardConfig.background.position.absoluteY = 480.0f;
+        config.messageBoardConfig.background.width = 720;
+        config.messageBoardConfig.background.height = 100;
+        
+        config.messageBoardConfig.text.position.useRelative = false;
+        config.messageBoardConfig.text.position.absoluteX = 210.0f;
+        config.messageBoardConfig.text.position.absoluteY = 500.0f;
+        config.messageBoardConfig.text.color = {255, 255, 255, 255};
+        config.messageBoardConfig.backgroundColor = {0, 0, 0, 255};
+        config.messageBoardConfig.borderColor = {255, 255, 255, 255};
+        
+        config.commonUIConfig.nightTimer.position.useRelative = false;
+        config.commonUIConfig.nightTimer.position.absoluteX = 10.0f;
+        config.commonUIConfig.nightTimer.position.absoluteY = 10.0f;
+        config.commonUIConfig.nightTimer.width = 160;
+        config.commonUIConfig.nightTimer.height = 40;
+        
+        config.commonUIConfig.nightTimerText.position.useRelative = false;
+        config.commonUIConfig.nightTimerText.position.absoluteX = 25.0f;
+        config.commonUIConfig.nightTimerText.position.absoluteY = 20.0f;
+        config.commonUIConfig.nightTimerText.color = {255, 255, 255, 255};
         
         // CommonUI - 目標レベル
-        commonUIConfig.targetLevel.position.useRelative = false;
-        commonUIConfig.targetLevel.position.absoluteX = 10.0f;
-        commonUIConfig.targetLevel.position.absoluteY = 60.0f;
-        commonUIConfig.targetLevel.width = 160;
-        commonUIConfig.targetLevel.height = 60;
+        config.commonUIConfig.targetLevel.position.useRelative = false;
+        config.commonUIConfig.targetLevel.position.absoluteX = 10.0f;
+        config.commonUIConfig.targetLevel.position.absoluteY = 60.0f;
+        config.commonUIConfig.targetLevel.width = 160;
+        config.commonUIConfig.targetLevel.height = 60;
         
-        commonUIConfig.targetLevelText.position.useRelative = false;
-        commonUIConfig.targetLevelText.position.absoluteX = 25.0f;
-        commonUIConfig.targetLevelText.position.absoluteY = 70.0f;
-        commonUIConfig.targetLevelText.color = {255, 255, 255, 255};
+        config.commonUIConfig.targetLevelText.position.useRelative = false;
+        config.commonUIConfig.targetLevelText.position.absoluteX = 25.0f;
+        config.commonUIConfig.targetLevelText.position.absoluteY = 70.0f;
+        config.commonUIConfig.targetLevelText.color = {255, 255, 255, 255};
         
         // CommonUI - 信頼度表示
-        commonUIConfig.trustLevels.position.useRelative = false;
-        commonUIConfig.trustLevels.position.absoluteX = 900.0f;
-        commonUIConfig.trustLevels.position.absoluteY = 10.0f;
-        commonUIConfig.trustLevels.width = 180;
-        commonUIConfig.trustLevels.height = 80;
+        config.commonUIConfig.trustLevels.position.useRelative = false;
+        config.commonUIConfig.trustLevels.position.absoluteX = 900.0f;
+        config.commonUIConfig.trustLevels.position.absoluteY = 10.0f;
+        config.commonUIConfig.trustLevels.width = 180;
+        config.commonUIConfig.trustLevels.height = 80;
         
-        commonUIConfig.trustLevelsText.position.useRelative = false;
-        commonUIConfig.trustLevelsText.position.absoluteX = 915.0f;
-        commonUIConfig.trustLevelsText.position.absoluteY = 20.0f;
-        commonUIConfig.trustLevelsText.color = {255, 255, 255, 255};
+        config.commonUIConfig.trustLevelsText.position.useRelative = false;
+        config.commonUIConfig.trustLevelsText.position.absoluteX = 915.0f;
+        config.commonUIConfig.trustLevelsText.position.absoluteY = 20.0f;
+        config.commonUIConfig.trustLevelsText.color = {255, 255, 255, 255};
         
         // CommonUI - ゲームコントローラー状態
-        commonUIConfig.gameControllerStatus.position.useRelative = false;
-        commonUIConfig.gameControllerStatus.position.absoluteX = 700.0f;
-        commonUIConfig.gameControllerStatus.position.absoluteY = 10.0f;
-        commonUIConfig.gameControllerStatus.width = 80;
-        commonUIConfig.gameControllerStatus.height = 20;
-        commonUIConfig.gameControllerStatusColor = {0, 255, 0, 255};
+        config.commonUIConfig.gameControllerStatus.position.useRelative = false;
+        config.commonUIConfig.gameControllerStatus.position.absoluteX = 700.0f;
+        config.commonUIConfig.gameControllerStatus.position.absoluteY = 10.0f;
+        config.commonUIConfig.gameControllerStatus.width = 80;
+        config.commonUIConfig.gameControllerStatus.height = 20;
+        config.commonUIConfig.gameControllerStatusColor = {0, 255, 0, 255};
         
         // 目標レベルの色と行間
-        commonUIConfig.targetLevelAchievedColor = {0, 255, 0, 255};
-        commonUIConfig.targetLevelRemainingColor = {255, 255, 0, 255};
-        commonUIConfig.targetLevelLineSpacing = 20;
+        config.commonUIConfig.targetLevelAchievedColor = {0, 255, 0, 255};
+        config.commonUIConfig.targetLevelRemainingColor = {255, 255, 0, 255};
+        config.commonUIConfig.targetLevelLineSpacing = 20;
         
         // 信頼度の行間
-        commonUIConfig.trustLevelsLineSpacing1 = 20;
-        commonUIConfig.trustLevelsLineSpacing2 = 40;
+        config.commonUIConfig.trustLevelsLineSpacing1 = 20;
+        config.commonUIConfig.trustLevelsLineSpacing2 = 40;
         
         // 背景色とボーダー色
-        commonUIConfig.backgroundColor = {0, 0, 0, 255};
-        commonUIConfig.borderColor = {255, 255, 255, 255};
-        commonUIConfig.backgroundAlpha = 200;
+        config.commonUIConfig.backgroundColor = {0, 0, 0, 255};
+        config.commonUIConfig.borderColor = {255, 255, 255, 255};
+        config.commonUIConfig.backgroundAlpha = 200;
         
         // MainMenuState
-        mainMenuConfig.title.position.useRelative = false;
-        mainMenuConfig.title.position.absoluteX = 350.0f;
-        mainMenuConfig.title.position.absoluteY = 250.0f;
-        mainMenuConfig.title.color = {255, 215, 0, 255};
-        
-        mainMenuConfig.playerInfo.position.useRelative = false;
-        mainMenuConfig.playerInfo.position.absoluteX = 50.0f;
-        mainMenuConfig.playerInfo.position.absoluteY = 120.0f;
-        mainMenuConfig.playerInfo.color = {255, 255, 255, 255};
-        
-        mainMenuConfig.adventureButton.position.useRelative = false;
-        mainMenuConfig.adventureButton.position.absoluteX = 450.0f;
-        mainMenuConfig.adventureButton.position.absoluteY = 350.0f;
-        mainMenuConfig.adventureButton.width = 200;
-        mainMenuConfig.adventureButton.height = 50;
-        mainMenuConfig.adventureButton.normalColor = {0, 100, 0, 255};
-        mainMenuConfig.adventureButton.hoverColor = {0, 150, 0, 255};
-        mainMenuConfig.adventureButton.pressedColor = {0, 50, 0, 255};
-        mainMenuConfig.adventureButton.textColor = {255, 255, 255, 255};
+        config.mainMenuConfig.title.position.useRelative = false;
+        config.mainMenuConfig.title.position.absoluteX = 350.0f;
+        config.mainMenuConfig.title.position.absoluteY = 250.0f;
+        config.mainMenuConfig.title.color = {255, 215, 0, 255};
+        
+        config.mainMenuConfig.playerInfo.position.useRelative = false;
+        config.mainMenuConfig.playerInfo.position.absoluteX = 50.0f;
+        config.mainMenuConfig.playerInfo.position.absoluteY = 120.0f;
+        config.mainMenuConfig.playerInfo.color = {255, 255, 255, 255};
+        
+        config.mainMenuConfig.adventureButton.position.useRelative = false;
+        config.mainMenuConfig.adventureButton.position.absoluteX = 450.0f;
+        config.mainMenuConfig.adventureButton.position.absoluteY = 350.0f;
+        config.mainMenuConfig.adventureButton.width = 200;
+        config.mainMenuConfig.adventureButton.height = 50;
+        config.mainMenuConfig.adventureButton.normalColor = {0, 100, 0, 255};
+        config.mainMenuConfig.adventureButton.hoverColor = {0, 150, 0, 255};
+        config.mainMenuConfig.adventureButton.pressedColor = {0, 50, 0, 255};
+        config.mainMenuConfig.adventureButton.textColor = {255, 255, 255, 255};
         
         // "START GAME : PRESS ENTER"テキスト
-        mainMenuConfig.startGameText.position.useRelative = true;
-        mainMenuConfig.startGameText.position.offsetX = 0.0f;
-        mainMenuConfig.startGameText.position.offsetY = 100.0f;  // 画面下部から100px上（相対位置）
-        mainMenuConfig.startGameText.color = {255, 255, 255, 255};
+        config.mainMenuConfig.startGameText.position.useRelative = true;
+        config.mainMenuConfig.startGameText.position.offsetX = 0.0f;
+        config.mainMenuConfig.startGameText.position.offsetY = 100.0f;  // 画面下部から100px上（相対位置）
+        config.mainMenuConfig.startGameText.color = {255, 255, 255, 255};
         
         // BattleState
-        battleConfig.battleLog.position.useRelative = false;
-        battleConfig.battleLog.position.absoluteX = 150.0f;
-        battleConfig.battleLog.position.absoluteY = 400.0f;
-        battleConfig.battleLog.color = {255, 255, 255, 255};
-        
-        battleConfig.playerStatus.position.useRelative = false;
-        battleConfig.playerStatus.position.absoluteX = 50.0f;
-        battleConfig.playerStatus.position.absoluteY = 50.0f;
-        battleConfig.playerStatus.color = {255, 255, 255, 255};
-        
-        battleConfig.enemyStatus.position.useRelative = false;
-        battleConfig.enemyStatus.position.absoluteX = 400.0f;
-        battleConfig.enemyStatus.position.absoluteY = 50.0f;
-        battleConfig.enemyStatus.color = {255, 255, 255, 255};
-        
-        battleConfig.message.position.useRelative = false;
-        battleConfig.message.position.absoluteX = 50.0f;
-        battleConfig.message.position.absoluteY = 450.0f;
-        battleConfig.message.color = {255, 255, 255, 255};
-        
-        battleConfig.playerHp.position.useRelative = false;
-        battleConfig.playerHp.position.absoluteX = 500.0f;
-        battleConfig.playerHp.position.absoluteY = 260.0f;
-        battleConfig.playerHp.color = {255, 255, 255, 255};
-        
-        battleConfig.playerMp.position.useRelative = false;
-        battleConfig.playerMp.position.absoluteX = 500.0f;
-        battleConfig.playerMp.position.absoluteY = 280.0f;
-        battleConfig.playerMp.color = {255, 255, 255, 255};
-        
-        battleConfig.enemyHp.position.useRelative = false;
-        battleConfig.enemyHp.position.absoluteX = 500.0f;
-        battleConfig.enemyHp.position.absoluteY = 120.0f;
-        battleConfig.enemyHp.color = {255, 255, 255, 255};
-        
-        battleConfig.enemyPosition.useRelative = false;
-        battleConfig.enemyPosition.absoluteX = 500.0f;
-        battleConfig.enemyPosition.absoluteY = 150.0f;
-        battleConfig.enemyWidth = 100;
-        battleConfig.enemyHeight = 100;
-        
-        battleConfig.playerPosition.useRelative = false;
-        battleConfig.playerPosition.absoluteX = 500.0f;
-        battleConfig.playerPosition.absoluteY = 300.0f;
-        battleConfig.playerWidth = 60;
-        battleConfig.playerHeight = 60;
+        config.battleConfig.battleLog.position.useRelative = false;
+        config.battleConfig.battleLog.position.absoluteX = 150.0f;
+        config.battleConfig.battleLog.position.absoluteY = 400.0f;
+        config.battleConfig.battleLog.color = {255, 255, 255, 255};
+        
+        config.battleConfig.playerStatus.position.useRelative = false;
+        config.battleConfig.playerStatus.position.absoluteX = 50.0f;
+        config.battleConfig.playerStatus.position.absoluteY = 50.0f;
+        config.battleConfig.playerStatus.color = {255, 255, 255, 255};
+        
+        config.battleConfig.enemyStatus.position.useRelative = false;
+        config.battleConfig.enemyStatus.position.absoluteX = 400.0f;
+        config.battleConfig.enemyStatus.position.absoluteY = 50.0f;
+        config.battleConfig.enemyStatus.color = {255, 255, 255, 255};
+        
+        config.battleConfig.message.position.useRelative = false;
+        config.battleConfig.message.position.absoluteX = 50.0f;
+        config.battleConfig.message.position.absoluteY = 450.0f;
+        config.battleConfig.message.color = {255, 255, 255, 255};
+        
+        config.battleConfig.playerHp.position.useRelative = false;
+        config.battleConfig.playerHp.position.absoluteX = 500.0f;
+        config.battleConfig.playerHp.position.absoluteY = 260.0f;
+        config.battleConfig.playerHp.color = {255, 255, 255, 255};
+        
+        config.battleConfig.playerMp.position.useRelative = false;
+        config.battleConfig.playerMp.position.absoluteX = 500.0f;
+        config.battleConfig.playerMp.position.absoluteY = 280.0f;
+        config.battleConfig.playerMp.color = {255, 255, 255, 255};
+        
+        config.battleConfig.enemyHp.position.useRelative = false;
+        config.battleConfig.enemyHp.position.absoluteX = 500.0f;
+        config.battleConfig.enemyHp.position.absoluteY = 120.0f;
+        config.battleConfig.enemyHp.color = {255, 255, 255, 255};
+        
+        config.battleConfig.enemyPosition.useRelative = false;
+        config.battleConfig.enemyPosition.absoluteX = 500.0f;
+        config.battleConfig.enemyPosition.absoluteY = 150.0f;
+        config.battleConfig.enemyWidth = 100;
+        config.battleConfig.enemyHeight = 100;
+        
+        config.battleConfig.playerPosition.useRelative = false;
+        config.battleConfig.playerPosition.absoluteX = 500.0f;
+        config.battleConfig.playerPosition.absoluteY = 300.0f;
+        config.battleConfig.playerWidth = 60;
+        config.battleConfig.playerHeight = 60;
         
         // 説明用メッセージボード
-        battleConfig.explanationMessageBoard.background.position.useRelative = false;
-        battleConfig.explanationMessageBoard.background.position.absoluteX = 190.0f;
-        battleConfig.explanationMessageBoard.background.position.absoluteY = 480.0f;
-        battleConfig.explanationMessageBoard.background.width = 720;
-        battleConfig.explanationMessageBoard.background.height = 100;
-        battleConfig.explanationMessageBoard.text.position.useRelative = false;
-        battleConfig.explanationMessageBoard.text.position.absoluteX = 30.0f;  // 左下に配置
-        battleConfig.explanationMessageBoard.text.position.absoluteY = 580.0f;  // 画面下部から背景の内側に配置
-        battleConfig.explanationMessageBoard.text.color = {255, 255, 255, 255};
+        config.battleConfig.explanationMessageBoard.background.position.useRelative = false;
+        config.battleConfig.explanationMessageBoard.background.position.absoluteX = 190.0f;
+        config.battleConfig.explanationMessageBoard.background.position.absoluteY = 480.0f;
+        config.battleConfig.explanationMessageBoard.background.width = 720;
+        config.battleConfig.explanationMessageBoard.background.height = 100;
+        config.battleConfig.explanationMessageBoard.text.position.useRelative = false;
+        config.battleConfig.explanationMessageBoard.text.position.absoluteX = 30.0f;  // 左下に配置
+        config.battleConfig.explanationMessageBoard.text.position.absoluteY = 580.0f;  // 画面下部から背景の内側に配置
+        config.battleConfig.explanationMessageBoard.text.color = {255, 255, 255, 255};
         
         // プレイヤー名の設定（相対位置オフセット）
-        battleConfig.playerName.offsetX = -80.0f;
-        battleConfig.playerName.offsetY = -40.0f;
-        battleConfig.playerName.color = {255, 255, 255, 255};
+        config.battleConfig.playerName.offsetX = -80.0f;
+        config.battleConfig.playerName.offsetY = -40.0f;
+        config.battleConfig.playerName.color = {255, 255, 255, 255};
         
         // 体力バーの設定（相対位置オフセット）
-        battleConfig.healthBar.offsetX = 10.0f;
-        battleConfig.healthBar.offsetY = -40.0f;
-        battleConfig.healthBar.width = 150;
-        battleConfig.healthBar.height = 20;
-        battleConfig.healthBar.barColor = {150, 255, 150, 255};      // 黄緑色
-        battleConfig.healthBar.bgColor = {50, 50, 50, 255};          // 暗いグレー
-        battleConfig.healthBar.borderColor = {255, 255, 255, 255};   // 白色
+        config.battleConfig.healthBar.offsetX = 10.0f;
+        config.battleConfig.healthBar.offsetY = -40.0f;
+        config.battleConfig.healthBar.width = 150;
+        config.battleConfig.healthBar.height = 20;
+        config.battleConfig.healthBar.barColor = {150, 255, 150, 255};      // 黄緑色
+        config.battleConfig.healthBar.bgColor = {50, 50, 50, 255};          // 暗いグレー
+        config.battleConfig.healthBar.borderColor = {255, 255, 255, 255};   // 白色
         
         // コマンド選択UIの設定
-        battleConfig.commandSelection.selectedCommandOffsetY = -150.0f;
-        battleConfig.commandSelection.selectedCommandImageSize = 50;
-        battleConfig.commandSelection.imageSpacing = 60;
-        battleConfig.commandSelection.arrowSpacing = 20;
-        battleConfig.commandSelection.buttonBaseOffsetY = -50.0f;
-        battleConfig.commandSelection.buttonWidth = 200;
-        battleConfig.commandSelection.buttonHeight = 60;
-        battleConfig.commandSelection.buttonSpacing = 80;
-        battleConfig.commandSelection.buttonImageSize = 60;
-        battleConfig.commandSelection.selectedBgColor = {100, 200, 255, 200};
-        battleConfig.commandSelection.unselectedBgColor = {50, 50, 50, 150};
-        battleConfig.commandSelection.selectedBorderColor = {255, 215, 0, 255};
-        battleConfig.commandSelection.unselectedBorderColor = {150, 150, 150, 255};
-        battleConfig.commandSelection.selectedTextColor = {255, 255, 255, 255};
-        battleConfig.commandSelection.unselectedTextColor = {200, 200, 200, 255};
-        battleConfig.commandSelection.arrowColor = {255, 255, 255, 255};
+        config.battleConfig.commandSelection.selectedCommandOffsetY = -150.0f;
+        config.battleConfig.commandSelection.selectedCommandImageSize = 50;
+        config.battleConfig.commandSelection.imageSpacing = 60;
+        config.battleConfig.commandSelection.arrowSpacing = 20;
+        config.battleConfig.commandSelection.buttonBaseOffsetY = -50.0f;
+        config.battleConfig.commandSelection.buttonWidth = 200;
+        config.battleConfig.commandSelection.buttonHeight = 60;
+        config.battleConfig.commandSelection.buttonSpacing = 80;
+        config.battleConfig.commandSelection.buttonImageSize = 60;
+        config.battleConfig.commandSelection.selectedBgColor = {100, 200, 255, 200};
+        config.battleConfig.commandSelection.unselectedBgColor = {50, 50, 50, 150};
+        config.battleConfig.commandSelection.selectedBorderColor = {255, 215, 0, 255};
+        config.battleConfig.commandSelection.unselectedBorderColor = {150, 150, 150, 255};
+        config.battleConfig.commandSelection.selectedTextColor = {255, 255, 255, 255};
+        config.battleConfig.commandSelection.unselectedTextColor = {200, 200, 200, 255};
+        config.battleConfig.commandSelection.arrowColor = {255, 255, 255, 255};
         
         // 三すくみ画像の設定
-        battleConfig.rockPaperScissors.position.useRelative = false;
-        battleConfig.rockPaperScissors.position.absoluteX = 0.0f;  // 中央に配置（計算時に調整）
-        battleConfig.rockPaperScissors.position.absoluteY = 20.0f;  // 上部から20px下
-        battleConfig.rockPaperScissors.width = 200;
+        config.battleConfig.rockPaperScissors.position.useRelative = false;
+        config.battleConfig.rockPaperScissors.position.absoluteX = 0.0f;  // 中央に配置（計算時に調整）
+        config.battleConfig.rockPaperScissors.position.absoluteY = 20.0f;  // 上部から20px下
+        config.battleConfig.rockPaperScissors.width = 200;
         
         // ジャッジ結果フェーズのUI設定
-        battleConfig.judgeResult.resultText.position.useRelative = true;
-        battleConfig.judgeResult.resultText.position.offsetY = -100.0f;
-        battleConfig.judgeResult.resultText.baseWidth = 400;
-        battleConfig.judgeResult.resultText.baseHeight = 100;
-        battleConfig.judgeResult.resultText.victory.textColor = {255, 255, 255, 255};
-        battleConfig.judgeResult.resultText.victory.backgroundColor = {255, 215, 0, 255};
-        battleConfig.judgeResult.resultText.defeat.textColor = {255, 255, 255, 255};
-        battleConfig.judgeResult.resultText.defeat.backgroundColor = {255, 0, 0, 255};
-        battleConfig.judgeResult.resultText.draw.textColor = {255, 255, 255, 255};
-        battleConfig.judgeResult.resultText.draw.backgroundColor = {200, 200, 200, 255};
-        battleConfig.judgeResult.resultText.desperateVictory.textColor = {255, 255, 255, 255};
-        battleConfig.judgeResult.resultText.desperateVictory.backgroundColor = {255, 215, 0, 255};
-        battleConfig.judgeResult.resultText.desperateDefeat.textColor = {255, 255, 255, 255};
-        battleConfig.judgeResult.resultText.desperateDefeat.backgroundColor = {255, 0, 0, 255};
-        
-        battleConfig.judgeResult.damageBonus.position.useRelative = true;
-        battleConfig.judgeResult.damageBonus.position.offsetY = 80.0f;
-        battleConfig.judgeResult.damageBonus.position.offsetX = -150.0f;
-        battleConfig.judgeResult.damageBonus.color = {255, 255, 100, 255};
-        battleConfig.judgeResult.damageBonus.format = "✨ ダメージ{multiplier}倍ボーナス！ ✨";
+        config.battleConfig.judgeResult.resultText.position.useRelative = true;
+        config.battleConfig.judgeResult.resultText.position.offsetY = -100.0f;
+        config.battleConfig.judgeResult.resultText.baseWidth = 400;
+        config.battleConfig.judgeResult.resultText.baseHeight = 100;
+        config.battleConfig.judgeResult.resultText.victory.textColor = {255, 255, 255, 255};
+        config.battleConfig.judgeResult.resultText.victory.backgroundColor = {255, 215, 0, 255};
+        config.battleConfig.judgeResult.resultText.defeat.textColor = {255, 255, 255, 255};
+        config.battleConfig.judgeResult.resultText.defeat.backgroundColor = {255, 0, 0, 255};
+        config.battleConfig.judgeResult.resultText.draw.textColor = {255, 255, 255, 255};
+        config.battleConfig.judgeResult.resultText.draw.backgroundColor = {200, 200, 200, 255};
+        config.battleConfig.judgeResult.resultText.desperateVictory.textColor = {255, 255, 255, 255};
+        config.battleConfig.judgeResult.resultText.desperateVictory.backgroundColor = {255, 215, 0, 255};
+        config.battleConfig.judgeResult.resultText.desperateDefeat.textColor = {255, 255, 255, 255};
+        config.battleConfig.judgeResult.resultText.desperateDefeat.backgroundColor = {255, 0, 0, 255};
+        
+        config.battleConfig.judgeResult.damageBonus.position.useRelative = true;
+        config.battleConfig.judgeResult.damageBonus.position.offsetY = 80.0f;
+        config.battleConfig.judgeResult.damageBonus.position.offsetX = -150.0f;
+        config.battleConfig.judgeResult.damageBonus.color = {255, 255, 100, 255};
+        config.battleConfig.judgeResult.damageBonus.format = "✨ ダメージ{multiplier}倍ボーナス！ ✨";
         
         // 勝敗UIの設定
-        battleConfig.winLossUI.winLossText.position.useRelative = false;
-        battleConfig.winLossUI.winLossText.position.offsetY = 20.0f;
-        battleConfig.winLossUI.winLossText.color = {255, 255, 255, 255};
-        battleConfig.winLossUI.winLossText.padding = 8;
-        battleConfig.winLossUI.winLossText.format = "自分 {playerWins}勝  敵 {enemyWins}勝";
-        
-        battleConfig.winLossUI.totalAttackText.position.useRelative = false;
-        battleConfig.winLossUI.totalAttackText.position.offsetY = 20.0f;
-        battleConfig.winLossUI.totalAttackText.color = {255, 255, 255, 255};
-        battleConfig.winLossUI.totalAttackText.padding = 8;
-        battleConfig.winLossUI.totalAttackText.playerWinFormat = "{playerName}が{turns}ターン分の攻撃を実行！";
-        battleConfig.winLossUI.totalAttackText.enemyWinFormat = "敵が{turns}ターン分の攻撃を実行！";
-        battleConfig.winLossUI.totalAttackText.drawFormat = "相打ち！";
-        battleConfig.winLossUI.totalAttackText.hesitateFormat = "{playerName}はメンタルの影響で攻撃をためらいました。";
-        
-        battleConfig.winLossUI.attackText.position.useRelative = false;
-        battleConfig.winLossUI.attackText.position.offsetY = 20.0f;
-        battleConfig.winLossUI.attackText.color = {255, 255, 255, 255};
-        battleConfig.winLossUI.attackText.padding = 8;
-        battleConfig.winLossUI.attackText.attackFormat = "{playerName}のアタック！";
-        battleConfig.winLossUI.attackText.rushFormat = "{playerName}のラッシュアタック！";
-        battleConfig.winLossUI.attackText.statusUpSpellFormat = "{playerName}が強化呪文発動！";
-        battleConfig.winLossUI.attackText.healSpellFormat = "{playerName}が回復呪文発動！";
-        battleConfig.winLossUI.attackText.attackSpellFormat = "{playerName}が攻撃呪文発動！";
-        battleConfig.winLossUI.attackText.defaultSpellFormat = "{playerName}が呪文発動！";
-        battleConfig.winLossUI.attackText.defaultAttackFormat = "{playerName}の攻撃！";
+        config.battleConfig.winLossUI.winLossText.position.useRelative = false;
+        config.battleConfig.winLossUI.winLossText.position.offsetY = 20.0f;
+        config.battleConfig.winLossUI.winLossText.color = {255, 255, 255, 255};
+        config.battleConfig.winLossUI.winLossText.padding = 8;
+        config.battleConfig.winLossUI.winLossText.format = "自分 {playerWins}勝  敵 {enemyWins}勝";
+        
+        config.battleConfig.winLossUI.totalAttackText.position.useRelative = false;
+        config.battleConfig.winLossUI.totalAttackText.position.offsetY = 20.0f;
+        config.battleConfig.winLossUI.totalAttackText.color = {255, 255, 255, 255};
+        config.battleConfig.winLossUI.totalAttackText.padding = 8;
+        config.battleConfig.winLossUI.totalAttackText.playerWinFormat = "{playerName}が{turns}ターン分の攻撃を実行！";
+        config.battleConfig.winLossUI.totalAttackText.enemyWinFormat = "敵が{turns}ターン分の攻撃を実行！";
+        config.battleConfig.winLossUI.totalAttackText.drawFormat = "相打ち！";
+        config.battleConfig.winLossUI.totalAttackText.hesitateFormat = "{playerName}はメンタルの影響で攻撃をためらいました。";
+        
+        config.battleConfig.winLossUI.attackText.position.useRelative = false;
+        config.battleConfig.winLossUI.attackText.position.offsetY = 20.0f;
+        config.battleConfig.winLossUI.attackText.color = {255, 255, 255, 255};
+        config.battleConfig.winLossUI.attackText.padding = 8;
+        config.battleConfig.winLossUI.attackText.attackFormat = "{playerName}のアタック！";
+        config.battleConfig.winLossUI.attackText.rushFormat = "{playerName}のラッシュアタック！";
+        config.battleConfig.winLossUI.attackText.statusUpSpellFormat = "{playerName}が強化呪文発動！";
+        config.battleConfig.winLossUI.attackText.healSpellFormat = "{playerName}が回復呪文発動！";
+        config.battleConfig.winLossUI.attackText.attackSpellFormat = "{playerName}が攻撃呪文発動！";
+        config.battleConfig.winLossUI.attackText.defaultSpellFormat = "{playerName}が呪文発動！";
+        config.battleConfig.winLossUI.attackText.defaultAttackFormat = "{playerName}の攻撃！";
         
         // 特殊技の効果メッセージテキストの設定
-        battleConfig.winLossUI.effectMessageText.position.useRelative = false;
-        battleConfig.winLossUI.effectMessageText.position.offsetY = 8.0f;  // デフォルトはattackText.paddingと同じ
-        battleConfig.winLossUI.effectMessageText.offsetY = 8.0f;  // 後方互換性のため
-        battleConfig.winLossUI.effectMessageText.color = {255, 255, 255, 255};
-        battleConfig.winLossUI.effectMessageText.padding = 8;
+        config.battleConfig.winLossUI.effectMessageText.position.useRelative = false;
+        config.battleConfig.winLossUI.effectMessageText.position.offsetY = 8.0f;  // デフォルトはattackText.paddingと同じ
+        config.battleConfig.winLossUI.effectMessageText.offsetY = 8.0f;  // 後方互換性のため
+        config.battleConfig.winLossUI.effectMessageText.color = {255, 255, 255, 255};
+        config.battleConfig.winLossUI.effectMessageText.padding = 8;
         
         // コマンド選択ヒントテキストの設定
-        battleConfig.commandHint.position.useRelative = true;
-        battleConfig.commandHint.position.offsetY = -100.0f;
-        battleConfig.commandHint.position.offsetX = -120.0f;
-        battleConfig.commandHint.color = {255, 255, 255, 255};
-        battleConfig.commandHint.padding = 8;
-        battleConfig.commandHint.normalText = "選択: W/S 決定: ENTER 戻る: Q";
-        battleConfig.commandHint.residentText = "選択: W/S 決定: ENTER";
+        config.battleConfig.commandHint.position.useRelative = true;
+        config.battleConfig.commandHint.position.offsetY = -100.0f;
+        config.battleConfig.commandHint.position.offsetX = -120.0f;
+        config.battleConfig.commandHint.color = {255, 255, 255, 255};
+        config.battleConfig.commandHint.padding = 8;
+        config.battleConfig.commandHint.normalText = "選択: W/S 決定: ENTER 戻る: Q";
+        config.battleConfig.commandHint.residentText = "選択: W/S 決定: ENTER";
         
         // ジャッジフェーズの結果表示UI設定
-        battleConfig.judgePhase.position.useRelative = true;  // デフォルトは相対位置（画面中央）
-        battleConfig.judgePhase.position.offsetX = 0.0f;
-        battleConfig.judgePhase.position.offsetY = 0.0f;
-        battleConfig.judgePhase.win.text = "勝ち！";
-        battleConfig.judgePhase.win.textColor = {255, 255, 255, 255};
-        battleConfig.judgePhase.win.backgroundColor = {255, 215, 0, 255};
-        battleConfig.judgePhase.lose.text = "負け...";
-        battleConfig.judgePhase.lose.textColor = {255, 255, 255, 255};
-        battleConfig.judgePhase.lose.backgroundColor = {255, 0, 0, 255};
-        battleConfig.judgePhase.draw.text = "引き分け";
-        battleConfig.judgePhase.draw.textColor = {255, 255, 255, 255};
-        battleConfig.judgePhase.draw.backgroundColor = {200, 200, 200, 255};
-        battleConfig.judgePhase.baseWidth = 200;
-        battleConfig.judgePhase.baseHeight = 60;
-        battleConfig.judgePhase.backgroundPadding = 20;
-        battleConfig.judgePhase.glowColor = {255, 215, 0, 255};
+        config.battleConfig.judgePhase.position.useRelative = true;  // デフォルトは相対位置（画面中央）
+        config.battleConfig.judgePhase.position.offsetX = 0.0f;
+        config.battleConfig.judgePhase.position.offsetY = 0.0f;
+        config.battleConfig.judgePhase.win.text = "勝ち！";
+        config.battleConfig.judgePhase.win.textColor = {255, 255, 255, 255};
+        config.battleConfig.judgePhase.win.backgroundColor = {255, 215, 0, 255};
+        config.battleConfig.judgePhase.lose.text = "負け...";
+        config.battleConfig.judgePhase.lose.textColor = {255, 255, 255, 255};
+        config.battleConfig.judgePhase.lose.backgroundColor = {255, 0, 0, 255};
+        config.battleConfig.judgePhase.draw.text = "引き分け";
+        config.battleConfig.judgePhase.draw.textColor = {255, 255, 255, 255};
+        config.battleConfig.judgePhase.draw.backgroundColor = {200, 200, 200, 255};
+        config.battleConfig.judgePhase.baseWidth = 200;
+        config.battleConfig.judgePhase.baseHeight = 60;
+        config.battleConfig.judgePhase.backgroundPadding = 20;
+        config.battleConfig.judgePhase.glowColor = {255, 215, 0, 255};
         
         // 勝利表示UI設定
-        battleConfig.victoryDisplay.position.useRelative = true;
-        battleConfig.victoryDisplay.position.offsetX = 0.0f;
-        battleConfig.victoryDisplay.position.offsetY = -100.0f;
-        battleConfig.victoryDisplay.textColor = {255, 255, 255, 255};
-        battleConfig.victoryDisplay.backgroundColor = {0, 0, 0, 200};
-        battleConfig.victoryDisplay.borderColor = {255, 255, 255, 255};
-        battleConfig.victoryDisplay.padding = 12;
-        battleConfig.victoryDisplay.format = "{enemyName}を倒した。経験値が{expGained}";
+        config.battleConfig.victoryDisplay.position.useRelative = true;
+        config.battleConfig.victoryDisplay.position.offsetX = 0.0f;
+        config.battleConfig.victoryDisplay.position.offsetY = -100.0f;
+        config.battleConfig.victoryDisplay.textColor = {255, 255, 255, 255};
+        config.battleConfig.victoryDisplay.backgroundColor = {0, 0, 0, 200};
+        config.battleConfig.victoryDisplay.borderColor = {255, 255, 255, 255};
+        config.battleConfig.victoryDisplay.padding = 12;
+        config.battleConfig.victoryDisplay.format = "{enemyName}を倒した。経験値が{expGained}";
         
         // レベルアップ表示UI設定
-        battleConfig.levelUpDisplay.position.useRelative = true;
-        battleConfig.levelUpDisplay.position.offsetX = 0.0f;
-        battleConfig.levelUpDisplay.position.offsetY = -100.0f;
-        battleConfig.levelUpDisplay.textColor = {255, 255, 255, 255};
-        battleConfig.levelUpDisplay.backgroundColor = {0, 0, 0, 200};
-        battleConfig.levelUpDisplay.borderColor = {255, 255, 255, 255};
-        battleConfig.levelUpDisplay.padding = 12;
-        battleConfig.levelUpDisplay.singleLevelFormat = "レベルアップ！\n{playerName}はレベル{newLevel}になった！\nHP+{hpGain} MP+{mpGain} 攻撃力+{attackGain} 防御力+{defenseGain}";
-        battleConfig.levelUpDisplay.multiLevelFormat = "レベルアップ！\n{playerName}はレベル{oldLevel}からレベル{newLevel}になった！\nHP+{hpGain} MP+{mpGain} 攻撃力+{attackGain} 防御力+{defenseGain}";
+        config.battleConfig.levelUpDisplay.position.useRelative = true;
+        config.battleConfig.levelUpDisplay.position.offsetX = 0.0f;
+        config.battleConfig.levelUpDisplay.position.offsetY = -100.0f;
+        config.battleConfig.levelUpDisplay.textColor = {255, 255, 255, 255};
+        config.battleConfig.levelUpDisplay.backgroundColor = {0, 0, 0, 200};
+        config.battleConfig.levelUpDisplay.borderColor = {255, 255, 255, 255};
+        config.battleConfig.levelUpDisplay.padding = 12;
+        config.battleConfig.levelUpDisplay.singleLevelFormat = "レベルアップ！\n{playerName}はレベル{newLevel}になった！\nHP+{hpGain} MP+{mpGain} 攻撃力+{attackGain} 防御力+{defenseGain}";
+        config.battleConfig.levelUpDisplay.multiLevelFormat = "レベルアップ！\n{playerName}はレベル{oldLevel}からレベル{newLevel}になった！\nHP+{hpGain} MP+{mpGain} 攻撃力+{attackGain} 防御力+{defenseGain}";
         
         // ステータス上昇呪文の攻撃倍率表示UI設定
-        battleConfig.attackMultiplier.position.useRelative = false;
-        battleConfig.attackMultiplier.position.absoluteX = 0.0f;  // プレイヤーHPバーのXからの相対位置として使用
-        battleConfig.attackMultiplier.position.absoluteY = 0.0f;  // プレイヤーHPバーのYからの相対位置として使用
-        battleConfig.attackMultiplier.offsetX = -100.0f;
-        battleConfig.attackMultiplier.offsetY = 0.0f;
-        battleConfig.attackMultiplier.textColor = {255, 255, 100, 255};
-        battleConfig.attackMultiplier.bgColor = {0, 0, 0, 255};
-        battleConfig.attackMultiplier.borderColor = {255, 255, 100, 255};
-        battleConfig.attackMultiplier.padding = 8;
-        battleConfig.attackMultiplier.format = "攻撃倍率: {multiplier}倍 (残り{turns}ターン)";
+        config.battleConfig.attackMultiplier.position.useRelative = false;
+        config.battleConfig.attackMultiplier.position.absoluteX = 0.0f;  // プレイヤーHPバーのXからの相対位置として使用
+        config.battleConfig.attackMultiplier.position.absoluteY = 0.0f;  // プレイヤーHPバーのYからの相対位置として使用
+        config.battleConfig.attackMultiplier.offsetX = -100.0f;
+        config.battleConfig.attackMultiplier.offsetY = 0.0f;
+        config.battleConfig.attackMultiplier.textColor = {255, 255, 100, 255};
+        config.battleConfig.attackMultiplier.bgColor = {0, 0, 0, 255};
+        config.battleConfig.attackMultiplier.borderColor = {255, 255, 100, 255};
+        config.battleConfig.attackMultiplier.padding = 8;
+        config.battleConfig.attackMultiplier.format = "攻撃倍率: {multiplier}倍 (残り{turns}ターン)";
         
         // RoomState
-        roomConfig.messageBoard.background.position.useRelative = false;
-        roomConfig.messageBoard.background.position.absoluteX = 190.0f;
-        roomConfig.messageBoard.background.position.absoluteY = 480.0f;
-        roomConfig.messageBoard.background.width = 720;
-        roomConfig.messageBoard.background.height = 100;
-        
-        roomConfig.messageBoard.text.position.useRelative = false;
-        roomConfig.messageBoard.text.position.absoluteX = 210.0f;
-        roomConfig.messageBoard.text.position.absoluteY = 500.0f;
-        roomConfig.messageBoard.text.color = {255, 255, 255, 255};
-        
-        roomConfig.howToOperateBackground.position.useRelative = false;
-        roomConfig.howToOperateBackground.position.absoluteX = 190.0f;
-        roomConfig.howToOperateBackground.position.absoluteY = 10.0f;
-        roomConfig.howToOperateBackground.width = 395;
-        roomConfig.howToOperateBackground.height = 70;
-        
-        roomConfig.howToOperateText.position.useRelative = false;
-        roomConfig.howToOperateText.position.absoluteX = 205.0f;
-        roomConfig.howToOperateText.position.absoluteY = 25.0f;
-        roomConfig.howToOperateText.color = {255, 255, 255, 255};
+        config.roomConfig.messageBoard.background.position.useRelative = false;
+        config.roomConfig.messageBoard.background.position.absoluteX = 190.0f;
+        config.roomConfig.messageBoard.background.position.absoluteY = 480.0f;
+        config.roomConfig.messageBoard.background.width = 720;
+        config.roomConfig.messageBoard.background.height = 100;
+        
+        config.roomConfig.messageBoard.text.position.useRelative = false;
+        config.roomConfig.messageBoard.text.position.absoluteX = 210.0f;
+        config.roomConfig.messageBoard.text.position.absoluteY = 500.0f;
+        config.roomConfig.messageBoard.text.color = {255, 255, 255, 255};
+        
+        config.roomConfig.howToOperateBackground.position.useRelative = false;
+        config.roomConfig.howToOperateBackground.position.absoluteX = 190.0f;
+        config.roomConfig.howToOperateBackground.position.absoluteY = 10.0f;
+        config.roomConfig.howToOperateBackground.width = 395;
+        config.roomConfig.howToOperateBackground.height = 70;
+        
+        config.roomConfig.howToOperateText.position.useRelative = false;
+        config.roomConfig.howToOperateText.position.absoluteX = 205.0f;
+        config.roomConfig.howToOperateText.position.absoluteY = 25.0f;
+        config.roomConfig.howToOperateText.color = {255, 255, 255, 255};
         
         // TownState
-        townConfig.playerInfo.position.useRelative = false;
-        townConfig.playerInfo.position.absoluteX = 10.0f;
-        townConfig.playerInfo.position.absoluteY = 10.0f;
-        townConfig.playerInfo.color = {255, 255, 255, 255};
+        config.townConfig.playerInfo.position.useRelative = false;
+        config.townConfig.playerInfo.position.absoluteX = 10.0f;
+        config.townConfig.playerInfo.position.absoluteY = 10.0f;
+        config.townConfig.playerInfo.color = {255, 255, 255, 255};
         
-        townConfig.controls.position.useRelative = false;
-        townConfig.controls.position.absoluteX = 10.0f;
-        townConfig.controls.position.absoluteY = 550.0f;
-        townConfig.controls.color = {255, 255, 255, 255};
+        config.townConfig.controls.position.useRelative = false;
+        config.townConfig.controls.position.absoluteX = 10.0f;
+        config.townConfig.controls.position.absoluteY = 550.0f;
+        config.townConfig.controls.color = {255, 255, 255, 255};
         
         // CastleState
-        castleConfig.messageBoard.background.position.useRelative = false;
-        castleConfig.messageBoard.background.position.absoluteX = 190.0f;
-        castleConfig.messageBoard.background.position.absoluteY = 480.0f;
-        castleConfig.messageBoard.background.width = 720;
-        castleConfig.messageBoard.background.height = 100;
+        config.castleConfig.messageBoard.background.position.useRelative = false;
+        config.castleConfig.messageBoard.background.position.absoluteX = 190.0f;
+        config.castleConfig.messageBoard.background.position.absoluteY = 480.0f;
+        config.castleConfig.messageBoard.background.width = 720;
+        config.castleConfig.messageBoard.background.height = 100;
         
-        castleConfig.messageBoard.text.position.useRelative = false;
-        castleConfig.messageBoard.text.position.absoluteX = 210.0f;
-        castleConfig.messageBoard.text.position.absoluteY = 500.0f;
-        castleConfig.messageBoard.text.color = {255, 255, 255, 255};
+        config.castleConfig.messageBoard.text.position.useRelative = false;
+        config.castleConfig.messageBoard.text.position.absoluteX = 210.0f;
+        config.castleConfig.messageBoard.text.position.absoluteY = 500.0f;
+        config.castleConfig.messageBoard.text.color = {255, 255, 255, 255};
         
         // DemonCastleState
-        demonCastleConfig.messageBoard.background.position.useRelative = false;
-        demonCastleConfig.messageBoard.background.position.absoluteX = 190.0f;
-        demonCastleConfig.messageBoard.background.position.absoluteY = 480.0f;
-        demonCastleConfig.messageBoard.background.width = 720;
-        demonCastleConfig.messageBoard.background.height = 100;
+        config.demonCastleConfig.messageBoard.background.position.useRelative = false;
+        config.demonCastleConfig.messageBoard.background.position.absoluteX = 190.0f;
+        config.demonCastleConfig.messageBoard.background.position.absoluteY = 480.0f;
+        config.demonCastleConfig.messageBoard.background.width = 720;
+        config.demonCastleConfig.messageBoard.background.height = 100;
         
-        demonCastleConfig.messageBoard.text.position.useRelative = false;
-        demonCastleConfig.messageBoard.text.position.absoluteX = 210.0f;
-        demonCastleConfig.messageBoard.text.position.absoluteY = 500.0f;
-        demonCastleConfig.messageBoard.text.color = {255, 255, 255, 255};
+        config.demonCastleConfig.messageBoard.text.position.useRelative = false;
+        config.demonCastleConfig.messageBoard.text.position.absoluteX = 210.0f;
+        config.demonCastleConfig.messageBoard.text.position.absoluteY = 500.0f;
+        config.demonCastleConfig.messageBoard.text.color = {255, 255, 255, 255};
         
         // GameOverState
-        gameOverConfig.title.text.position.useRelative = false;
-        gameOverConfig.title.text.position.absoluteX = 550.0f;
-        gameOverConfig.title.text.position.absoluteY = 200.0f;
-        gameOverConfig.title.text.color = {255, 0, 0, 255};
-        
-        gameOverConfig.reason.text.position.useRelative = false;
-        gameOverConfig.reason.text.position.absoluteX = 550.0f;
-        gameOverConfig.reason.text.position.absoluteY = 250.0f;
-        gameOverConfig.reason.text.color = {255, 255, 255, 255};
-        
-        gameOverConfig.instruction.text.position.useRelative = false;
-        gameOverConfig.instruction.text.position.absoluteX = 550.0f;
-        gameOverConfig.instruction.text.position.absoluteY = 400.0f;
-        gameOverConfig.instruction.text.color = {200, 200, 200, 255};
-        
-        gameOverConfig.retry.text.position.useRelative = false;
-        gameOverConfig.retry.text.position.absoluteX = 550.0f;
-        gameOverConfig.retry.text.position.absoluteY = 450.0f;
-        gameOverConfig.retry.text.color = {255, 255, 255, 255};
-        
-        gameOverConfig.extendTime.text.position.useRelative = false;
-        gameOverConfig.extendTime.text.position.absoluteX = 550.0f;
-        gameOverConfig.extendTime.text.position.absoluteY = 514.0f;
-        gameOverConfig.extendTime.text.color = {255, 255, 255, 255};
+        config.gameOverConfig.title.text.position.useRelative = false;
+        config.gameOverConfig.title.text.position.absoluteX = 550.0f;
+        config.gameOverConfig.title.text.position.absoluteY = 200.0f;
+        config.gameOverConfig.title.text.color = {255, 0, 0, 255};
+        
+        config.gameOverConfig.reason.text.position.useRelative = false;
+        config.gameOverConfig.reason.text.position.absoluteX = 550.0f;
+        config.gameOverConfig.reason.text.position.absoluteY = 250.0f;
+        config.gameOverConfig.reason.text.color = {255, 255, 255, 255};
+        
+        config.gameOverConfig.instruction.text.position.useRelative = false;
+        config.gameOverConfig.instruction.text.position.absoluteX = 550.0f;
+        config.gameOverConfig.instruction.text.position.absoluteY = 400.0f;
+        config.gameOverConfig.instruction.text.color = {200, 200, 200, 255};
+        
+        config.gameOverConfig.retry.text.position.useRelative = false;
+        config.gameOverConfig.retry.text.position.absoluteX = 550.0f;
+        config.gameOverConfig.retry.text.position.absoluteY = 450.0f;
+        config.gameOverConfig.retry.text.color = {255, 255, 255, 255};
+        
+        config.gameOverConfig.extendTime.text.position.useRelative = false;
+        config.gameOverConfig.extendTime.text.position.absoluteX = 550.0f;
+        config.gameOverConfig.extendTime.text.position.absoluteY = 514.0f;
+        config.gameOverConfig.extendTime.text.color = {255, 255, 255, 255};
         
         // EndingState
-        endingConfig.message.position.useRelative = false;
-        endingConfig.message.position.absoluteX = 450.0f;
-        endingConfig.message.position.absoluteY = 325.0f;
-        endingConfig.message.color = {255, 255, 255, 255};
-        
-        endingConfig.staffRoll.position.useRelative = false;
-        endingConfig.staffRoll.position.absoluteX = 450.0f;
-        endingConfig.staffRoll.position.absoluteY = 325.0f;
-        endingConfig.staffRoll.color = {255, 255, 255, 255};
-        
-        endingConfig.theEnd.position.useRelative = false;
-        endingConfig.theEnd.position.absoluteX = 550.0f;
-        endingConfig.theEnd.position.absoluteY = 300.0f;
-        endingConfig.theEnd.color = {255, 255, 255, 255};
-        
-        endingConfig.returnToMenu.position.useRelative = false;
-        endingConfig.returnToMenu.position.absoluteX = 550.0f;
-        endingConfig.returnToMenu.position.absoluteY = 350.0f;
-        endingConfig.returnToMenu.color = {200, 200, 200, 255};
+        config.endingConfig.message.position.useRelative = false;
+        config.endingConfig.message.position.absoluteX = 450.0f;
+        config.endingConfig.message.position.absoluteY = 325.0f;
+        config.endingConfig.message.color = {255, 255, 255, 255};
+        
+        config.endingConfig.staffRoll.position.useRelative = false;
+        config.endingConfig.staffRoll.position.absoluteX = 450.0f;
+        config.endingConfig.staffRoll.position.absoluteY = 325.0f;
+        config.endingConfig.staffRoll.color = {255, 255, 255, 255};
+        
+        config.endingConfig.theEnd.position.useRelative = false;
+        config.endingConfig.theEnd.position.absoluteX = 550.0f;
+        config.endingConfig.theEnd.position.absoluteY = 300.0f;
+        config.endingConfig.theEnd.color = {255, 255, 255, 255};
+        
+        config.endingConfig.returnToMenu.position.useRelative = false;
+        config.endingConfig.returnToMenu.position.absoluteX = 550.0f;
+        config.endingConfig.returnToMenu.position.absoluteY = 350.0f;
+        config.endingConfig.returnToMenu.color = {200, 200, 200, 255};
         
         // NightState
-        nightConfig.nightDisplayBackground.position.useRelative = false;
-        nightConfig.nightDisplayBackground.position.absoluteX = 10.0f;
-        nightConfig.nightDisplayBackground.position.absoluteY = 5.0f;
-        nightConfig.nightDisplayBackground.width = 65;
-        nightConfig.nightDisplayBackground.height = 40;
-        
-        nightConfig.nightDisplayText.position.useRelative = false;
-        nightConfig.nightDisplayText.position.absoluteX = 20.0f;
-        nightConfig.nightDisplayText.position.absoluteY = 15.0f;
-        nightConfig.nightDisplayText.color = {255, 255, 255, 255};
-        
-        nightConfig.nightOperationBackground.position.useRelative = false;
-        nightConfig.nightOperationBackground.position.absoluteX = 85.0f;
-        nightConfig.nightOperationBackground.position.absoluteY = 5.0f;
-        nightConfig.nightOperationBackground.width = 205;
-        nightConfig.nightOperationBackground.height = 40;
-        
-        nightConfig.nightOperationText.position.useRelative = false;
-        nightConfig.nightOperationText.position.absoluteX = 95.0f;
-        nightConfig.nightOperationText.position.absoluteY = 15.0f;
-        nightConfig.nightOperationText.color = {255, 255, 255, 255};
-        
-        nightConfig.messageBoard.background.position.useRelative = false;
-        nightConfig.messageBoard.background.position.absoluteX = 190.0f;
-        nightConfig.messageBoard.background.position.absoluteY = 480.0f;
-        nightConfig.messageBoard.background.width = 720;
-        nightConfig.messageBoard.background.height = 100;
-        
-        nightConfig.messageBoard.text.position.useRelative = false;
-        nightConfig.messageBoard.text.position.absoluteX = 210.0f;
-        nightConfig.messageBoard.text.position.absoluteY = 500.0f;
-        nightConfig.messageBoard.text.color = {255, 255, 255, 255};
+        config.nightConfig.nightDisplayBackground.position.useRelative = false;
+        config.nightConfig.nightDisplayBackground.position.absoluteX = 10.0f;
+        config.nightConfig.nightDisplayBackground.position.absoluteY = 5.0f;
+        config.nightConfig.nightDisplayBackground.width = 65;
+        config.nightConfig.nightDisplayBackground.height = 40;
+        
+        config.nightConfig.nightDisplayText.position.useRelative = false;
+        config.nightConfig.nightDisplayText.position.absoluteX = 20.0f;
+        config.nightConfig.nightDisplayText.position.absoluteY = 15.0f;
+        config.nightConfig.nightDisplayText.color = {255, 255, 255, 255};
+        
+        config.nightConfig.nightOperationBackground.position.useRelative = false;
+        config.nightConfig.nightOperationBackground.position.absoluteX = 85.0f;
+        config.nightConfig.nightOperationBackground.position.absoluteY = 5.0f;
+        config.nightConfig.nightOperationBackground.width = 205;
+        config.nightConfig.nightOperationBackground.height = 40;
+        
+        config.nightConfig.nightOperationText.position.useRelative = false;
+        config.nightConfig.nightOperationText.position.absoluteX = 95.0f;
+        config.nightConfig.nightOperationText.position.absoluteY = 15.0f;
+        config.nightConfig.nightOperationText.color = {255, 255, 255, 255};
+        
+        config.nightConfig.messageBoard.background.position.useRelative = false;
+        config.nightConfig.messageBoard.background.position.absoluteX = 190.0f;
+        config.nightConfig.messageBoard.background.position.absoluteY = 480.0f;
+        config.nightConfig.messageBoard.background.width = 720;
+        config.nightConfig.messageBoard.background.height = 100;
+        
+        config.nightConfig.messageBoard.text.position.useRelative = false;
+        config.nightConfig.messageBoard.text.position.absoluteX = 210.0f;
+        config.nightConfig.messageBoard.text.position.absoluteY = 500.0f;
+        config.nightConfig.messageBoard.text.color = {255, 255, 255, 255};
         
         // FieldState
-        fieldConfig.monsterLevel.position.useRelative = false;
-        fieldConfig.monsterLevel.position.absoluteX = 0.0f;  // 相対位置で計算される
-        fieldConfig.monsterLevel.position.absoluteY = -10.0f;  // 相対位置で計算される
-        fieldConfig.monsterLevel.color = {255, 255, 255, 255};
+        config.fieldConfig.monsterLevel.position.useRelative = false;
+        config.fieldConfig.monsterLevel.position.absoluteX = 0.0f;  // 相対位置で計算される
+        config.fieldConfig.monsterLevel.position.absoluteY = -10.0f;  // 相対位置で計算される
+        config.fieldConfig.monsterLevel.color = {255, 255, 255, 255};
     }
     
     bool UIConfigManager::loadConfig(const std::string& filepath) {
-        setDefaultValues();  // デフォルト値を設定
+        TRACE_SCOPE("UIConfigManager::loadConfig");
+        // 失敗した場合は現在の設定（起動直後はデフォルト値）のまま
+        std::string foundPath = findConfigFile(filepath);
+        if (foundPath.empty()) {
+            configLoaded = false;
+            return false;
+        }
+        std::string cachePath = foundPath + CACHE_SUFFIX;
+        
+        // 更新時刻は読み込む前に取得する（読み込み中に保存された場合に、古い内容を新しい時刻で記録しないため）
+        uint64_t sourceSize = 0;
+        int64_t sourceMtime = 0;
+        getFileStamp(foundPath, sourceSize, sourceMtime);
+        
+        std::shared_ptr<UIConfigSnapshot> next = std::make_shared<UIConfigSnapshot>();
+        std::array<bool, SECTION_COUNT> changed;
+        changed.fill(true);
+        
+        // サイズと更新時刻が記録と同じなら、JSONを読まずにキャッシュを使う
+        bool fromCache = readConfigCache(cachePath, sourceSize, sourceMtime, nullptr, *next);
+        if (!fromCache) {
+            std::string text;
+            if (!readFileBytes(foundPath, text)) {
+                printf("UI Config: Failed to reopen file: %s\n", foundPath.c_str());
+                configLoaded = false;
+                return false;
+            }
+            uint64_t sourceHash = hashBytes(text.data(), text.size());
+            
+            // 更新時刻だけが変わった場合（チェックアウトし直した場合など）は内容のハッシュで確認する
+            fromCache = readConfigCache(cachePath, sourceSize, sourceMtime, &sourceHash, *next);
+            if (!fromCache) {
+                nlohmann::json document;
+                try {
+                    document = nlohmann::json::parse(text);
+                } catch (const std::exception& e) {
+                    printf("UI Config: Error loading config: %s\n", e.what());
+                    configLoaded = false;
+                    return false;
+                }
+                if (!buildSnapshot(document, snapshot.get(), *next, changed)) {
+                    configLoaded = false;
+                    return false;
+                }
+            }
+            writeConfigCache(cachePath, sourceSize, sourceMtime, sourceHash, *next);
+        }
         
+        configFilePath = foundPath;
+        configLoaded = true;
+        publishSnapshot(next, changed);
+        printf("UI Config: Loaded successfully from %s%s\n", foundPath.c_str(), fromCache ? " (cache)" : "");
+        return true;
+    }
+    
+    std::string UIConfigManager::findConfigFile(const std::string& filepath) {
         std::vector<std::string> candidatePaths;
         candidatePaths.push_back(filepath);
         
@@ -489,8 +1186,6 @@ namespace UIConfig {
         }
         
         std::ifstream file;
-        bool fileFound = false;
-        std::string foundPath;
         for (const auto& path : candidatePaths) {
             file.open(path);
             if (file.is_open()) {
@@ -500,10 +1195,7 @@ namespace UIConfig {
                 file.seekg(0, std::ios::beg);
                 
                 if (fileSize > 0) {
-                    configFilePath = path;
-                    foundPath = path;
-                    fileFound = true;
-                    break;
+                    return path;
                 } else {
                     file.close();
                     printf("UI Config: File is empty: %s\n", path.c_str());
@@ -511,1280 +1203,196 @@ namespace UIConfig {
             }
         }
         
-        if (!fileFound) {
-            printf("UI Config: File not found or empty, using default values: %s\n", filepath.c_str());
-            configLoaded = false;
+        printf("UI Config: File not found or empty, using default values: %s\n", filepath.c_str());
+        return "";
+    }
+    
+    bool UIConfigManager::readConfigDocument(const std::string& filepath, nlohmann::json& document, std::string& foundPath) {
+        foundPath = findConfigFile(filepath);
+        if (foundPath.empty()) {
             return false;
         }
-        
-        // ファイルを再度開く（seekgで位置が変わっているため）
-        file.close();
-        file.open(foundPath);
-        
-        if (!file.is_open()) {
+        std::string text;
+        if (!readFileBytes(foundPath, text)) {
             printf("UI Config: Failed to reopen file: %s\n", foundPath.c_str());
-            configLoaded = false;
             return false;
         }
+        try {
+            document = nlohmann::json::parse(text);
+        } catch (const std::exception& e) {
+            printf("UI Config: Error loading config: %s\n", e.what());
+            return false;
+        }
+        return true;
+    }
+    
+    bool UIConfigManager::buildSnapshot(const nlohmann::json& document, const UIConfigSnapshot* base, UIConfigSnapshot& config,
+                                        std::array<bool, SECTION_COUNT>& changed) {
+        const UIConfigSnapshot& defaults = getDefaultSnapshot();
         
         try {
-            nlohmann::json jsonData;
-            file >> jsonData;
-            file.close();
-            
-            // メッセージボード設定
-            if (jsonData.contains("messageBoard")) {
-                auto& mb = jsonData["messageBoard"];
-                
-                // 背景
-                if (mb.contains("background")) {
-                    auto& bg = mb["background"];
-                    if (bg.contains("position")) {
-                        auto& pos = bg["position"];
-                        if (pos.contains("absoluteX")) messageBoardConfig.background.position.absoluteX = pos["absoluteX"];
-                        if (pos.contains("absoluteY")) messageBoardConfig.background.position.absoluteY = pos["absoluteY"];
-                        if (pos.contains("offsetX")) messageBoardConfig.background.position.offsetX = pos["offsetX"];
-                        if (pos.contains("offsetY")) messageBoardConfig.background.position.offsetY = pos["offsetY"];
-                        if (pos.contains("useRelative")) messageBoardConfig.background.position.useRelative = pos["useRelative"];
-                    }
-                    if (bg.contains("width")) messageBoardConfig.background.width = bg["width"];
-                    if (bg.contains("height")) messageBoardConfig.background.height = bg["height"];
-                }
-                
-                // テキスト
-                if (mb.contains("text")) {
-                    auto& txt = mb["text"];
-                    if (txt.contains("position")) {
-                        auto& pos = txt["position"];
-                        if (pos.contains("absoluteX")) messageBoardConfig.text.position.absoluteX = pos["absoluteX"];
-                        if (pos.contains("absoluteY")) messageBoardConfig.text.position.absoluteY = pos["absoluteY"];
-                        if (pos.contains("offsetX")) messageBoardConfig.text.position.offsetX = pos["offsetX"];
-                        if (pos.contains("offsetY")) messageBoardConfig.text.position.offsetY = pos["offsetY"];
-                        if (pos.contains("useRelative")) messageBoardConfig.text.position.useRelative = pos["useRelative"];
-                    }
-                    if (txt.contains("color")) {
-                        auto& col = txt["color"];
-                        if (col.is_array() && col.size() >= 4) {
-                            messageBoardConfig.text.color = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                static_cast<Uint8>(col[3])
-                            };
-                        } else if (col.is_array() && col.size() >= 3) {
-                            messageBoardConfig.text.color = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                255
-                            };
-                        }
-                    }
-                }
-                // メッセージボードの背景色とボーダー色
-                if (mb.contains("backgroundColor")) {
-                    auto& col = mb["backgroundColor"];
-                    if (col.is_array() && col.size() >= 4) {
-                        messageBoardConfig.backgroundColor = {
-                            static_cast<Uint8>(col[0]),
-                            static_cast<Uint8>(col[1]),
-                            static_cast<Uint8>(col[2]),
-                            static_cast<Uint8>(col[3])
-                        };
-                    } else if (col.is_array() && col.size() >= 3) {
-                        messageBoardConfig.backgroundColor = {
-                            static_cast<Uint8>(col[0]),
-                            static_cast<Uint8>(col[1]),
-                            static_cast<Uint8>(col[2]),
-                            255
-                        };
-                    }
-                }
-                if (mb.contains("borderColor")) {
-                    auto& col = mb["borderColor"];
-                    if (col.is_array() && col.size() >= 4) {
-                        messageBoardConfig.borderColor = {
-                            static_cast<Uint8>(col[0]),
-                            static_cast<Uint8>(col[1]),
-                            static_cast<Uint8>(col[2]),
-                            static_cast<Uint8>(col[3])
-                        };
-                    } else if (col.is_array() && col.size() >= 3) {
-                        messageBoardConfig.borderColor = {
-                            static_cast<Uint8>(col[0]),
-                            static_cast<Uint8>(col[1]),
-                            static_cast<Uint8>(col[2]),
-                            255
-                        };
-                    }
-                }
-            }
-            
-            // CommonUI設定
-            if (jsonData.contains("commonUI")) {
-                auto& cui = jsonData["commonUI"];
-                
-                if (cui.contains("nightTimer")) {
-                    auto& nt = cui["nightTimer"];
-                    if (nt.contains("position")) {
-                        auto& pos = nt["position"];
-                        if (pos.contains("absoluteX")) commonUIConfig.nightTimer.position.absoluteX = pos["absoluteX"];
-                        if (pos.contains("absoluteY")) commonUIConfig.nightTimer.position.absoluteY = pos["absoluteY"];
-                        if (pos.contains("offsetX")) commonUIConfig.nightTimer.position.offsetX = pos["offsetX"];
-                        if (pos.contains("offsetY")) commonUIConfig.nightTimer.position.offsetY = pos["offsetY"];
-                        if (pos.contains("useRelative")) commonUIConfig.nightTimer.position.useRelative = pos["useRelative"];
-                    }
-                    if (nt.contains("width")) commonUIConfig.nightTimer.width = nt["width"];
-                    if (nt.contains("height")) commonUIConfig.nightTimer.height = nt["height"];
-                }
-                
-                if (cui.contains("nightTimerText")) {
-                    auto& ntt = cui["nightTimerText"];
-                    if (ntt.contains("position")) {
-                        auto& pos = ntt["position"];
-                        if (pos.contains("absoluteX")) commonUIConfig.nightTimerText.position.absoluteX = pos["absoluteX"];
-                        if (pos.contains("absoluteY")) commonUIConfig.nightTimerText.position.absoluteY = pos["absoluteY"];
-                        if (pos.contains("offsetX")) commonUIConfig.nightTimerText.position.offsetX = pos["offsetX"];
-                        if (pos.contains("offsetY")) commonUIConfig.nightTimerText.position.offsetY = pos["offsetY"];
-                        if (pos.contains("useRelative")) commonUIConfig.nightTimerText.position.useRelative = pos["useRelative"];
-                    }
-                    if (ntt.contains("color")) {
-                        auto& col = ntt["color"];
-                        if (col.is_array() && col.size() >= 4) {
-                            commonUIConfig.nightTimerText.color = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                static_cast<Uint8>(col[3])
-                            };
-                        } else if (col.is_array() && col.size() >= 3) {
-                            commonUIConfig.nightTimerText.color = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                255
-                            };
-                        }
-                    }
-                }
-                
-                // 目標レベル
-                if (cui.contains("targetLevel")) {
-                    auto& tl = cui["targetLevel"];
-                    if (tl.contains("position")) {
-                        auto& pos = tl["position"];
-                        if (pos.contains("absoluteX")) commonUIConfig.targetLevel.position.absoluteX = pos["absoluteX"];
-                        if (pos.contains("absoluteY")) commonUIConfig.targetLevel.position.absoluteY = pos["absoluteY"];
-                        if (pos.contains("offsetX")) commonUIConfig.targetLevel.position.offsetX = pos["offsetX"];
-                        if (pos.contains("offsetY")) commonUIConfig.targetLevel.position.offsetY = pos["offsetY"];
-                        if (pos.contains("useRelative")) commonUIConfig.targetLevel.position.useRelative = pos["useRelative"];
-                    }
-                    if (tl.contains("width")) commonUIConfig.targetLevel.width = tl["width"];
-                    if (tl.contains("height")) commonUIConfig.targetLevel.height = tl["height"];
-                }
-                
-                if (cui.contains("targetLevelText")) {
-                    auto& tlt = cui["targetLevelText"];
-                    if (tlt.contains("position")) {
-                        auto& pos = tlt["position"];
-                        if (pos.contains("absoluteX")) commonUIConfig.targetLevelText.position.absoluteX = pos["absoluteX"];
-                        if (pos.contains("absoluteY")) commonUIConfig.targetLevelText.position.absoluteY = pos["absoluteY"];
-                        if (pos.contains("offsetX")) commonUIConfig.targetLevelText.position.offsetX = pos["offsetX"];
-                        if (pos.contains("offsetY")) commonUIConfig.targetLevelText.position.offsetY = pos["offsetY"];
-                        if (pos.contains("useRelative")) commonUIConfig.targetLevelText.position.useRelative = pos["useRelative"];
-                    }
-                    if (tlt.contains("color")) {
-                        auto& col = tlt["color"];
-                        if (col.is_array() && col.size() >= 4) {
-                            commonUIConfig.targetLevelText.color = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                static_cast<Uint8>(col[3])
-                            };
-                        } else if (col.is_array() && col.size() >= 3) {
-                            commonUIConfig.targetLevelText.color = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                255
-                            };
-                        }
-                    }
-                }
-                
-                if (cui.contains("trustLevels")) {
-                    auto& tr = cui["trustLevels"];
-                    if (tr.contains("position")) {
-                        auto& pos = tr["position"];
-                        if (pos.contains("absoluteX")) commonUIConfig.trustLevels.position.absoluteX = pos["absoluteX"];
-                        if (pos.contains("absoluteY")) commonUIConfig.trustLevels.position.absoluteY = pos["absoluteY"];
-                        if (pos.contains("offsetX")) commonUIConfig.trustLevels.position.offsetX = pos["offsetX"];
-                        if (pos.contains("offsetY")) commonUIConfig.trustLevels.position.offsetY = pos["offsetY"];
-                        if (pos.contains("useRelative")) commonUIConfig.trustLevels.position.useRelative = pos["useRelative"];
-                    }
-                    if (tr.contains("width")) commonUIConfig.trustLevels.width = tr["width"];
-                    if (tr.contains("height")) commonUIConfig.trustLevels.height = tr["height"];
-                }
-                
-                if (cui.contains("trustLevelsText")) {
-                    auto& trt = cui["trustLevelsText"];
-                    if (trt.contains("position")) {
-                        auto& pos = trt["position"];
-                        if (pos.contains("absoluteX")) commonUIConfig.trustLevelsText.position.absoluteX = pos["absoluteX"];
-                        if (pos.contains("absoluteY")) commonUIConfig.trustLevelsText.position.absoluteY = pos["absoluteY"];
-                        if (pos.contains("offsetX")) commonUIConfig.trustLevelsText.position.offsetX = pos["offsetX"];
-                        if (pos.contains("offsetY")) commonUIConfig.trustLevelsText.position.offsetY = pos["offsetY"];
-                        if (pos.contains("useRelative")) commonUIConfig.trustLevelsText.position.useRelative = pos["useRelative"];
-                    }
-                    if (trt.contains("color")) {
-                        auto& col = trt["color"];
-                        if (col.is_array() && col.size() >= 4) {
-                            commonUIConfig.trustLevelsText.color = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                static_cast<Uint8>(col[3])
-                            };
-                        } else if (col.is_array() && col.size() >= 3) {
-                            commonUIConfig.trustLevelsText.color = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                255
-                            };
-                        }
-                    }
-                }
-                
-                // ゲームコントローラー状態
-                if (cui.contains("gameControllerStatus")) {
-                    auto& gcs = cui["gameControllerStatus"];
-                    if (gcs.contains("position")) {
-                        auto& pos = gcs["position"];
-                        if (pos.contains("absoluteX")) commonUIConfig.gameControllerStatus.position.absoluteX = pos["absoluteX"];
-                        if (pos.contains("absoluteY")) commonUIConfig.gameControllerStatus.position.absoluteY = pos["absoluteY"];
-                        if (pos.contains("offsetX")) commonUIConfig.gameControllerStatus.position.offsetX = pos["offsetX"];
-                        if (pos.contains("offsetY")) commonUIConfig.gameControllerStatus.position.offsetY = pos["offsetY"];
-                        if (pos.contains("useRelative")) commonUIConfig.gameControllerStatus.position.useRelative = pos["useRelative"];
-                    }
-                    if (gcs.contains("width")) commonUIConfig.gameControllerStatus.width = gcs["width"];
-                    if (gcs.contains("height")) commonUIConfig.gameControllerStatus.height = gcs["height"];
-                }
-                
-                // 目標レベルの色と行間
-                if (cui.contains("targetLevelAchievedColor")) {
-                    auto& col = cui["targetLevelAchievedColor"];
-                    if (col.is_array() && col.size() >= 4) {
-                        commonUIConfig.targetLevelAchievedColor = {
-                            static_cast<Uint8>(col[0]),
-                            static_cast<Uint8>(col[1]),
-                            static_cast<Uint8>(col[2]),
-                            static_cast<Uint8>(col[3])
-                        };
-                    } else if (col.is_array() && col.size() >= 3) {
-                        commonUIConfig.targetLevelAchievedColor = {
-                            static_cast<Uint8>(col[0]),
-                            static_cast<Uint8>(col[1]),
-                            static_cast<Uint8>(col[2]),
-                            255
-                        };
-                    }
-                }
-                if (cui.contains("targetLevelRemainingColor")) {
-                    auto& col = cui["targetLevelRemainingColor"];
-                    if (col.is_array() && col.size() >= 4) {
-                        commonUIConfig.targetLevelRemainingColor = {
-                            static_cast<Uint8>(col[0]),
-                            static_cast<Uint8>(col[1]),
-                            static_cast<Uint8>(col[2]),
-                            static_cast<Uint8>(col[3])
-                        };
-                    } else if (col.is_array() && col.size() >= 3) {
-                        commonUIConfig.targetLevelRemainingColor = {
-                            static_cast<Uint8>(col[0]),
-                            static_cast<Uint8>(col[1]),
-                            static_cast<Uint8>(col[2]),
-                            255
-                        };
-                    }
-                }
-                if (cui.contains("targetLevelLineSpacing")) {
-                    commonUIConfig.targetLevelLineSpacing = cui["targetLevelLineSpacing"];
-                }
-                
-                // 信頼度の行間
-                if (cui.contains("trustLevelsLineSpacing1")) {
-                    commonUIConfig.trustLevelsLineSpacing1 = cui["trustLevelsLineSpacing1"];
-                }
-                if (cui.contains("trustLevelsLineSpacing2")) {
-                    commonUIConfig.trustLevelsLineSpacing2 = cui["trustLevelsLineSpacing2"];
-                }
-                
-                // ゲームコントローラー状態の色
-                if (cui.contains("gameControllerStatusColor")) {
-                    auto& col = cui["gameControllerStatusColor"];
-                    if (col.is_array() && col.size() >= 4) {
-                        commonUIConfig.gameControllerStatusColor = {
-                            static_cast<Uint8>(col[0]),
-                            static_cast<Uint8>(col[1]),
-                            static_cast<Uint8>(col[2]),
-                            static_cast<Uint8>(col[3])
-                        };
-                    } else if (col.is_array() && col.size() >= 3) {
-                        commonUIConfig.gameControllerStatusColor = {
-                            static_cast<Uint8>(col[0]),
-                            static_cast<Uint8>(col[1]),
-                            static_cast<Uint8>(col[2]),
-                            255
-                        };
-                    }
-                }
-                
-                // 背景色とボーダー色
-                if (cui.contains("backgroundColor")) {
-                    auto& col = cui["backgroundColor"];
-                    if (col.is_array() && col.size() >= 4) {
-                        commonUIConfig.backgroundColor = {
-                            static_cast<Uint8>(col[0]),
-                            static_cast<Uint8>(col[1]),
-                            static_cast<Uint8>(col[2]),
-                            static_cast<Uint8>(col[3])
-                        };
-                    } else if (col.is_array() && col.size() >= 3) {
-                        commonUIConfig.backgroundColor = {
-                            static_cast<Uint8>(col[0]),
-                            static_cast<Uint8>(col[1]),
-                            static_cast<Uint8>(col[2]),
-                            255
-                        };
-                    }
-                }
-                if (cui.contains("borderColor")) {
-                    auto& col = cui["borderColor"];
-                    if (col.is_array() && col.size() >= 4) {
-                        commonUIConfig.borderColor = {
-                            static_cast<Uint8>(col[0]),
-                            static_cast<Uint8>(col[1]),
-                            static_cast<Uint8>(col[2]),
-                            static_cast<Uint8>(col[3])
-                        };
-                    } else if (col.is_array() && col.size() >= 3) {
-                        commonUIConfig.borderColor = {
-                            static_cast<Uint8>(col[0]),
-                            static_cast<Uint8>(col[1]),
-                            static_cast<Uint8>(col[2]),
-                            255
-                        };
-                    }
-                }
-                if (cui.contains("backgroundAlpha")) {
-                    commonUIConfig.backgroundAlpha = static_cast<Uint8>(cui["backgroundAlpha"]);
-                }
-            }
-            
-            auto loadPosition = [](nlohmann::json& pos, UIPosition& uiPos) {
-                if (pos.contains("absoluteX")) uiPos.absoluteX = pos["absoluteX"];
-                if (pos.contains("absoluteY")) uiPos.absoluteY = pos["absoluteY"];
-                if (pos.contains("offsetX")) uiPos.offsetX = pos["offsetX"];
-                if (pos.contains("offsetY")) uiPos.offsetY = pos["offsetY"];
-                if (pos.contains("useRelative")) uiPos.useRelative = pos["useRelative"];
-            };
-            
-            auto loadColor = [](nlohmann::json& col, SDL_Color& color) {
-                if (col.is_array() && col.size() >= 4) {
-                    color = {
-                        static_cast<Uint8>(col[0]),
-                        static_cast<Uint8>(col[1]),
-                        static_cast<Uint8>(col[2]),
-                        static_cast<Uint8>(col[3])
-                    };
-                } else if (col.is_array() && col.size() >= 3) {
-                    color = {
-                        static_cast<Uint8>(col[0]),
-                        static_cast<Uint8>(col[1]),
-                        static_cast<Uint8>(col[2]),
-                        255
-                    };
-                }
-            };
-            
-            // MainMenuState設定
-            if (jsonData.contains("mainMenu")) {
-                auto& mm = jsonData["mainMenu"];
-                if (mm.contains("title")) {
-                    auto& cfg = mm["title"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], mainMenuConfig.title.position);
-                    if (cfg.contains("color")) loadColor(cfg["color"], mainMenuConfig.title.color);
-                }
-                if (mm.contains("playerInfo")) {
-                    auto& cfg = mm["playerInfo"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], mainMenuConfig.playerInfo.position);
-                    if (cfg.contains("color")) loadColor(cfg["color"], mainMenuConfig.playerInfo.color);
-                }
-                if (mm.contains("adventureButton")) {
-                    auto& cfg = mm["adventureButton"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], mainMenuConfig.adventureButton.position);
-                    if (cfg.contains("width")) mainMenuConfig.adventureButton.width = cfg["width"];
-                    if (cfg.contains("height")) mainMenuConfig.adventureButton.height = cfg["height"];
-                    if (cfg.contains("normalColor")) loadColor(cfg["normalColor"], mainMenuConfig.adventureButton.normalColor);
-                    if (cfg.contains("hoverColor")) loadColor(cfg["hoverColor"], mainMenuConfig.adventureButton.hoverColor);
-                    if (cfg.contains("pressedColor")) loadColor(cfg["pressedColor"], mainMenuConfig.adventureButton.pressedColor);
-                    if (cfg.contains("textColor")) loadColor(cfg["textColor"], mainMenuConfig.adventureButton.textColor);
-                }
-                if (mm.contains("startGameText")) {
-                    auto& cfg = mm["startGameText"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], mainMenuConfig.startGameText.position);
-                    if (cfg.contains("color")) loadColor(cfg["color"], mainMenuConfig.startGameText.color);
-                }
-            }
-            
-            // BattleState設定
-            if (jsonData.contains("battle")) {
-                auto& bt = jsonData["battle"];
-                if (bt.contains("battleLog")) {
-                    auto& cfg = bt["battleLog"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], battleConfig.battleLog.position);
-                    if (cfg.contains("color")) loadColor(cfg["color"], battleConfig.battleLog.color);
-                }
-                if (bt.contains("playerStatus")) {
-                    auto& cfg = bt["playerStatus"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], battleConfig.playerStatus.position);
-                    if (cfg.contains("color")) loadColor(cfg["color"], battleConfig.playerStatus.color);
-                }
-                if (bt.contains("enemyStatus")) {
-                    auto& cfg = bt["enemyStatus"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], battleConfig.enemyStatus.position);
-                    if (cfg.contains("color")) loadColor(cfg["color"], battleConfig.enemyStatus.color);
-                }
-                if (bt.contains("message")) {
-                    auto& cfg = bt["message"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], battleConfig.message.position);
-                    if (cfg.contains("color")) loadColor(cfg["color"], battleConfig.message.color);
-                }
-                if (bt.contains("playerHp")) {
-                    auto& cfg = bt["playerHp"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], battleConfig.playerHp.position);
-                    if (cfg.contains("color")) loadColor(cfg["color"], battleConfig.playerHp.color);
-                }
-                if (bt.contains("playerMp")) {
-                    auto& cfg = bt["playerMp"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], battleConfig.playerMp.position);
-                    if (cfg.contains("color")) loadColor(cfg["color"], battleConfig.playerMp.color);
-                }
-                if (bt.contains("enemyHp")) {
-                    auto& cfg = bt["enemyHp"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], battleConfig.enemyHp.position);
-                    if (cfg.contains("color")) loadColor(cfg["color"], battleConfig.enemyHp.color);
-                }
-                if (bt.contains("enemyPosition")) {
-                    auto& cfg = bt["enemyPosition"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], battleConfig.enemyPosition);
-                    if (cfg.contains("width")) battleConfig.enemyWidth = cfg["width"];
-                    if (cfg.contains("height")) battleConfig.enemyHeight = cfg["height"];
-                }
-                if (bt.contains("playerPosition")) {
-                    auto& cfg = bt["playerPosition"];
-                    if (cfg.contains("position")) {
-                        loadPosition(cfg["position"], battleConfig.playerPosition);
-                        printf("UI Config: Loaded playerPosition: absoluteX=%.0f, absoluteY=%.0f, useRelative=%s\n",
-                               battleConfig.playerPosition.absoluteX,
-                               battleConfig.playerPosition.absoluteY,
-                               battleConfig.playerPosition.useRelative ? "true" : "false");
-                    }
-                    if (cfg.contains("width")) battleConfig.playerWidth = cfg["width"];
-                    if (cfg.contains("height")) battleConfig.playerHeight = cfg["height"];
-                }
-                if (bt.contains("explanationMessageBoard")) {
-                    auto& mb = bt["explanationMessageBoard"];
-                    if (mb.contains("background")) {
-                        auto& bg = mb["background"];
-                        if (bg.contains("position")) loadPosition(bg["position"], battleConfig.explanationMessageBoard.background.position);
-                        if (bg.contains("width")) battleConfig.explanationMessageBoard.background.width = bg["width"];
-                        if (bg.contains("height")) battleConfig.explanationMessageBoard.background.height = bg["height"];
-                    }
-                    if (mb.contains("text")) {
-                        auto& txt = mb["text"];
-                        if (txt.contains("position")) loadPosition(txt["position"], battleConfig.explanationMessageBoard.text.position);
-                        if (txt.contains("color")) loadColor(txt["color"], battleConfig.explanationMessageBoard.text.color);
-                    }
-                    // メッセージボードの背景色とボーダー色
-                    if (mb.contains("backgroundColor")) {
-                        auto& col = mb["backgroundColor"];
-                        if (col.is_array() && col.size() >= 4) {
-                            battleConfig.explanationMessageBoard.backgroundColor = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                static_cast<Uint8>(col[3])
-                            };
-                        } else if (col.is_array() && col.size() >= 3) {
-                            battleConfig.explanationMessageBoard.backgroundColor = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                255
-                            };
-                        }
-                    }
-                    if (mb.contains("borderColor")) {
-                        auto& col = mb["borderColor"];
-                        if (col.is_array() && col.size() >= 4) {
-                            battleConfig.explanationMessageBoard.borderColor = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                static_cast<Uint8>(col[3])
-                            };
-                        } else if (col.is_array() && col.size() >= 3) {
-                            battleConfig.explanationMessageBoard.borderColor = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                255
-                            };
-                        }
-                    }
-                }
+            for (size_t i = 0; i < SECTION_COUNT; i++) {
+                UIConfigSection section = static_cast<UIConfigSection>(i);
+                const nlohmann::json* sectionJson = findMember(document, SECTION_NAMES[i]);
+                // JSONそのものではなくハッシュを保持し、キャッシュから起動した場合も差分を取れるようにする
+                const std::string sectionText = sectionJson ? sectionJson->dump() : "null";
+                config.sectionHashes[i] = hashBytes(sectionText.data(), sectionText.size());
                 
-                // プレイヤー名の設定
-                if (bt.contains("playerName")) {
-                    auto& cfg = bt["playerName"];
-                    if (cfg.contains("offsetX")) battleConfig.playerName.offsetX = cfg["offsetX"];
-                    if (cfg.contains("offsetY")) battleConfig.playerName.offsetY = cfg["offsetY"];
-                    if (cfg.contains("color")) loadColor(cfg["color"], battleConfig.playerName.color);
+                // 前回から変わっていないセクションは、前回の設定をそのまま使う
+                if (base && base->hasSectionHashes && base->sectionHashes[i] == config.sectionHashes[i]) {
+                    copySection(section, *base, config);
+                    changed[i] = false;
+                    continue;
                 }
                 
-                // 体力バーの設定
-                if (bt.contains("healthBar")) {
-                    auto& cfg = bt["healthBar"];
-                    if (cfg.contains("offsetX")) battleConfig.healthBar.offsetX = cfg["offsetX"];
-                    if (cfg.contains("offsetY")) battleConfig.healthBar.offsetY = cfg["offsetY"];
-                    if (cfg.contains("width")) battleConfig.healthBar.width = cfg["width"];
-                    if (cfg.contains("height")) battleConfig.healthBar.height = cfg["height"];
-                    if (cfg.contains("barColor")) loadColor(cfg["barColor"], battleConfig.healthBar.barColor);
-                    if (cfg.contains("bgColor")) loadColor(cfg["bgColor"], battleConfig.healthBar.bgColor);
-                    if (cfg.contains("borderColor")) loadColor(cfg["borderColor"], battleConfig.healthBar.borderColor);
-                }
-                
-                // コマンド選択UIの設定
-                if (bt.contains("commandSelection")) {
-                    auto& cfg = bt["commandSelection"];
-                    if (cfg.contains("selectedCommandOffsetY")) battleConfig.commandSelection.selectedCommandOffsetY = cfg["selectedCommandOffsetY"];
-                    if (cfg.contains("selectedCommandImageSize")) battleConfig.commandSelection.selectedCommandImageSize = cfg["selectedCommandImageSize"];
-                    if (cfg.contains("imageSpacing")) battleConfig.commandSelection.imageSpacing = cfg["imageSpacing"];
-                    if (cfg.contains("arrowSpacing")) battleConfig.commandSelection.arrowSpacing = cfg["arrowSpacing"];
-                    if (cfg.contains("buttonBaseOffsetY")) battleConfig.commandSelection.buttonBaseOffsetY = cfg["buttonBaseOffsetY"];
-                    if (cfg.contains("buttonWidth")) battleConfig.commandSelection.buttonWidth = cfg["buttonWidth"];
-                    if (cfg.contains("buttonHeight")) battleConfig.commandSelection.buttonHeight = cfg["buttonHeight"];
-                    if (cfg.contains("buttonSpacing")) battleConfig.commandSelection.buttonSpacing = cfg["buttonSpacing"];
-                    if (cfg.contains("buttonImageSize")) battleConfig.commandSelection.buttonImageSize = cfg["buttonImageSize"];
-                    if (cfg.contains("selectedBgColor")) loadColor(cfg["selectedBgColor"], battleConfig.commandSelection.selectedBgColor);
-                    if (cfg.contains("unselectedBgColor")) loadColor(cfg["unselectedBgColor"], battleConfig.commandSelection.unselectedBgColor);
-                    if (cfg.contains("selectedBorderColor")) loadColor(cfg["selectedBorderColor"], battleConfig.commandSelection.selectedBorderColor);
-                    if (cfg.contains("unselectedBorderColor")) loadColor(cfg["unselectedBorderColor"], battleConfig.commandSelection.unselectedBorderColor);
-                    if (cfg.contains("selectedTextColor")) loadColor(cfg["selectedTextColor"], battleConfig.commandSelection.selectedTextColor);
-                    if (cfg.contains("unselectedTextColor")) loadColor(cfg["unselectedTextColor"], battleConfig.commandSelection.unselectedTextColor);
-                    if (cfg.contains("arrowColor")) loadColor(cfg["arrowColor"], battleConfig.commandSelection.arrowColor);
-                }
-                
-                // 三すくみ画像の設定
-                if (bt.contains("rockPaperScissors")) {
-                    auto& cfg = bt["rockPaperScissors"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], battleConfig.rockPaperScissors.position);
-                    if (cfg.contains("width")) battleConfig.rockPaperScissors.width = cfg["width"];
-                }
-                
-                // ジャッジ結果フェーズのUI設定
-                if (bt.contains("judgeResult")) {
-                    auto& jr = bt["judgeResult"];
-                    
-                    // メイン結果テキスト
-                    if (jr.contains("resultText")) {
-                        auto& rt = jr["resultText"];
-                        if (rt.contains("position")) loadPosition(rt["position"], battleConfig.judgeResult.resultText.position);
-                        if (rt.contains("offsetY")) battleConfig.judgeResult.resultText.offsetY = rt["offsetY"];
-                        if (rt.contains("baseWidth")) battleConfig.judgeResult.resultText.baseWidth = rt["baseWidth"];
-                        if (rt.contains("baseHeight")) battleConfig.judgeResult.resultText.baseHeight = rt["baseHeight"];
-                        
-                        // 勝利時の設定
-                        if (rt.contains("victory")) {
-                            auto& v = rt["victory"];
-                            if (v.contains("textColor")) loadColor(v["textColor"], battleConfig.judgeResult.resultText.victory.textColor);
-                            if (v.contains("backgroundColor")) loadColor(v["backgroundColor"], battleConfig.judgeResult.resultText.victory.backgroundColor);
-                        }
-                        // 後方互換性のため、victoryColorがあればtextColorとbackgroundColorの両方に設定
-                        if (rt.contains("victoryColor") && !rt.contains("victory")) {
-                            loadColor(rt["victoryColor"], battleConfig.judgeResult.resultText.victory.textColor);
-                            loadColor(rt["victoryColor"], battleConfig.judgeResult.resultText.victory.backgroundColor);
-                        }
-                        
-                        // 敗北時の設定
-                        if (rt.contains("defeat")) {
-                            auto& d = rt["defeat"];
-                            if (d.contains("textColor")) loadColor(d["textColor"], battleConfig.judgeResult.resultText.defeat.textColor);
-                            if (d.contains("backgroundColor")) loadColor(d["backgroundColor"], battleConfig.judgeResult.resultText.defeat.backgroundColor);
-                        }
-                        // 後方互換性のため、defeatColorがあればtextColorとbackgroundColorの両方に設定
-                        if (rt.contains("defeatColor") && !rt.contains("defeat")) {
-                            loadColor(rt["defeatColor"], battleConfig.judgeResult.resultText.defeat.textColor);
-                            loadColor(rt["defeatColor"], battleConfig.judgeResult.resultText.defeat.backgroundColor);
-                        }
-                        
-                        // 引き分け時の設定
-                        if (rt.contains("draw")) {
-                            auto& dr = rt["draw"];
-                            if (dr.contains("textColor")) loadColor(dr["textColor"], battleConfig.judgeResult.resultText.draw.textColor);
-                            if (dr.contains("backgroundColor")) loadColor(dr["backgroundColor"], battleConfig.judgeResult.resultText.draw.backgroundColor);
-                        }
-                        // 後方互換性のため、drawColorがあればtextColorとbackgroundColorの両方に設定
-                        if (rt.contains("drawColor") && !rt.contains("draw")) {
-                            loadColor(rt["drawColor"], battleConfig.judgeResult.resultText.draw.textColor);
-                            loadColor(rt["drawColor"], battleConfig.judgeResult.resultText.draw.backgroundColor);
-                        }
-                        
-                        // 一発逆転成功時の設定
-                        if (rt.contains("desperateVictory")) {
-                            auto& dv = rt["desperateVictory"];
-                            if (dv.contains("textColor")) loadColor(dv["textColor"], battleConfig.judgeResult.resultText.desperateVictory.textColor);
-                            if (dv.contains("backgroundColor")) loadColor(dv["backgroundColor"], battleConfig.judgeResult.resultText.desperateVictory.backgroundColor);
-                        }
-                        // 後方互換性のため、desperateVictoryColorがあればtextColorとbackgroundColorの両方に設定
-                        if (rt.contains("desperateVictoryColor") && !rt.contains("desperateVictory")) {
-                            loadColor(rt["desperateVictoryColor"], battleConfig.judgeResult.resultText.desperateVictory.textColor);
-                            loadColor(rt["desperateVictoryColor"], battleConfig.judgeResult.resultText.desperateVictory.backgroundColor);
-                        }
-                        
-                        // 大敗北時の設定
-                        if (rt.contains("desperateDefeat")) {
-                            auto& dd = rt["desperateDefeat"];
-                            if (dd.contains("textColor")) loadColor(dd["textColor"], battleConfig.judgeResult.resultText.desperateDefeat.textColor);
-                            if (dd.contains("backgroundColor")) loadColor(dd["backgroundColor"], battleConfig.judgeResult.resultText.desperateDefeat.backgroundColor);
-                        }
-                        // 後方互換性のため、desperateDefeatColorがあればtextColorとbackgroundColorの両方に設定
-                        if (rt.contains("desperateDefeatColor") && !rt.contains("desperateDefeat")) {
-                            loadColor(rt["desperateDefeatColor"], battleConfig.judgeResult.resultText.desperateDefeat.textColor);
-                            loadColor(rt["desperateDefeatColor"], battleConfig.judgeResult.resultText.desperateDefeat.backgroundColor);
-                        }
-                    }
-                    
-                    // 3連勝テキスト
-                    // ダメージボーナステキスト
-                    if (jr.contains("damageBonus")) {
-                        auto& db = jr["damageBonus"];
-                        if (db.contains("position")) loadPosition(db["position"], battleConfig.judgeResult.damageBonus.position);
-                        if (db.contains("offsetY")) battleConfig.judgeResult.damageBonus.offsetY = db["offsetY"];
-                        if (db.contains("offsetX")) battleConfig.judgeResult.damageBonus.offsetX = db["offsetX"];
-                        if (db.contains("color")) loadColor(db["color"], battleConfig.judgeResult.damageBonus.color);
-                        if (db.contains("format")) battleConfig.judgeResult.damageBonus.format = db["format"];
-                    }
-                }
-                
-                // 勝敗UIの設定
-                if (bt.contains("winLossUI")) {
-                    auto& wl = bt["winLossUI"];
-                    
-                    // 「自分 X勝 敵 Y勝」テキスト
-                    if (wl.contains("winLossText")) {
-                        auto& wlt = wl["winLossText"];
-                        if (wlt.contains("position")) loadPosition(wlt["position"], battleConfig.winLossUI.winLossText.position);
-                        // offsetYはposition.offsetYとして読み込まれるため、直接読み込みは不要
-                        if (wlt.contains("color")) loadColor(wlt["color"], battleConfig.winLossUI.winLossText.color);
-                        if (wlt.contains("padding")) battleConfig.winLossUI.winLossText.padding = wlt["padding"];
-                        if (wlt.contains("format")) battleConfig.winLossUI.winLossText.format = wlt["format"];
-                    }
-                    
-                    // 「〜ターン分の攻撃を実行」テキスト
-                    if (wl.contains("totalAttackText")) {
-                        auto& tat = wl["totalAttackText"];
-                        if (tat.contains("position")) loadPosition(tat["position"], battleConfig.winLossUI.totalAttackText.position);
-                        // offsetYはposition.offsetYとして読み込まれるため、直接読み込みは不要
-                        if (tat.contains("color")) loadColor(tat["color"], battleConfig.winLossUI.totalAttackText.color);
-                        if (tat.contains("padding")) battleConfig.winLossUI.totalAttackText.padding = tat["padding"];
-                        if (tat.contains("playerWinFormat")) battleConfig.winLossUI.totalAttackText.playerWinFormat = tat["playerWinFormat"];
-                        if (tat.contains("enemyWinFormat")) battleConfig.winLossUI.totalAttackText.enemyWinFormat = tat["enemyWinFormat"];
-                        if (tat.contains("drawFormat")) battleConfig.winLossUI.totalAttackText.drawFormat = tat["drawFormat"];
-                        if (tat.contains("hesitateFormat")) battleConfig.winLossUI.totalAttackText.hesitateFormat = tat["hesitateFormat"];
-                    }
-                    
-                    // 「〜のアタック！」などのテキスト
-                    if (wl.contains("attackText")) {
-                        auto& at = wl["attackText"];
-                        if (at.contains("position")) loadPosition(at["position"], battleConfig.winLossUI.attackText.position);
-                        // offsetYはposition.offsetYとして読み込まれるため、直接読み込みは不要
-                        if (at.contains("color")) loadColor(at["color"], battleConfig.winLossUI.attackText.color);
-                        if (at.contains("padding")) battleConfig.winLossUI.attackText.padding = at["padding"];
-                        if (at.contains("attackFormat")) battleConfig.winLossUI.attackText.attackFormat = at["attackFormat"];
-                        if (at.contains("rushFormat")) battleConfig.winLossUI.attackText.rushFormat = at["rushFormat"];
-                        if (at.contains("statusUpSpellFormat")) battleConfig.winLossUI.attackText.statusUpSpellFormat = at["statusUpSpellFormat"];
-                        if (at.contains("healSpellFormat")) battleConfig.winLossUI.attackText.healSpellFormat = at["healSpellFormat"];
-                        if (at.contains("attackSpellFormat")) battleConfig.winLossUI.attackText.attackSpellFormat = at["attackSpellFormat"];
-                        if (at.contains("defaultSpellFormat")) battleConfig.winLossUI.attackText.defaultSpellFormat = at["defaultSpellFormat"];
-                        if (at.contains("defaultAttackFormat")) battleConfig.winLossUI.attackText.defaultAttackFormat = at["defaultAttackFormat"];
-                    }
-                    
-                    // 特殊技の効果メッセージテキスト
-                    if (wl.contains("effectMessageText")) {
-                        auto& emt = wl["effectMessageText"];
-                        if (emt.contains("position")) {
-                            loadPosition(emt["position"], battleConfig.winLossUI.effectMessageText.position);
-                            // position.offsetYがあれば、offsetYメンバーにも設定（後方互換性）
-                            if (emt["position"].contains("offsetY")) {
-                                battleConfig.winLossUI.effectMessageText.offsetY = emt["position"]["offsetY"];
-                            }
-                        }
-                        // 直接offsetYが指定されている場合（後方互換性）
-                        if (emt.contains("offsetY")) {
-                            battleConfig.winLossUI.effectMessageText.offsetY = emt["offsetY"];
-                            battleConfig.winLossUI.effectMessageText.position.offsetY = emt["offsetY"];
-                        }
-                        if (emt.contains("color")) loadColor(emt["color"], battleConfig.winLossUI.effectMessageText.color);
-                        if (emt.contains("padding")) battleConfig.winLossUI.effectMessageText.padding = emt["padding"];
-                    }
-                }
-                
-                // コマンド選択ヒントテキストの設定
-                if (bt.contains("commandHint")) {
-                    auto& ch = bt["commandHint"];
-                    if (ch.contains("position")) loadPosition(ch["position"], battleConfig.commandHint.position);
-                    if (ch.contains("offsetY")) battleConfig.commandHint.offsetY = ch["offsetY"];
-                    if (ch.contains("offsetX")) battleConfig.commandHint.offsetX = ch["offsetX"];
-                    if (ch.contains("color")) loadColor(ch["color"], battleConfig.commandHint.color);
-                    if (ch.contains("padding")) battleConfig.commandHint.padding = ch["padding"];
-                    if (ch.contains("normalText")) battleConfig.commandHint.normalText = ch["normalText"];
-                    if (ch.contains("residentText")) battleConfig.commandHint.residentText = ch["residentText"];
-                }
-                
-                // ジャッジフェーズの結果表示UI設定
-                if (bt.contains("judgePhase")) {
-                    auto& jp = bt["judgePhase"];
-                    
-                    // 位置設定
-                    if (jp.contains("position")) {
-                        loadPosition(jp["position"], battleConfig.judgePhase.position);
-                    }
-                    
-                    // 勝利時の設定
-                    if (jp.contains("win")) {
-                        auto& win = jp["win"];
-                        if (win.contains("text")) battleConfig.judgePhase.win.text = win["text"];
-                        if (win.contains("textColor")) loadColor(win["textColor"], battleConfig.judgePhase.win.textColor);
-                        if (win.contains("backgroundColor")) loadColor(win["backgroundColor"], battleConfig.judgePhase.win.backgroundColor);
-                        // 後方互換性のため、colorがあればtextColorとbackgroundColorの両方に設定
-                        if (win.contains("color") && !win.contains("textColor") && !win.contains("backgroundColor")) {
-                            loadColor(win["color"], battleConfig.judgePhase.win.textColor);
-                            loadColor(win["color"], battleConfig.judgePhase.win.backgroundColor);
-                        }
-                    }
-                    
-                    // 敗北時の設定
-                    if (jp.contains("lose")) {
-                        auto& lose = jp["lose"];
-                        if (lose.contains("text")) battleConfig.judgePhase.lose.text = lose["text"];
-                        if (lose.contains("textColor")) loadColor(lose["textColor"], battleConfig.judgePhase.lose.textColor);
-                        if (lose.contains("backgroundColor")) loadColor(lose["backgroundColor"], battleConfig.judgePhase.lose.backgroundColor);
-                        // 後方互換性のため、colorがあればtextColorとbackgroundColorの両方に設定
-                        if (lose.contains("color") && !lose.contains("textColor") && !lose.contains("backgroundColor")) {
-                            loadColor(lose["color"], battleConfig.judgePhase.lose.textColor);
-                            loadColor(lose["color"], battleConfig.judgePhase.lose.backgroundColor);
-                        }
-                    }
-                    
-                    // 引き分け時の設定
-                    if (jp.contains("draw")) {
-                        auto& draw = jp["draw"];
-                        if (draw.contains("text")) battleConfig.judgePhase.draw.text = draw["text"];
-                        if (draw.contains("textColor")) loadColor(draw["textColor"], battleConfig.judgePhase.draw.textColor);
-                        if (draw.contains("backgroundColor")) loadColor(draw["backgroundColor"], battleConfig.judgePhase.draw.backgroundColor);
-                        // 後方互換性のため、colorがあればtextColorとbackgroundColorの両方に設定
-                        if (draw.contains("color") && !draw.contains("textColor") && !draw.contains("backgroundColor")) {
-                            loadColor(draw["color"], battleConfig.judgePhase.draw.textColor);
-                            loadColor(draw["color"], battleConfig.judgePhase.draw.backgroundColor);
-                        }
-                    }
-                    
-                    // その他の設定
-                    if (jp.contains("baseWidth")) battleConfig.judgePhase.baseWidth = jp["baseWidth"];
-                    if (jp.contains("baseHeight")) battleConfig.judgePhase.baseHeight = jp["baseHeight"];
-                    if (jp.contains("backgroundPadding")) battleConfig.judgePhase.backgroundPadding = jp["backgroundPadding"];
-                    if (jp.contains("glowColor")) loadColor(jp["glowColor"], battleConfig.judgePhase.glowColor);
-                }
-                
-                // 勝利表示UI設定
-                if (bt.contains("victoryDisplay")) {
-                    auto& vd = bt["victoryDisplay"];
-                    if (vd.contains("position")) loadPosition(vd["position"], battleConfig.victoryDisplay.position);
-                    if (vd.contains("textColor")) loadColor(vd["textColor"], battleConfig.victoryDisplay.textColor);
-                    if (vd.contains("backgroundColor")) loadColor(vd["backgroundColor"], battleConfig.victoryDisplay.backgroundColor);
-                    if (vd.contains("borderColor")) loadColor(vd["borderColor"], battleConfig.victoryDisplay.borderColor);
-                    if (vd.contains("padding")) battleConfig.victoryDisplay.padding = vd["padding"];
-                    if (vd.contains("format")) battleConfig.victoryDisplay.format = vd["format"];
-                }
-                
-                // レベルアップ表示UI設定
-                if (bt.contains("levelUpDisplay")) {
-                    auto& lud = bt["levelUpDisplay"];
-                    if (lud.contains("position")) loadPosition(lud["position"], battleConfig.levelUpDisplay.position);
-                    if (lud.contains("textColor")) loadColor(lud["textColor"], battleConfig.levelUpDisplay.textColor);
-                    if (lud.contains("backgroundColor")) loadColor(lud["backgroundColor"], battleConfig.levelUpDisplay.backgroundColor);
-                    if (lud.contains("borderColor")) loadColor(lud["borderColor"], battleConfig.levelUpDisplay.borderColor);
-                    if (lud.contains("padding")) battleConfig.levelUpDisplay.padding = lud["padding"];
-                    if (lud.contains("singleLevelFormat")) battleConfig.levelUpDisplay.singleLevelFormat = lud["singleLevelFormat"];
-                    if (lud.contains("multiLevelFormat")) battleConfig.levelUpDisplay.multiLevelFormat = lud["multiLevelFormat"];
-                }
-                
-                // ステータス上昇呪文の攻撃倍率表示UI設定
-                if (bt.contains("attackMultiplier")) {
-                    auto& am = bt["attackMultiplier"];
-                    if (am.contains("position")) loadPosition(am["position"], battleConfig.attackMultiplier.position);
-                    if (am.contains("offsetX")) battleConfig.attackMultiplier.offsetX = am["offsetX"];
-                    if (am.contains("offsetY")) battleConfig.attackMultiplier.offsetY = am["offsetY"];
-                    if (am.contains("textColor")) loadColor(am["textColor"], battleConfig.attackMultiplier.textColor);
-                    if (am.contains("bgColor")) loadColor(am["bgColor"], battleConfig.attackMultiplier.bgColor);
-                    if (am.contains("borderColor")) loadColor(am["borderColor"], battleConfig.attackMultiplier.borderColor);
-                    if (am.contains("padding")) battleConfig.attackMultiplier.padding = am["padding"];
-                    if (am.contains("format")) battleConfig.attackMultiplier.format = am["format"];
-                }
-            }
-            
-            // RoomState設定
-            if (jsonData.contains("room")) {
-                auto& rm = jsonData["room"];
-                if (rm.contains("messageBoard")) {
-                    auto& mb = rm["messageBoard"];
-                    if (mb.contains("background")) {
-                        auto& bg = mb["background"];
-                        if (bg.contains("position")) loadPosition(bg["position"], roomConfig.messageBoard.background.position);
-                        if (bg.contains("width")) roomConfig.messageBoard.background.width = bg["width"];
-                        if (bg.contains("height")) roomConfig.messageBoard.background.height = bg["height"];
-                    }
-                    if (mb.contains("text")) {
-                        auto& txt = mb["text"];
-                        if (txt.contains("position")) loadPosition(txt["position"], roomConfig.messageBoard.text.position);
-                        if (txt.contains("color")) loadColor(txt["color"], roomConfig.messageBoard.text.color);
-                    }
-                    // メッセージボードの背景色とボーダー色
-                    if (mb.contains("backgroundColor")) {
-                        auto& col = mb["backgroundColor"];
-                        if (col.is_array() && col.size() >= 4) {
-                            roomConfig.messageBoard.backgroundColor = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                static_cast<Uint8>(col[3])
-                            };
-                        } else if (col.is_array() && col.size() >= 3) {
-                            roomConfig.messageBoard.backgroundColor = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                255
-                            };
+                // 変わったセクションはデフォルト値から設定し直す
+                copySection(section, defaults, config);
+                if (sectionJson) {
+                    for (const Binding& binding : BINDINGS) {
+                        if (binding.section == section) {
+                            applyBinding(binding, *sectionJson, config);
                         }
                     }
-                    if (mb.contains("borderColor")) {
-                        auto& col = mb["borderColor"];
-                        if (col.is_array() && col.size() >= 4) {
-                            roomConfig.messageBoard.borderColor = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                static_cast<Uint8>(col[3])
-                            };
-                        } else if (col.is_array() && col.size() >= 3) {
-                            roomConfig.messageBoard.borderColor = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                255
-                            };
-                        }
-                    }
-                }
-                if (rm.contains("howToOperateBackground")) {
-                    auto& bg = rm["howToOperateBackground"];
-                    if (bg.contains("position")) loadPosition(bg["position"], roomConfig.howToOperateBackground.position);
-                    if (bg.contains("width")) roomConfig.howToOperateBackground.width = bg["width"];
-                    if (bg.contains("height")) roomConfig.howToOperateBackground.height = bg["height"];
-                }
-                if (rm.contains("howToOperateText")) {
-                    auto& txt = rm["howToOperateText"];
-                    if (txt.contains("position")) loadPosition(txt["position"], roomConfig.howToOperateText.position);
-                    if (txt.contains("color")) loadColor(txt["color"], roomConfig.howToOperateText.color);
-                }
-            }
-            
-            // TownState設定
-            if (jsonData.contains("town")) {
-                auto& tn = jsonData["town"];
-                if (tn.contains("playerInfo")) {
-                    auto& cfg = tn["playerInfo"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], townConfig.playerInfo.position);
-                    if (cfg.contains("color")) loadColor(cfg["color"], townConfig.playerInfo.color);
-                }
-                if (tn.contains("controls")) {
-                    auto& cfg = tn["controls"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], townConfig.controls.position);
-                    if (cfg.contains("color")) loadColor(cfg["color"], townConfig.controls.color);
-                }
-            }
-            
-            // CastleState設定
-            if (jsonData.contains("castle")) {
-                auto& cs = jsonData["castle"];
-                if (cs.contains("messageBoard")) {
-                    auto& mb = cs["messageBoard"];
-                    if (mb.contains("background")) {
-                        auto& bg = mb["background"];
-                        if (bg.contains("position")) loadPosition(bg["position"], castleConfig.messageBoard.background.position);
-                        if (bg.contains("width")) castleConfig.messageBoard.background.width = bg["width"];
-                        if (bg.contains("height")) castleConfig.messageBoard.background.height = bg["height"];
-                    }
-                    if (mb.contains("text")) {
-                        auto& txt = mb["text"];
-                        if (txt.contains("position")) loadPosition(txt["position"], castleConfig.messageBoard.text.position);
-                        if (txt.contains("color")) loadColor(txt["color"], castleConfig.messageBoard.text.color);
-                    }
-                    // メッセージボードの背景色とボーダー色
-                    if (mb.contains("backgroundColor")) {
-                        auto& col = mb["backgroundColor"];
-                        if (col.is_array() && col.size() >= 4) {
-                            castleConfig.messageBoard.backgroundColor = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                static_cast<Uint8>(col[3])
-                            };
-                        } else if (col.is_array() && col.size() >= 3) {
-                            castleConfig.messageBoard.backgroundColor = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                255
-                            };
-                        }
-                    }
-                    if (mb.contains("borderColor")) {
-                        auto& col = mb["borderColor"];
-                        if (col.is_array() && col.size() >= 4) {
-                            castleConfig.messageBoard.borderColor = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                static_cast<Uint8>(col[3])
-                            };
-                        } else if (col.is_array() && col.size() >= 3) {
-                            castleConfig.messageBoard.borderColor = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                255
-                            };
-                        }
-                    }
-                }
-            }
-            
-            // DemonCastleState設定
-            if (jsonData.contains("demonCastle")) {
-                auto& dc = jsonData["demonCastle"];
-                if (dc.contains("messageBoard")) {
-                    auto& mb = dc["messageBoard"];
-                    if (mb.contains("background")) {
-                        auto& bg = mb["background"];
-                        if (bg.contains("position")) loadPosition(bg["position"], demonCastleConfig.messageBoard.background.position);
-                        if (bg.contains("width")) demonCastleConfig.messageBoard.background.width = bg["width"];
-                        if (bg.contains("height")) demonCastleConfig.messageBoard.background.height = bg["height"];
-                    }
-                    if (mb.contains("text")) {
-                        auto& txt = mb["text"];
-                        if (txt.contains("position")) loadPosition(txt["position"], demonCastleConfig.messageBoard.text.position);
-                        if (txt.contains("color")) loadColor(txt["color"], demonCastleConfig.messageBoard.text.color);
-                    }
-                    // メッセージボードの背景色とボーダー色
-                    if (mb.contains("backgroundColor")) {
-                        auto& col = mb["backgroundColor"];
-                        if (col.is_array() && col.size() >= 4) {
-                            demonCastleConfig.messageBoard.backgroundColor = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                static_cast<Uint8>(col[3])
-                            };
-                        } else if (col.is_array() && col.size() >= 3) {
-                            demonCastleConfig.messageBoard.backgroundColor = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                255
-                            };
-                        }
-                    }
-                    if (mb.contains("borderColor")) {
-                        auto& col = mb["borderColor"];
-                        if (col.is_array() && col.size() >= 4) {
-                            demonCastleConfig.messageBoard.borderColor = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                static_cast<Uint8>(col[3])
-                            };
-                        } else if (col.is_array() && col.size() >= 3) {
-                            demonCastleConfig.messageBoard.borderColor = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                255
-                            };
-                        }
-                    }
-                }
-            }
-            
-            // GameOverState設定
-            if (jsonData.contains("gameOver")) {
-                auto& go = jsonData["gameOver"];
-                if (go.contains("title")) {
-                    auto& cfg = go["title"];
-                    if (cfg.contains("text")) {
-                        auto& textCfg = cfg["text"];
-                        if (textCfg.contains("position")) loadPosition(textCfg["position"], gameOverConfig.title.text.position);
-                        if (textCfg.contains("color")) loadColor(textCfg["color"], gameOverConfig.title.text.color);
-                    }
-                    if (cfg.contains("background")) {
-                        auto& bgCfg = cfg["background"];
-                        if (bgCfg.contains("position")) loadPosition(bgCfg["position"], gameOverConfig.title.background.position);
-                        if (bgCfg.contains("width")) gameOverConfig.title.background.width = bgCfg["width"].get<int>();
-                        if (bgCfg.contains("height")) gameOverConfig.title.background.height = bgCfg["height"].get<int>();
-                    }
-                    if (cfg.contains("backgroundColor")) loadColor(cfg["backgroundColor"], gameOverConfig.title.backgroundColor);
-                    if (cfg.contains("borderColor")) loadColor(cfg["borderColor"], gameOverConfig.title.borderColor);
-                }
-                if (go.contains("reason")) {
-                    auto& cfg = go["reason"];
-                    if (cfg.contains("text")) {
-                        auto& textCfg = cfg["text"];
-                        if (textCfg.contains("position")) loadPosition(textCfg["position"], gameOverConfig.reason.text.position);
-                        if (textCfg.contains("color")) loadColor(textCfg["color"], gameOverConfig.reason.text.color);
-                    }
-                    if (cfg.contains("background")) {
-                        auto& bgCfg = cfg["background"];
-                        if (bgCfg.contains("position")) loadPosition(bgCfg["position"], gameOverConfig.reason.background.position);
-                        if (bgCfg.contains("width")) gameOverConfig.reason.background.width = bgCfg["width"].get<int>();
-                        if (bgCfg.contains("height")) gameOverConfig.reason.background.height = bgCfg["height"].get<int>();
-                    }
-                    if (cfg.contains("backgroundColor")) loadColor(cfg["backgroundColor"], gameOverConfig.reason.backgroundColor);
-                    if (cfg.contains("borderColor")) loadColor(cfg["borderColor"], gameOverConfig.reason.borderColor);
-                }
-                if (go.contains("instruction")) {
-                    auto& cfg = go["instruction"];
-                    if (cfg.contains("text")) {
-                        auto& textCfg = cfg["text"];
-                        if (textCfg.contains("position")) loadPosition(textCfg["position"], gameOverConfig.instruction.text.position);
-                        if (textCfg.contains("color")) loadColor(textCfg["color"], gameOverConfig.instruction.text.color);
-                    }
-                    if (cfg.contains("background")) {
-                        auto& bgCfg = cfg["background"];
-                        if (bgCfg.contains("position")) loadPosition(bgCfg["position"], gameOverConfig.instruction.background.position);
-                        if (bgCfg.contains("width")) gameOverConfig.instruction.background.width = bgCfg["width"].get<int>();
-                        if (bgCfg.contains("height")) gameOverConfig.instruction.background.height = bgCfg["height"].get<int>();
-                    }
-                    if (cfg.contains("backgroundColor")) loadColor(cfg["backgroundColor"], gameOverConfig.instruction.backgroundColor);
-                    if (cfg.contains("borderColor")) loadColor(cfg["borderColor"], gameOverConfig.instruction.borderColor);
-                }
-                if (go.contains("retry")) {
-                    auto& cfg = go["retry"];
-                    if (cfg.contains("text")) {
-                        auto& textCfg = cfg["text"];
-                        if (textCfg.contains("position")) loadPosition(textCfg["position"], gameOverConfig.retry.text.position);
-                        if (textCfg.contains("color")) loadColor(textCfg["color"], gameOverConfig.retry.text.color);
-                    }
-                    if (cfg.contains("background")) {
-                        auto& bgCfg = cfg["background"];
-                        if (bgCfg.contains("position")) loadPosition(bgCfg["position"], gameOverConfig.retry.background.position);
-                        if (bgCfg.contains("width")) gameOverConfig.retry.background.width = bgCfg["width"].get<int>();
-                        if (bgCfg.contains("height")) gameOverConfig.retry.background.height = bgCfg["height"].get<int>();
-                    }
-                    if (cfg.contains("backgroundColor")) loadColor(cfg["backgroundColor"], gameOverConfig.retry.backgroundColor);
-                    if (cfg.contains("borderColor")) loadColor(cfg["borderColor"], gameOverConfig.retry.borderColor);
-                }
-                if (go.contains("extendTime")) {
-                    auto& cfg = go["extendTime"];
-                    if (cfg.contains("text")) {
-                        auto& textCfg = cfg["text"];
-                        if (textCfg.contains("position")) loadPosition(textCfg["position"], gameOverConfig.extendTime.text.position);
-                        if (textCfg.contains("color")) loadColor(textCfg["color"], gameOverConfig.extendTime.text.color);
-                    }
-                    if (cfg.contains("background")) {
-                        auto& bgCfg = cfg["background"];
-                        if (bgCfg.contains("position")) loadPosition(bgCfg["position"], gameOverConfig.extendTime.background.position);
-                        if (bgCfg.contains("width")) gameOverConfig.extendTime.background.width = bgCfg["width"].get<int>();
-                        if (bgCfg.contains("height")) gameOverConfig.extendTime.background.height = bgCfg["height"].get<int>();
-                    }
-                    if (cfg.contains("backgroundColor")) loadColor(cfg["backgroundColor"], gameOverConfig.extendTime.backgroundColor);
-                    if (cfg.contains("borderColor")) loadColor(cfg["borderColor"], gameOverConfig.extendTime.borderColor);
-                }
-                if (go.contains("image")) {
-                    auto& cfg = go["image"];
-                    if (cfg.contains("baseSize")) gameOverConfig.image.baseSize = cfg["baseSize"].get<int>();
                 }
+                changed[i] = true;
             }
-            
-            // EndingState設定
-            if (jsonData.contains("ending")) {
-                auto& en = jsonData["ending"];
-                if (en.contains("message")) {
-                    auto& cfg = en["message"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], endingConfig.message.position);
-                    if (cfg.contains("color")) loadColor(cfg["color"], endingConfig.message.color);
-                }
-                if (en.contains("staffRoll")) {
-                    auto& cfg = en["staffRoll"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], endingConfig.staffRoll.position);
-                    if (cfg.contains("color")) loadColor(cfg["color"], endingConfig.staffRoll.color);
-                }
-                if (en.contains("theEnd")) {
-                    auto& cfg = en["theEnd"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], endingConfig.theEnd.position);
-                    if (cfg.contains("color")) loadColor(cfg["color"], endingConfig.theEnd.color);
-                }
-                if (en.contains("returnToMenu")) {
-                    auto& cfg = en["returnToMenu"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], endingConfig.returnToMenu.position);
-                    if (cfg.contains("color")) loadColor(cfg["color"], endingConfig.returnToMenu.color);
+        } catch (const std::exception& e) {
+            printf("UI Config: Error loading config: %s\n", e.what());
+            return false;
+        }
+        
+        config.hasSectionHashes = true;
+        return true;
+    }
+    
+    const UIConfigSnapshot& UIConfigManager::getDefaultSnapshot() {
+        static const UIConfigSnapshot defaults = []() {
+            UIConfigSnapshot values{};
+            setDefaultValues(values);
+            return values;
+        }();
+        return defaults;
+    }
+    
+    uint64_t UIConfigManager::getCacheLayoutHash() {
+        // 対応表とデフォルト値のどちらかが変わったら、以前のキャッシュは使わない
+        static const uint64_t layoutHash = []() {
+            uint64_t hash = hashBytes(&CACHE_VERSION, sizeof(CACHE_VERSION));
+            for (const Binding& binding : BINDINGS) {
+                const int32_t kinds[2] = {static_cast<int32_t>(binding.section), static_cast<int32_t>(binding.type)};
+                hash = hashBytes(kinds, sizeof(kinds), hash);
+                hash = hashBytes(binding.path, std::strlen(binding.path) + 1, hash);
+                for (const char* unlessKey : binding.unlessKeys) {
+                    hash = unlessKey ? hashBytes(unlessKey, std::strlen(unlessKey) + 1, hash) : hashBytes("", 1, hash);
                 }
             }
-            
-            // NightState設定
-            if (jsonData.contains("night")) {
-                auto& nt = jsonData["night"];
-                if (nt.contains("nightDisplayBackground")) {
-                    auto& cfg = nt["nightDisplayBackground"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], nightConfig.nightDisplayBackground.position);
-                    if (cfg.contains("width")) nightConfig.nightDisplayBackground.width = cfg["width"];
-                    if (cfg.contains("height")) nightConfig.nightDisplayBackground.height = cfg["height"];
-                }
-                if (nt.contains("nightDisplayText")) {
-                    auto& cfg = nt["nightDisplayText"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], nightConfig.nightDisplayText.position);
-                    if (cfg.contains("color")) loadColor(cfg["color"], nightConfig.nightDisplayText.color);
-                }
-                if (nt.contains("nightOperationBackground")) {
-                    auto& cfg = nt["nightOperationBackground"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], nightConfig.nightOperationBackground.position);
-                    if (cfg.contains("width")) nightConfig.nightOperationBackground.width = cfg["width"];
-                    if (cfg.contains("height")) nightConfig.nightOperationBackground.height = cfg["height"];
-                }
-                if (nt.contains("nightOperationText")) {
-                    auto& cfg = nt["nightOperationText"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], nightConfig.nightOperationText.position);
-                    if (cfg.contains("color")) loadColor(cfg["color"], nightConfig.nightOperationText.color);
-                }
-                if (nt.contains("messageBoard")) {
-                    auto& mb = nt["messageBoard"];
-                    if (mb.contains("background")) {
-                        auto& bg = mb["background"];
-                        if (bg.contains("position")) loadPosition(bg["position"], nightConfig.messageBoard.background.position);
-                        if (bg.contains("width")) nightConfig.messageBoard.background.width = bg["width"];
-                        if (bg.contains("height")) nightConfig.messageBoard.background.height = bg["height"];
-                    }
-                    if (mb.contains("text")) {
-                        auto& txt = mb["text"];
-                        if (txt.contains("position")) loadPosition(txt["position"], nightConfig.messageBoard.text.position);
-                        if (txt.contains("color")) loadColor(txt["color"], nightConfig.messageBoard.text.color);
-                    }
-                    // メッセージボードの背景色とボーダー色
-                    if (mb.contains("backgroundColor")) {
-                        auto& col = mb["backgroundColor"];
-                        if (col.is_array() && col.size() >= 4) {
-                            nightConfig.messageBoard.backgroundColor = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                static_cast<Uint8>(col[3])
-                            };
-                        } else if (col.is_array() && col.size() >= 3) {
-                            nightConfig.messageBoard.backgroundColor = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                255
-                            };
-                        }
-                    }
-                    if (mb.contains("borderColor")) {
-                        auto& col = mb["borderColor"];
-                        if (col.is_array() && col.size() >= 4) {
-                            nightConfig.messageBoard.borderColor = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                static_cast<Uint8>(col[3])
-                            };
-                        } else if (col.is_array() && col.size() >= 3) {
-                            nightConfig.messageBoard.borderColor = {
-                                static_cast<Uint8>(col[0]),
-                                static_cast<Uint8>(col[1]),
-                                static_cast<Uint8>(col[2]),
-                                255
-                            };
-                        }
-                    }
-                }
+            std::string defaultValues;
+            writeBindingValues(getDefaultSnapshot(), defaultValues);
+            return hashBytes(defaultValues.data(), defaultValues.size(), hash);
+        }();
+        return layoutHash;
+    }
+    
+    bool UIConfigManager::readConfigCache(const std::string& cachePath, uint64_t sourceSize, int64_t sourceMtime,
+                                          const uint64_t* sourceHash, UIConfigSnapshot& config) {
+        TRACE_SCOPE("UIConfigManager::readConfigCache");
+        std::string bytes;
+        CacheHeader header;
+        if (!readFileBytes(cachePath, bytes) || bytes.size() < sizeof(header)) {
+            return false;
+        }
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        const char* payload = bytes.data() + sizeof(header);
+        if (header.magic != CACHE_MAGIC || header.version != CACHE_VERSION ||
+            header.layoutHash != getCacheLayoutHash() || header.sourceSize != sourceSize ||
+            header.payloadSize != bytes.size() - sizeof(header) ||
+            header.payloadHash != hashBytes(payload, header.payloadSize)) {
+            return false;
+        }
+        bool sourceMatches = sourceHash ? header.sourceHash == *sourceHash
+                                        : (header.sourceMtime != 0 && header.sourceMtime == sourceMtime);
+        if (!sourceMatches) {
+            return false;
+        }
+        
+        // 対応表にないメンバーはJSONから読み込む場合と同じくデフォルト値にする
+        UIConfigSnapshot values = getDefaultSnapshot();
+        if (!readBindingValues(payload, payload + header.payloadSize, values)) {
+            return false;
+        }
+        std::copy(std::begin(header.sectionHashes), std::end(header.sectionHashes), values.sectionHashes.begin());
+        values.hasSectionHashes = true;
+        config = std::move(values);
+        return true;
+    }
+    
+    bool UIConfigManager::writeConfigCache(const std::string& cachePath, uint64_t sourceSize, int64_t sourceMtime,
+                                           uint64_t sourceHash, const UIConfigSnapshot& config) {
+        std::string payload;
+        writeBindingValues(config, payload);
+        
+        CacheHeader header;
+        header.magic = CACHE_MAGIC;
+        header.version = CACHE_VERSION;
+        header.layoutHash = getCacheLayoutHash();
+        header.sourceSize = sourceSize;
+        // 更新時刻の精度は1秒のため、直前に保存されたファイルは同じ秒のうちにもう一度保存されても時刻が変わらない。
+        // その場合は更新時刻を記録せず、次回はハッシュで確認する
+        header.sourceMtime = sourceMtime < static_cast<int64_t>(std::time(nullptr)) - 1 ? sourceMtime : 0;
+        header.sourceHash = sourceHash;
+        header.payloadSize = payload.size();
+        header.payloadHash = hashBytes(payload.data(), payload.size());
+        std::copy(config.sectionHashes.begin(), config.sectionHashes.end(), std::begin(header.sectionHashes));
+        
+        // 書き込みの途中で終了しても壊れたキャッシュを残さないよう、一時ファイルに書いてから置き換える
+        std::string tempPath = cachePath + ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) {
+                printf("UI Config: Failed to write cache: %s\n", cachePath.c_str());
+                return false;
             }
-            
-            // FieldState設定
-            if (jsonData.contains("field")) {
-                auto& fd = jsonData["field"];
-                if (fd.contains("monsterLevel")) {
-                    auto& cfg = fd["monsterLevel"];
-                    if (cfg.contains("position")) loadPosition(cfg["position"], fieldConfig.monsterLevel.position);
-                    if (cfg.contains("color")) loadColor(cfg["color"], fieldConfig.monsterLevel.color);
-                }
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(payload.data(), payload.size());
+            if (!file) {
+                printf("UI Config: Failed to write cache: %s\n", cachePath.c_str());
+                return false;
             }
-            
-            configLoaded = true;
-            
-            lastFileModificationTime = getFileModificationTime(configFilePath);
-            
-            printf("UI Config: Loaded successfully from %s\n", configFilePath.c_str());
-            return true;
-            
-        } catch (const std::exception& e) {
-            printf("UI Config: Error loading config: %s\n", e.what());
-            configLoaded = false;
+        }
+        std::remove(cachePath.c_str());  // Windowsのrenameは既存のファイルを置き換えない
+        if (std::rename(tempPath.c_str(), cachePath.c_str()) != 0) {
+            std::remove(tempPath.c_str());
+            printf("UI Config: Failed to write cache: %s\n", cachePath.c_str());
             return false;
         }
+        return true;
     }
     
     void UIConfigManager::reloadConfig() {
+        std::string pathToLoad = selectConfigPath(configFilePath);
+        if (!pathToLoad.empty()) {
+            loadConfig(pathToLoad);
+        }
+    }
+    
+    std::string UIConfigManager::selectConfigPath(const std::string& fallbackPath) {
         // 常に元のファイル（../assets/config/ui_config.json）を優先的に読み込む
         std::string originalPath = "../assets/config/ui_config.json";
         std::string buildPath = "assets/config/ui_config.json";
         
-        time_t originalModTime = getFileModificationTime(originalPath);
-        time_t buildModTime = getFileModificationTime(buildPath);
-        
-        std::string pathToLoad;
-        if (originalModTime > 0) {
+        if (getFileModificationTime(originalPath) > 0) {
             // 元のファイルを優先
-            pathToLoad = originalPath;
-        } else if (buildModTime > 0) {
+            return originalPath;
+        }
+        if (getFileModificationTime(buildPath) > 0) {
             // 元のファイルが存在しない場合のみ、build内のファイルを使用
-            pathToLoad = buildPath;
-        } else {
-            // どちらも見つからない場合は、既存のconfigFilePathを使用
-            if (!configFilePath.empty()) {
-                loadConfig(configFilePath);
-            }
-            return;
+            return buildPath;
         }
-        
-        configFilePath = pathToLoad;
-        loadConfig(pathToLoad);
+        // どちらも見つからない場合は、既存の設定ファイルのパスを使用
+        return fallbackPath;
     }
     
-    time_t UIConfigManager::getFileModificationTime(const std::string& filepath) const {
+    time_t UIConfigManager::getFileModificationTime(const std::string& filepath) {
 #ifdef _WIN32
         struct _stat fileInfo;
         if (_stat(filepath.c_str(), &fileInfo) == 0) {
@@ -1819,52 +1427,104 @@ namespace UIConfig {
         return 0;
     }
     
-    bool UIConfigManager::checkAndReloadConfig() {
-        // 常に元のファイル（../assets/config/ui_config.json）を優先的に監視
-        // これにより、編集したファイルが確実にホットリロードされる
-        std::string originalPath = "../assets/config/ui_config.json";
-        std::string buildPath = "assets/config/ui_config.json";
-        
-        time_t originalModTime = getFileModificationTime(originalPath);
-        time_t buildModTime = getFileModificationTime(buildPath);
-        
-        time_t currentModTime = 0;
-        std::string currentPath;
-        
-        // 元のファイルを優先（存在する場合）
-        if (originalModTime > 0) {
-            currentModTime = originalModTime;
-            currentPath = originalPath;
-        } else if (buildModTime > 0) {
-            // 元のファイルが存在しない場合のみ、build内のファイルを使用
-            currentModTime = buildModTime;
-            currentPath = buildPath;
-        } else {
-            // どちらも見つからない場合はスキップ
+    bool UIConfigManager::getFileStamp(const std::string& filepath, uint64_t& size, int64_t& mtime) {
+#ifdef _WIN32
+        struct _stat fileInfo;
+        if (_stat(filepath.c_str(), &fileInfo) != 0) {
             return false;
         }
-        
-        // パスが変わった場合は更新
-        if (configFilePath != currentPath) {
-            configFilePath = currentPath;
-            lastFileModificationTime = 0; // 強制的にリロード
+#else
+        struct stat fileInfo;
+        if (stat(filepath.c_str(), &fileInfo) != 0) {
+            return false;
         }
-        
-        if (currentModTime > 0 && currentModTime != lastFileModificationTime && lastFileModificationTime > 0) {
-            printf("UI Config: File changed! Reloading from %s...\n", currentPath.c_str());
-            lastFileModificationTime = currentModTime;
-            reloadConfig();
-            printf("UI Config: Reload complete. Player position: absoluteX=%.0f, absoluteY=%.0f\n",
-                   getBattleConfig().playerPosition.absoluteX,
-                   getBattleConfig().playerPosition.absoluteY);
-            return true;
+#endif
+        size = static_cast<uint64_t>(fileInfo.st_size);
+        mtime = static_cast<int64_t>(fileInfo.st_mtime);
+        return true;
+    }
+    
+    bool UIConfigManager::startWatching(std::function<void()> onReloaded) {
+        stopWatching();
+        watcher.reset(new FileWatcher());
+        std::string fallbackPath = configFilePath;
+        // reloadConfig()と同じく元のファイル（../assets/config/ui_config.json）を優先して読み込む
+        return watcher->start({"../assets/config/ui_config.json", "assets/config/ui_config.json"}, [this, onReloaded, fallbackPath]() {
+            // 解析は監視用のスレッドで新しいスナップショットに行い、描画中の設定には触れない
+            std::string path = selectConfigPath(fallbackPath);
+            nlohmann::json document;
+            std::string foundPath;
+            std::shared_ptr<const UIConfigSnapshot> base = std::atomic_load(&snapshot);
+            std::shared_ptr<UIConfigSnapshot> next = std::make_shared<UIConfigSnapshot>();
+            std::array<bool, SECTION_COUNT> changed;
+            if (path.empty() || !readConfigDocument(path, document, foundPath) ||
+                !buildSnapshot(document, base.get(), *next, changed)) {
+                printf("UI Config: Reload failed, keeping current values\n");
+                return;
+            }
+            // 保存し直しただけで内容が変わっていない場合は知らせない
+            if (std::none_of(changed.begin(), changed.end(), [](bool sectionChanged) { return sectionChanged; })) {
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock(reloadMutex);
+                pendingSnapshot = next;
+                pendingBase = base;
+                pendingChanged = changed;
+                pendingFilePath = foundPath;
+            }
+            if (onReloaded) {
+                onReloaded();
+            }
+        });
+    }
+    
+    void UIConfigManager::stopWatching() {
+        if (watcher) {
+            watcher->stop();
+            watcher.reset();
         }
-        
-        if (lastFileModificationTime == 0 && currentModTime > 0) {
-            lastFileModificationTime = currentModTime;
+        std::lock_guard<std::mutex> lock(reloadMutex);
+        pendingSnapshot.reset();
+        pendingBase.reset();
+        pendingFilePath.clear();
+    }
+    
+    bool UIConfigManager::applyPendingReload() {
+        std::shared_ptr<UIConfigSnapshot> next;
+        std::shared_ptr<const UIConfigSnapshot> base;
+        std::array<bool, SECTION_COUNT> changed;
+        std::string path;
+        {
+            std::lock_guard<std::mutex> lock(reloadMutex);
+            next.swap(pendingSnapshot);
+            base.swap(pendingBase);
+            changed = pendingChanged;
+            path.swap(pendingFilePath);
         }
-        
-        return false;
+        if (!next) {
+            return false;
+        }
+        // 差分の基準にした設定が、その後に読み込み直されていた場合は全てのセクションを変更扱いにする
+        if (base != snapshot) {
+            changed.fill(true);
+        }
+        configFilePath = path;
+        configLoaded = true;
+        publishSnapshot(next, changed);
+        printf("UI Config: Reload applied from %s (%d sections changed)\n", configFilePath.c_str(),
+               static_cast<int>(std::count(changed.begin(), changed.end(), true)));
+        return true;
+    }
+    
+    void UIConfigManager::publishSnapshot(std::shared_ptr<UIConfigSnapshot> next, const std::array<bool, SECTION_COUNT>& changed) {
+        const UIConfigSnapshot* current = snapshot.get();
+        next->generation = current ? current->generation + 1 : 0;
+        for (size_t i = 0; i < SECTION_COUNT; i++) {
+            next->sectionGenerations[i] = (!current || changed[i]) ? next->generation : current->sectionGenerations[i];
+        }
+        // 監視用のスレッドも差分の基準として読むため、入れ替えはアトミックに行う
+        std::atomic_store(&snapshot, std::shared_ptr<const UIConfigSnapshot>(std::move(next)));
     }
     
     void UIConfigManager::calculatePosition(int& x, int& y, const UIPosition& pos, int windowWidth, int windowHeight) const {
@@ -1877,5 +1537,43 @@ namespace UIConfig {
             y = static_cast<int>(pos.absoluteY);
         }
     }
+    
+    void UIConfigManager::resolveLayout(int windowWidth, int windowHeight) {
+        const UIConfigSnapshot& config = *snapshot;
+        auto resolve = [&](UILayoutId id, const UIPosition& pos, int width, int height) {
+            UIResolvedRect& rect = resolvedLayout[static_cast<size_t>(id)];
+            calculatePosition(rect.x, rect.y, pos, windowWidth, windowHeight);
+            rect.width = width;
+            rect.height = height;
+        };
+        
+        const UICommonUIConfig& common = config.commonUIConfig;
+        resolve(UILayoutId::NIGHT_TIMER, common.nightTimer.position, common.nightTimer.width, common.nightTimer.height);
+        resolve(UILayoutId::NIGHT_TIMER_TEXT, common.nightTimerText.position, 0, 0);
+        resolve(UILayoutId::TARGET_LEVEL, common.targetLevel.position, common.targetLevel.width, common.targetLevel.height);
+        resolve(UILayoutId::TARGET_LEVEL_TEXT, common.targetLevelText.position, 0, 0);
+        resolve(UILayoutId::TRUST_LEVELS, common.trustLevels.position, common.trustLevels.width, common.trustLevels.height);
+        resolve(UILayoutId::TRUST_LEVELS_TEXT, common.trustLevelsText.position, 0, 0);
+        resolve(UILayoutId::GAME_CONTROLLER_STATUS, common.gameControllerStatus.position,
+                common.gameControllerStatus.width, common.gameControllerStatus.height);
+        
+        const UIMessageBoardConfig& messageBoard = config.messageBoardConfig;
+        resolve(UILayoutId::MESSAGE_BOARD_BACKGROUND, messageBoard.background.position,
+                messageBoard.background.width, messageBoard.background.height);
+        resolve(UILayoutId::MESSAGE_BOARD_TEXT, messageBoard.text.position, 0, 0);
+        
+        const UIBattleConfig& battle = config.battleConfig;
+        resolve(UILayoutId::BATTLE_PLAYER, battle.playerPosition, battle.playerWidth, battle.playerHeight);
+        resolve(UILayoutId::BATTLE_ENEMY, battle.enemyPosition, battle.enemyWidth, battle.enemyHeight);
+        resolve(UILayoutId::BATTLE_LOG, battle.battleLog.position, 0, 0);
+        resolve(UILayoutId::BATTLE_PLAYER_STATUS, battle.playerStatus.position, 0, 0);
+        resolve(UILayoutId::BATTLE_ENEMY_STATUS, battle.enemyStatus.position, 0, 0);
+        resolve(UILayoutId::BATTLE_MESSAGE, battle.message.position, 0, 0);
+        resolve(UILayoutId::BATTLE_EXPLANATION_TEXT, battle.explanationMessageBoard.text.position, 0, 0);
+        resolve(UILayoutId::BATTLE_ROCK_PAPER_SCISSORS, battle.rockPaperScissors.position, battle.rockPaperScissors.width, 0);
+        
+        layoutGeneration = config.generation;
+        layoutWidth = windowWidth;
+        layoutHeight = windowHeight;
+    }
 }
-
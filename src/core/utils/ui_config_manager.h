@@ -8,7 +8,15 @@
 
 #include <SDL.h>
 #include <string>
+#include <array>
 #include <ctime>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <nlohmann/json.hpp>
+
+class FileWatcher;
 
 /**
  * @brief UI設定管理の名前空間
@@ -389,6 +397,89 @@ namespace UIConfig {
         UITextConfig monsterLevel;                 // モンスターレベル表示
     };
     
+    /**
+     * @brief ui_config.jsonのセクション（最上位のキー）
+     * @details 再読み込みはセクション単位で行い、内容が変わったセクションだけを設定し直す。
+     */
+    enum class UIConfigSection {
+        MESSAGE_BOARD,  /**< @brief messageBoard */
+        COMMON_UI,      /**< @brief commonUI */
+        MAIN_MENU,      /**< @brief mainMenu */
+        BATTLE,         /**< @brief battle */
+        ROOM,           /**< @brief room */
+        TOWN,           /**< @brief town */
+        CASTLE,         /**< @brief castle */
+        DEMON_CASTLE,   /**< @brief demonCastle */
+        GAME_OVER,      /**< @brief gameOver */
+        ENDING,         /**< @brief ending */
+        NIGHT,          /**< @brief night */
+        FIELD,          /**< @brief field */
+        COUNT
+    };
+    
+    constexpr size_t SECTION_COUNT = static_cast<size_t>(UIConfigSection::COUNT);
+    
+    /**
+     * @brief UI設定のスナップショット
+     * @details 読み込みごとに新しく作り、公開後は変更しない。保持している間は再読み込みがあっても内容が変わらない。
+     */
+    struct UIConfigSnapshot {
+        uint64_t generation = 0;  // 設定を読み込んだ回数（起動時のデフォルト値は0）
+        std::array<uint64_t, SECTION_COUNT> sectionGenerations = {};  // セクションごとの最後に変わった世代
+        std::array<uint64_t, SECTION_COUNT> sectionHashes = {};  // セクションごとのJSONのハッシュ（次の再読み込みで差分を取るため）
+        bool hasSectionHashes = false;  // sectionHashesが設定されているか（デフォルト値のみの場合はfalse）
+        UIMessageBoardConfig messageBoardConfig;
+        UICommonUIConfig commonUIConfig;
+        UIMainMenuConfig mainMenuConfig;
+        UIBattleConfig battleConfig;
+        UIRoomConfig roomConfig;
+        UITownConfig townConfig;
+        UICastleConfig castleConfig;
+        UIDemonCastleConfig demonCastleConfig;
+        UIGameOverConfig gameOverConfig;
+        UIEndingConfig endingConfig;
+        UINightConfig nightConfig;
+        UIFieldConfig fieldConfig;
+    };
+    
+    /**
+     * @brief 解決済みのレイアウトを引くための要素ID
+     * @details 毎フレーム描画する要素のみを対象とする。
+     */
+    enum class UILayoutId {
+        // CommonUI
+        NIGHT_TIMER,
+        NIGHT_TIMER_TEXT,
+        TARGET_LEVEL,
+        TARGET_LEVEL_TEXT,
+        TRUST_LEVELS,
+        TRUST_LEVELS_TEXT,
+        GAME_CONTROLLER_STATUS,
+        // 共通のメッセージボード（FieldState、TownState、NightState）
+        MESSAGE_BOARD_BACKGROUND,
+        MESSAGE_BOARD_TEXT,
+        // BattleState
+        BATTLE_PLAYER,
+        BATTLE_ENEMY,
+        BATTLE_LOG,
+        BATTLE_PLAYER_STATUS,
+        BATTLE_ENEMY_STATUS,
+        BATTLE_MESSAGE,
+        BATTLE_EXPLANATION_TEXT,
+        BATTLE_ROCK_PAPER_SCISSORS,
+        COUNT
+    };
+    
+    /**
+     * @brief 画面上の位置とサイズ（ピクセル）
+     */
+    struct UIResolvedRect {
+        int x = 0;
+        int y = 0;
+        int width = 0;   // テキストなど、サイズを持たない要素は0
+        int height = 0;
+    };
+    
     /**
      * @brief UI設定管理を担当するクラス
      * @details UI設定の読み込み、保存、取得を管理する。シングルトンパターンを使用。
@@ -414,82 +505,121 @@ namespace UIConfig {
         void reloadConfig();
         
         /**
-         * @brief ファイル変更をチェックして再読み込み
-         * @return 再読み込みが実行されたか
+         * @brief 設定ファイルの監視の開始
+         * @details 変更を検出すると監視用のスレッドで設定を読み込み、onReloadedを呼び出す。
+         * 読み込んだ設定はapplyPendingReload()を呼ぶまで反映しない。
+         * @param onReloaded 読み込みの完了時に監視用のスレッドから呼び出すコールバック
+         * @return 監視を開始できたか
          */
-        bool checkAndReloadConfig();
+        bool startWatching(std::function<void()> onReloaded);
+        
+        /**
+         * @brief 設定ファイルの監視の停止
+         */
+        void stopWatching();
+        
+        /**
+         * @brief 監視用のスレッドで読み込んだ設定の反映（メインスレッドのフレームの区切りで呼び出す）
+         * @return 設定を反映したか
+         */
+        bool applyPendingReload();
+        
+        /**
+         * @brief 設定の世代の取得
+         * @details 設定を読み込むたびに増える。各Stateは前回の値と比べてUIを作り直すかを判断する。
+         * @return 世代
+         */
+        uint64_t getGeneration() const { return snapshot->generation; }
+        
+        /**
+         * @brief セクションの世代の取得
+         * @details そのセクションの内容が変わった再読み込みでのみ増える。
+         * @param section セクション
+         * @return 世代
+         */
+        uint64_t getGeneration(UIConfigSection section) const {
+            return snapshot->sectionGenerations[static_cast<size_t>(section)];
+        }
+        
+        /**
+         * @brief 現在のスナップショットの取得
+         * @details 各getXXXConfig()の参照は次の再読み込み（フレームの先頭）まで有効。
+         * フレームをまたいで設定を保持する場合はこちらを使う。
+         * @return スナップショット
+         */
+        std::shared_ptr<const UIConfigSnapshot> getSnapshot() const { return snapshot; }
         
         /**
          * @brief メッセージボード設定の取得
          * @return メッセージボード設定
          */
-        UIMessageBoardConfig getMessageBoardConfig() const { return messageBoardConfig; }
+        const UIMessageBoardConfig& getMessageBoardConfig() const { return snapshot->messageBoardConfig; }
         
         /**
          * @brief 共通UI設定の取得
          * @return 共通UI設定
          */
-        UICommonUIConfig getCommonUIConfig() const { return commonUIConfig; }
+        const UICommonUIConfig& getCommonUIConfig() const { return snapshot->commonUIConfig; }
         
         /**
          * @brief メインメニュー設定の取得
          * @return メインメニュー設定
          */
-        UIMainMenuConfig getMainMenuConfig() const { return mainMenuConfig; }
+        const UIMainMenuConfig& getMainMenuConfig() const { return snapshot->mainMenuConfig; }
         
         /**
          * @brief 戦闘設定の取得
          * @return 戦闘設定
          */
-        UIBattleConfig getBattleConfig() const { return battleConfig; }
+        const UIBattleConfig& getBattleConfig() const { return snapshot->battleConfig; }
         
         /**
          * @brief 部屋設定の取得
          * @return 部屋設定
          */
-        UIRoomConfig getRoomConfig() const { return roomConfig; }
+        const UIRoomConfig& getRoomConfig() const { return snapshot->roomConfig; }
         
         /**
          * @brief 街設定の取得
          * @return 街設定
          */
-        UITownConfig getTownConfig() const { return townConfig; }
+        const UITownConfig& getTownConfig() const { return snapshot->townConfig; }
         
         /**
          * @brief 城設定の取得
          * @return 城設定
          */
-        UICastleConfig getCastleConfig() const { return castleConfig; }
+        const UICastleConfig& getCastleConfig() const { return snapshot->castleConfig; }
         
         /**
          * @brief 魔王の城設定の取得
          * @return 魔王の城設定
          */
-        UIDemonCastleConfig getDemonCastleConfig() const { return demonCastleConfig; }
+        const UIDemonCastleConfig& getDemonCastleConfig() const { return snapshot->demonCastleConfig; }
         
         /**
          * @brief ゲームオーバー設定の取得
          * @return ゲームオーバー設定
          */
-        UIGameOverConfig getGameOverConfig() const { return gameOverConfig; }
+        const UIGameOverConfig& getGameOverConfig() const { return snapshot->gameOverConfig; }
         
         /**
          * @brief エンディング設定の取得
          * @return エンディング設定
          */
-        UIEndingConfig getEndingConfig() const { return endingConfig; }
+        const UIEndingConfig& getEndingConfig() const { return snapshot->endingConfig; }
         
         /**
          * @brief 夜設定の取得
          * @return 夜設定
          */
-        UINightConfig getNightConfig() const { return nightConfig; }
+        const UINightConfig& getNightConfig() const { return snapshot->nightConfig; }
         
         /**
          * @brief フィールド設定の取得
          * @return フィールド設定
          */
-        UIFieldConfig getFieldConfig() const { return fieldConfig; }
+        const UIFieldConfig& getFieldConfig() const { return snapshot->fieldConfig; }
         
         /**
          * @brief 位置を計算（ウィンドウサイズを考慮）
@@ -501,16 +631,31 @@ namespace UIConfig {
          */
         void calculatePosition(int& x, int& y, const UIPosition& pos, int windowWidth, int windowHeight) const;
         
+        /**
+         * @brief 解決済みのレイアウトの取得
+         * @details 設定の世代と画面サイズが前回と同じ間は、計算済みの値をそのまま返す。
+         * @param id 要素ID
+         * @param windowWidth ウィンドウ幅
+         * @param windowHeight ウィンドウ高さ
+         * @return 位置とサイズ（次に設定か画面サイズが変わるまで有効）
+         */
+        const UIResolvedRect& getLayout(UILayoutId id, int windowWidth, int windowHeight) {
+            if (snapshot->generation != layoutGeneration || windowWidth != layoutWidth || windowHeight != layoutHeight) {
+                resolveLayout(windowWidth, windowHeight);
+            }
+            return resolvedLayout[static_cast<size_t>(id)];
+        }
+        
     private:
         /**
          * @brief コンストラクタ（private、シングルトンパターン）
          */
-        UIConfigManager() = default;
+        UIConfigManager();
         
         /**
          * @brief デストラクタ（private、シングルトンパターン）
          */
-        ~UIConfigManager() = default;
+        ~UIConfigManager();
         
         /**
          * @brief コピーコンストラクタ（削除、シングルトンパターン）
@@ -524,32 +669,130 @@ namespace UIConfig {
         
         /**
          * @brief デフォルト値の設定
+         * @param config 設定先
          */
-        void setDefaultValues();
+        static void setDefaultValues(UIConfigSnapshot& config);
+        
+        /**
+         * @brief 設定ファイルの検索
+         * @param filepath 設定ファイルパス（"../"の有無を入れ替えたパスも試す）
+         * @return 見つかった空でないファイルのパス（見つからない場合は空）
+         */
+        static std::string findConfigFile(const std::string& filepath);
+        
+        /**
+         * @brief 設定ファイルの読み込み（メンバーに触れないため、監視用のスレッドからも呼び出せる）
+         * @param filepath 設定ファイルパス
+         * @param document 読み込んだJSONの格納先
+         * @param foundPath 実際に読み込んだパス（見つからない場合は空）
+         * @return 読み込みが成功したか
+         */
+        static bool readConfigDocument(const std::string& filepath, nlohmann::json& document, std::string& foundPath);
+        
+        /**
+         * @brief 対応表に従ったスナップショットの作成（監視用のスレッドからも呼び出せる）
+         * @details baseとJSONのハッシュが同じセクションはbaseからコピーし、変わったセクションだけをデフォルト値から設定し直す。
+         * @param document 読み込んだJSON
+         * @param base 差分の基準にする設定（nullptrの場合は全てのセクションを設定する）
+         * @param config 作成先
+         * @param changed セクションごとの変更の有無の格納先
+         * @return 作成が成功したか
+         */
+        static bool buildSnapshot(const nlohmann::json& document, const UIConfigSnapshot* base, UIConfigSnapshot& config,
+                                  std::array<bool, SECTION_COUNT>& changed);
+        
+        /**
+         * @brief デフォルト値のスナップショットの取得
+         * @return デフォルト値（初回の呼び出しで作成する）
+         */
+        static const UIConfigSnapshot& getDefaultSnapshot();
+        
+        /**
+         * @brief バイナリキャッシュの形式のハッシュの取得
+         * @details 対応表とデフォルト値から計算する。コードが変わると値が変わり、以前のキャッシュは使われない。
+         * @return ハッシュ
+         */
+        static uint64_t getCacheLayoutHash();
+        
+        /**
+         * @brief バイナリキャッシュの読み込み
+         * @details 元のJSONを解析した結果（対応表の全てのメンバーの値）を保存したもの。
+         * sourceHashがnullptrの場合はサイズと更新時刻、それ以外はサイズと内容のハッシュで元のJSONと一致するかを確認する。
+         * @param cachePath キャッシュのパス
+         * @param sourceSize 元のJSONのサイズ
+         * @param sourceMtime 元のJSONの更新時刻
+         * @param sourceHash 元のJSONの内容のハッシュ（読み込んでいない場合はnullptr）
+         * @param config 読み込み先（失敗した場合は変更しない）
+         * @return キャッシュが有効で、読み込めたか
+         */
+        static bool readConfigCache(const std::string& cachePath, uint64_t sourceSize, int64_t sourceMtime,
+                                    const uint64_t* sourceHash, UIConfigSnapshot& config);
+        
+        /**
+         * @brief バイナリキャッシュの書き込み
+         * @param cachePath キャッシュのパス
+         * @param sourceSize 元のJSONのサイズ
+         * @param sourceMtime 元のJSONの更新時刻（読み込む前に取得したもの）
+         * @param sourceHash 元のJSONの内容のハッシュ
+         * @param config 保存する設定
+         * @return 書き込めたか
+         */
+        static bool writeConfigCache(const std::string& cachePath, uint64_t sourceSize, int64_t sourceMtime,
+                                     uint64_t sourceHash, const UIConfigSnapshot& config);
+        
+        /**
+         * @brief 再読み込みするファイルの選択
+         * @param fallbackPath どちらの候補も見つからない場合に使うパス
+         * @return 読み込むファイルのパス
+         */
+        static std::string selectConfigPath(const std::string& fallbackPath);
+        
+        /**
+         * @brief 新しいスナップショットの公開（世代を1つ進める）
+         * @param next 公開するスナップショット
+         * @param changed セクションごとの変更の有無（変わっていないセクションは世代を引き継ぐ）
+         */
+        void publishSnapshot(std::shared_ptr<UIConfigSnapshot> next, const std::array<bool, SECTION_COUNT>& changed);
+        
+        /**
+         * @brief 全ての要素のレイアウトの計算
+         * @param windowWidth ウィンドウ幅
+         * @param windowHeight ウィンドウ高さ
+         */
+        void resolveLayout(int windowWidth, int windowHeight);
         
         /**
          * @brief ファイルの更新時刻の取得
          * @param filepath ファイルパス
          * @return ファイルの更新時刻
          */
-        time_t getFileModificationTime(const std::string& filepath) const;
+        static time_t getFileModificationTime(const std::string& filepath);
+        
+        /**
+         * @brief ファイルのサイズと更新時刻の取得
+         * @param filepath ファイルパス
+         * @param size サイズの格納先
+         * @param mtime 更新時刻の格納先
+         * @return 取得できたか
+         */
+        static bool getFileStamp(const std::string& filepath, uint64_t& size, int64_t& mtime);
         
         std::string configFilePath;
         bool configLoaded = false;
-        time_t lastFileModificationTime = 0;  // ファイル監視用
-        
-        // UI設定
-        UIMessageBoardConfig messageBoardConfig;
-        UICommonUIConfig commonUIConfig;
-        UIMainMenuConfig mainMenuConfig;
-        UIBattleConfig battleConfig;
-        UIRoomConfig roomConfig;
-        UITownConfig townConfig;
-        UICastleConfig castleConfig;
-        UIDemonCastleConfig demonCastleConfig;
-        UIGameOverConfig gameOverConfig;
-        UIEndingConfig endingConfig;
-        UINightConfig nightConfig;
-        UIFieldConfig fieldConfig;
+        std::shared_ptr<const UIConfigSnapshot> snapshot;  // 現在の設定（メインスレッドでのみ入れ替え、監視用のスレッドはatomic_loadで読む）
+        
+        // 解決済みのレイアウト（設定の世代と画面サイズが変わった時だけ計算し直す）
+        std::array<UIResolvedRect, static_cast<size_t>(UILayoutId::COUNT)> resolvedLayout;
+        uint64_t layoutGeneration = UINT64_MAX;
+        int layoutWidth = -1;
+        int layoutHeight = -1;
+        
+        // ファイル監視用
+        std::unique_ptr<FileWatcher> watcher;
+        std::mutex reloadMutex;                               // pendingSnapshotの受け渡し用
+        std::shared_ptr<UIConfigSnapshot> pendingSnapshot;    // 監視用のスレッドで読み込み、まだ反映していない設定
+        std::shared_ptr<const UIConfigSnapshot> pendingBase;  // pendingSnapshotの差分の基準にした設定
+        std::array<bool, SECTION_COUNT> pendingChanged = {};
+        std::string pendingFilePath;
     };
 }
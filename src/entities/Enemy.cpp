@@ -1,6 +1,6 @@
 #include "Enemy.h"
+#include "../core/Random.h"
 #include <iostream>
-#include <random>
 
 Enemy::Enemy(EnemyType type) : Character("", 0, 0, 0, 0, 1), type(type), canCastMagic(false), magicDamage(0), residentTextureIndex(-1), residentX(-1), residentY(-1), baseLevel(1), baseHp(0), baseAttack(0), baseDefense(0) {
     switch (type) {
@@ -343,6 +343,13 @@ std::string Enemy::getTypeName() const {
     }
 }
 
+std::string Enemy::getTextureName() const {
+    if (isResident()) {
+        return "resident_" + std::to_string(residentTextureIndex + 1);
+    }
+    return "enemy_" + getTypeName();
+}
+
 int Enemy::performAction(Character& target) {
     if (!isAlive) return 0;
     
@@ -351,8 +358,7 @@ int Enemy::performAction(Character& target) {
 }
 
 Enemy Enemy::createRandomEnemy(int playerLevel) {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
+    RandomGenerator& gen = Random::get(RandomStream::ENCOUNTER);
     
     std::vector<EnemyType> possibleEnemies;
     
@@ -437,8 +443,7 @@ Enemy Enemy::createRandomEnemy(int playerLevel) {
         possibleEnemies.push_back(EnemyType::ELDER_GOD);
     }
     
-    std::uniform_int_distribution<> dis(0, possibleEnemies.size() - 1);
-    EnemyType selectedType = possibleEnemies[dis(gen)];
+    EnemyType selectedType = possibleEnemies[gen.nextInt(0, possibleEnemies.size() - 1)];
     
     return Enemy(selectedType);
 }
@@ -597,10 +602,8 @@ Enemy Enemy::createTargetLevelEnemy(int targetLevel) {
     }
     
     // 可能な敵の中からランダムに選ぶ（複数ある場合）
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dis(0, possibleEnemies.size() - 1);
-    EnemyType selectedType = possibleEnemies[dis(gen)];
+    RandomGenerator& gen = Random::get(RandomStream::ENCOUNTER);
+    EnemyType selectedType = possibleEnemies[gen.nextInt(0, possibleEnemies.size() - 1)];
     
     // 敵を生成して目標レベルに設定
     Enemy enemy(selectedType);
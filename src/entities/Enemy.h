@@ -128,6 +128,14 @@ public:
      */
     std::string getTypeName() const;
     
+    /**
+     * @brief 描画に使用するテクスチャ名の取得
+     * @details 住民の場合は"resident_N"、それ以外は"enemy_" + 種類名を返す。
+     * 描画側はこの名前をGraphics::getTextureId()で一度だけ解決して保持する。
+     * @return テクスチャ名
+     */
+    std::string getTextureName() const;
+    
     /**
      * @brief ボス敵かどうかの判定
      * @return ボス敵かどうか
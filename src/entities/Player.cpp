@@ -1,8 +1,9 @@
 #include "Player.h"
 #include "../game/TownState.h"
 #include "../core/GameState.h"
+#include "../core/Trace.h"
+#include "../core/Random.h"
 #include <iostream>
-#include <random>
 #include <fstream>
 #include <vector>
 #include <nlohmann/json.hpp>
@@ -14,7 +15,7 @@ Player::Player(const std::string& name)
       playerStats(std::make_unique<PlayerStats>()),
       playerStory(std::make_unique<PlayerStory>(name)),
       playerTrust(std::make_unique<PlayerTrust>(50, true)),
-      savedGameState(nullptr), savedGameOverExit(false),
+      savedGameState(nullptr), savedRandomState(nullptr), savedGameOverExit(false),
       isNightTime(false), currentNight(0),
             hasSeenTownExplanation(false),
             hasSeenFieldExplanation(false),
@@ -191,15 +192,13 @@ int Player::getEffectiveDefense() const {
 int Player::attack(Character& target) {
     if (!isAlive) return 0;
     
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::uniform_int_distribution<> criticalDis(1, 100);
+    RandomGenerator& gen = Random::get(RandomStream::BATTLE);
     
     int baseDamage = calculateDamage(target);
     int damage = baseDamage;
     bool isCritical = false;
     
-    if (criticalDis(gen) <= 8) {
+    if (gen.nextInt(1, 100) <= 8) {
         damage = baseDamage * 2;
         isCritical = true;
     } else {
@@ -226,11 +225,9 @@ void Player::defend() {
 }
 
 bool Player::tryToEscape() {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dis(1, 100);
+    RandomGenerator& gen = Random::get(RandomStream::BATTLE);
     
-    bool escaped = dis(gen) <= 70; // 70%の確率で逃走成功
+    bool escaped = gen.nextInt(1, 100) <= 70; // 70%の確率で逃走成功
     return escaped;
 }
 
@@ -245,6 +242,7 @@ void Player::toggleNightTime() {
 // 新しいパラメータ変更メソッド
 
 void Player::saveGame(const std::string& filename, float nightTimer, bool nightTimerActive) {
+    TRACE_SCOPE("Player::saveGame");
     // assets/saves/ディレクトリに保存
     std::string savePath = "assets/saves/" + filename;
     nlohmann::json j;
@@ -313,6 +311,9 @@ void Player::saveGame(const std::string& filename, float nightTimer, bool nightT
     j["targetLevel"] = TownState::s_targetLevel;
     j["nightCount"] = TownState::s_nightCount;
     
+    // 乱数列の状態（ロード後も同じ乱数列で続ける）
+    j["random"] = Random::getInstance().toJson();
+    
     // ゲーム状態情報（外部から設定される）
     if (savedGameState) {
         j["gameState"] = *savedGameState;
@@ -463,6 +464,13 @@ bool Player::loadGame(const std::string& filename, float& nightTimer, bool& nigh
         if (j.contains("targetLevel")) TownState::s_targetLevel = j["targetLevel"];
         if (j.contains("nightCount")) TownState::s_nightCount = j["nightCount"];
         
+        // 乱数列の状態（復元はrestoreRandomState()で行う）
+        if (j.contains("random")) {
+            savedRandomState = std::make_unique<nlohmann::json>(j["random"]);
+        } else {
+            savedRandomState.reset();
+        }
+        
         // ゲーム状態情報
         if (j.contains("gameState") && !j["gameState"].is_null()) {
             savedGameState = std::make_unique<nlohmann::json>(j["gameState"]);
@@ -520,6 +528,14 @@ const nlohmann::json* Player::getSavedGameState() const {
     return savedGameState.get();
 }
 
+bool Player::restoreRandomState() {
+    // 古いセーブデータには含まれないため、その場合は現在の乱数列を使い続ける
+    if (!savedRandomState) {
+        return false;
+    }
+    return Random::getInstance().fromJson(*savedRandomState);
+}
+
 std::string Player::getSpellName(SpellType spell) {
     switch (spell) {
         case SpellType::HEAL:
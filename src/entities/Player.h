@@ -52,6 +52,9 @@ private:
     // セーブされたゲーム状態（オプショナル）
     std::unique_ptr<nlohmann::json> savedGameState;
     
+    // セーブされた乱数列の状態（起動時の読み込みでのみ復元する）
+    std::unique_ptr<nlohmann::json> savedRandomState;
+    
     // ゲームオーバーからの終了フラグ（オプショナル）
     bool savedGameOverExit;
     
@@ -541,6 +544,14 @@ public:
      */
     const nlohmann::json* getSavedGameState() const;
     
+    /**
+     * @brief セーブされた乱数列の状態の復元
+     * @details loadGame()では復元しないため、起動時の読み込みの後にのみ呼び出す。
+     * ゲームオーバーからの再挑戦などで呼び出すと、前回と同じ乱数列が繰り返される。
+     * @return 復元したか（セーブデータに含まれない場合はfalse）
+     */
+    bool restoreRandomState();
+    
     /**
      * @brief ゲームオーバーからの終了フラグの設定
      * @param gameOverExit ゲームオーバーからの終了かどうか
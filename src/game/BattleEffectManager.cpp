@@ -1,5 +1,6 @@
 #include "BattleEffectManager.h"
-#include <random>
+#include "../core/FrameProfiler.h"
+#include "../core/Random.h"
 #include <cmath>
 #include <algorithm>
 
@@ -18,26 +19,27 @@ void BattleEffectManager::triggerHitEffect(int damage, float x, float y, bool is
     effect.rotation = 0.0f;
     effect.alpha = 255.0f;
     
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::uniform_real_distribution<float> angleDis(0.0f, 3.14159f * 2.0f);
-    std::uniform_real_distribution<float> speedDis(50.0f, 200.0f);
-    std::uniform_real_distribution<float> lifeDis(0.3f, 1.0f);
+    const int particleCount = 30;
+    float angles[particleCount];
+    float speeds[particleCount];
+    RandomGenerator& gen = Random::get(RandomStream::EFFECTS);
+    gen.fillFloat(angles, particleCount, 0.0f, 3.14159f * 2.0f);
+    gen.fillFloat(speeds, particleCount, 50.0f, 200.0f);
     
-    for (int i = 0; i < 30; i++) {
-        float angle = angleDis(gen);
-        float speed = speedDis(gen);
-        effect.particlesX.push_back(x);
-        effect.particlesY.push_back(y);
-        effect.particlesVX.push_back(std::cos(angle) * speed);
-        effect.particlesVY.push_back(std::sin(angle) * speed);
-        effect.particlesLife.push_back(lifeDis(gen));
+    effect.particlesX.assign(particleCount, x);
+    effect.particlesY.assign(particleCount, y);
+    effect.particlesLife.resize(particleCount);
+    gen.fillFloat(effect.particlesLife.data(), particleCount, 0.3f, 1.0f);
+    for (int i = 0; i < particleCount; i++) {
+        effect.particlesVX.push_back(std::cos(angles[i]) * speeds[i]);
+        effect.particlesVY.push_back(std::sin(angles[i]) * speeds[i]);
     }
     
     hitEffects.push_back(effect);
 }
 
 void BattleEffectManager::updateHitEffects(float deltaTime) {
+    FrameProfiler::Scope profile(FrameProfiler::Section::BATTLE_EFFECTS);
     for (auto it = hitEffects.begin(); it != hitEffects.end();) {
         it->timer -= deltaTime;
         
@@ -76,6 +78,7 @@ void BattleEffectManager::updateHitEffects(float deltaTime) {
 }
 
 void BattleEffectManager::renderHitEffects(Graphics& graphics) {
+    FrameProfiler::Scope profile(FrameProfiler::Section::BATTLE_EFFECTS);
     int screenWidth = graphics.getScreenWidth();
     int screenHeight = graphics.getScreenHeight();
     
@@ -152,12 +155,11 @@ void BattleEffectManager::triggerScreenShake(float intensity, float duration, bo
 }
 
 void BattleEffectManager::updateScreenShake(float deltaTime) {
+    FrameProfiler::Scope profile(FrameProfiler::Section::BATTLE_EFFECTS);
     if (shakeState.shakeTimer > 0.0f) {
         shakeState.shakeTimer -= deltaTime;
         
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        std::uniform_real_distribution<float> dis(-1.0f, 1.0f);
+        RandomGenerator& gen = Random::get(RandomStream::EFFECTS);
         
         float currentIntensity;
         if (shakeState.isVictoryShake) {
@@ -168,8 +170,8 @@ void BattleEffectManager::updateScreenShake(float deltaTime) {
             currentIntensity = shakeState.shakeIntensity * (shakeState.shakeTimer / (shakeState.shakeTimer + deltaTime));
         }
         
-        shakeState.shakeOffsetX = dis(gen) * currentIntensity;
-        shakeState.shakeOffsetY = dis(gen) * currentIntensity;
+        shakeState.shakeOffsetX = gen.nextFloat(-1.0f, 1.0f) * currentIntensity;
+        shakeState.shakeOffsetY = gen.nextFloat(-1.0f, 1.0f) * currentIntensity;
         
         if (shakeState.shakeTimer <= 0.0f) {
             shakeState.shakeTimer = 0.0f;
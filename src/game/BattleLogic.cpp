@@ -1,6 +1,6 @@
 #include "BattleLogic.h"
 #include "../entities/Enemy.h"
-#include <random>
+#include "../core/Random.h"
 #include <algorithm>
 
 BattleLogic::BattleLogic(std::shared_ptr<Player> player, Enemy* enemy)
@@ -113,9 +113,7 @@ std::vector<BattleLogic::DamageInfo> BattleLogic::prepareDamageList(float damage
             }
         }
     } else if (currentStats.enemyWins > currentStats.playerWins) {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        std::uniform_int_distribution<> skillDis(0, 99);
+        RandomGenerator& gen = Random::get(RandomStream::BATTLE);
         
         for (int i = 0; i < commandTurnCount; i++) {
             if (judgeRound(playerCommands[i], enemyCommands[i]) == BattleConstants::JUDGE_RESULT_ENEMY_WIN) {
@@ -224,13 +222,11 @@ void BattleLogic::generateEnemyCommands() {
             break;
     }
     
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dis(0, 99);
+    RandomGenerator& gen = Random::get(RandomStream::BATTLE);
     
     for (int i = 0; i < commandTurnCount; i++) {
         int cmd;
-        int randVal = dis(gen);
+        int randVal = gen.nextInt(0, 99);
         
         if (randVal < attackProb) {
             cmd = BattleConstants::COMMAND_ATTACK;
@@ -272,11 +268,9 @@ bool BattleLogic::checkThreeWinStreak() const {
 }
 
 void BattleLogic::determineEnemyBehaviorType() {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dis(0, 2);
+    RandomGenerator& gen = Random::get(RandomStream::BATTLE);
     
-    int typeIndex = dis(gen);
+    int typeIndex = gen.nextInt(0, 2);
     switch (typeIndex) {
         case 0:
             enemyBehaviorType = EnemyBehaviorType::ATTACK_TYPE;
@@ -302,8 +296,7 @@ void BattleLogic::determineEnemyBehaviorType() {
         }
     }
     
-    std::uniform_int_distribution<> excludeDis(0, static_cast<int>(options.size()) - 1);
-    excludedBehaviorType = options[excludeDis(gen)];
+    excludedBehaviorType = options[gen.nextInt(0, static_cast<int>(options.size()) - 1)];
 }
 
 void BattleLogic::confirmBehaviorType() {
@@ -2,6 +2,7 @@
 #include "BattleState.h" // BattlePhase enum定義のため
 #include "../entities/Player.h"
 #include "../entities/Enemy.h"
+#include "../core/Trace.h"
 
 BattlePhaseManager::BattlePhaseManager(BattleLogic* battleLogic, Player* player, Enemy* enemy)
     : battleLogic(battleLogic), player(player), enemy(enemy) {
@@ -9,6 +10,7 @@ BattlePhaseManager::BattlePhaseManager(BattleLogic* battleLogic, Player* player,
 
 BattlePhaseManager::PhaseTransitionResult BattlePhaseManager::updatePhase(
     const PhaseUpdateContext& context, float deltaTime) {
+    TRACE_SCOPE("BattlePhaseManager::updatePhase");
     
     PhaseTransitionResult result;
     result.shouldTransition = false;
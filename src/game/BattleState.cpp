@@ -9,10 +9,12 @@
 #include "../ui/CommonUI.h"
 #include "../core/utils/ui_config_manager.h"
 #include "../core/AudioManager.h"
+#include "../core/Trace.h"
+#include "../core/FrameArena.h"
+#include "../core/Random.h"
 #include <sstream>
-#include <random>
-#include <chrono>
 #include <cmath> // abs関数のために追加
+#include <algorithm>
 #include <iostream> // デバッグ情報のために追加
 #include <nlohmann/json.hpp>
 
@@ -36,7 +38,8 @@ BattleState::BattleState(std::shared_ptr<Player> player, std::unique_ptr<Enemy>
       residentAttackFailed(false),
       residentHitCount(0),
       showGameExplanation(false), explanationStep(0),
-      explanationMessageBoard(nullptr) {
+      explanationMessageBoard(nullptr),
+      renderHandlesEnemy(nullptr), renderHandlesResolved(false) {
     
     battle = std::make_unique<Battle>(player.get(), this->enemy.get());
     
@@ -529,15 +532,20 @@ void BattleState::update(float deltaTime) {
 }
 
 void BattleState::render(Graphics& graphics) {
+    resolveRenderHandles(graphics);
+    
     // ホットリロード対応
-    static bool lastReloadState = false;
     auto& config = UIConfig::UIConfigManager::getInstance();
-    bool currentReloadState = config.checkAndReloadConfig();
+    // このStateが使うセクションが変わった時だけUIを作り直す
+    uint64_t configGeneration = std::max(config.getGeneration(UIConfig::UIConfigSection::BATTLE),
+                                         config.getGeneration(UIConfig::UIConfigSection::MESSAGE_BOARD));
+    static uint64_t lastConfigGeneration = configGeneration;
+    bool configReloaded = configGeneration != lastConfigGeneration;
     
     bool uiJustInitialized = false;
     // フォントが読み込まれている場合のみUIをセットアップ
-    if (graphics.getFont("default")) {
-        if (!battleLogLabel || (!lastReloadState && currentReloadState)) {
+    if (graphics.getFont(defaultFont)) {
+        if (!battleLogLabel || configReloaded) {
             setupUI(graphics);
             uiJustInitialized = true;
         }
@@ -549,10 +557,10 @@ void BattleState::render(Graphics& graphics) {
             fontWarningShown = true;
         }
     }
-    lastReloadState = currentReloadState;
+    lastConfigGeneration = configGeneration;
     
     // フォントが読み込まれている場合のみBattleUIを作成
-    if (!battleUI && graphics.getFont("default")) {
+    if (!battleUI && graphics.getFont(defaultFont)) {
         battleUI = std::make_unique<BattleUI>(&graphics, player, enemy.get(), battleLogic.get(), animationController.get());
     }
     
@@ -609,10 +617,10 @@ void BattleState::render(Graphics& graphics) {
         SDL_Color textColor = {255, 0, 0, 255}; // 赤色
 
         // テキストをテクスチャとして取得
-        SDL_Texture* textTexture = graphics.createTextTexture(text, "default", textColor);
-        if (textTexture) {
-            int textWidth, textHeight;
-            SDL_QueryTexture(textTexture, nullptr, nullptr, &textWidth, &textHeight);
+        TextTexture textTexture = graphics.getTextTexture(text, defaultFont, textColor);
+        if (textTexture.texture) {
+            int textWidth = textTexture.width;
+            int textHeight = textTexture.height;
 
             // 2倍サイズに拡大
             constexpr float scale = 2.0f;
@@ -636,9 +644,7 @@ void BattleState::render(Graphics& graphics) {
             graphics.drawRect(bgX, bgY, bgWidth, bgHeight, false);
             
             // テキストを描画
-            graphics.drawTexture(textTexture, textX, textY, scaledWidth, scaledHeight);
-            
-            SDL_DestroyTexture(textTexture);
+            graphics.drawTexture(textTexture.texture, textX, textY, scaledWidth, scaledHeight);
         }
         
         graphics.present();
@@ -658,21 +664,14 @@ void BattleState::render(Graphics& graphics) {
         
         // JSONから敵の位置を取得（INTROフェーズでは中央に配置）
         auto& config = UIConfig::UIConfigManager::getInstance();
-        auto battleConfig = config.getBattleConfig();
         
-        int enemyX, enemyY;
-        config.calculatePosition(enemyX, enemyY, battleConfig.enemyPosition, screenWidth, screenHeight);
+        const UIConfig::UIResolvedRect& enemyLayout = config.getLayout(UIConfig::UILayoutId::BATTLE_ENEMY, screenWidth, screenHeight);
+        int enemyX = enemyLayout.x;
+        int enemyY = enemyLayout.y;
         constexpr int BASE_ENEMY_SIZE = 300;
     
     // 住民の場合は住民の画像を使用、それ以外は通常の敵画像を使用
-    SDL_Texture* enemyTexture = nullptr;
-    if (enemy->isResident()) {
-        int textureIndex = enemy->getResidentTextureIndex();
-        std::string textureName = "resident_" + std::to_string(textureIndex + 1);
-        enemyTexture = graphics.getTexture(textureName);
-    } else {
-        enemyTexture = graphics.getTexture("enemy_" + enemy->getTypeName());
-    }
+    SDL_Texture* enemyTexture = graphics.getTexture(enemyTextureId);
     
     if (enemyTexture) {
             // 元の画像サイズを取得してアスペクト比を保持
@@ -709,10 +708,10 @@ void BattleState::render(Graphics& graphics) {
         SDL_Color textColor = {255, 255, 255, 255};
         
         // テキストをテクスチャとして取得
-        SDL_Texture* textTexture = graphics.createTextTexture(appearText, "default", textColor);
-        if (textTexture) {
-            int textWidth, textHeight;
-            SDL_QueryTexture(textTexture, nullptr, nullptr, &textWidth, &textHeight);
+        TextTexture textTexture = graphics.getTextTexture(appearText, defaultFont, textColor);
+        if (textTexture.texture) {
+            int textWidth = textTexture.width;
+            int textHeight = textTexture.height;
             
             // スケールに応じてサイズを調整
             int scaledWidth = static_cast<int>(textWidth * introTextScale);
@@ -735,21 +734,18 @@ void BattleState::render(Graphics& graphics) {
             graphics.drawRect(bgX, bgY, bgWidth, bgHeight, false);
             
             // スケールしたテキストを描画
-            graphics.drawTexture(textTexture, textX, textY, scaledWidth, scaledHeight);
-            
-            SDL_DestroyTexture(textTexture);
+            graphics.drawTexture(textTexture.texture, textX, textY, scaledWidth, scaledHeight);
         }
         
         // フォールバック：通常のテキスト描画（textTextureがnullの場合）
-        if (!textTexture) {
+        if (!textTexture.texture) {
             int textX = enemyX;
             int textY = enemyY + BASE_ENEMY_SIZE / 2 + 40;
             
             // 背景を描画（テキストサイズを取得してから）
-            SDL_Texture* fallbackTexture = graphics.createTextTexture(appearText, "default", textColor);
-            if (fallbackTexture) {
-                int textWidth, textHeight;
-                SDL_QueryTexture(fallbackTexture, nullptr, nullptr, &textWidth, &textHeight);
+            int textWidth = 0;
+            int textHeight = 0;
+            if (graphics.measureText(appearText, defaultFont, textWidth, textHeight)) {
                 
                 constexpr int padding = 8;
                 int bgX = textX - padding;
@@ -761,11 +757,9 @@ void BattleState::render(Graphics& graphics) {
                 graphics.drawRect(bgX, bgY, bgWidth, bgHeight, true);
                 graphics.setDrawColor(255, 255, 255, 255);
                 graphics.drawRect(bgX, bgY, bgWidth, bgHeight, false);
-                
-                SDL_DestroyTexture(fallbackTexture);
             }
             
-            graphics.drawText(appearText, textX, textY, "default", textColor);
+            graphics.drawText(appearText, textX, textY, defaultFont, textColor);
         }
         
         // 夜のタイマーUIを表示
@@ -841,18 +835,15 @@ void BattleState::render(Graphics& graphics) {
         // プレイヤーと敵のキャラクター描画
         auto& charState = animationController->getCharacterState();
         auto& uiConfigManager = UIConfig::UIConfigManager::getInstance();
-        auto battleConfig = uiConfigManager.getBattleConfig();
         
-        int playerBaseX, playerBaseY;
-        uiConfigManager.calculatePosition(playerBaseX, playerBaseY, battleConfig.playerPosition, screenWidth, screenHeight);
+        const UIConfig::UIResolvedRect& playerBaseLayout = uiConfigManager.getLayout(UIConfig::UILayoutId::BATTLE_PLAYER, screenWidth, screenHeight);
+        int playerBaseX = playerBaseLayout.x;
+        int playerBaseY = playerBaseLayout.y;
         int playerX = playerBaseX + (int)charState.playerAttackOffsetX + (int)charState.playerHitOffsetX;
         int playerY = playerBaseY + (int)charState.playerAttackOffsetY + (int)charState.playerHitOffsetY;
         
         // 窮地モードではplayer_adversity.pngを使用
-        SDL_Texture* playerTex = hasUsedLastChanceMode ? graphics.getTexture("player_adversity") : graphics.getTexture("player");
-        if (!playerTex && hasUsedLastChanceMode) {
-            playerTex = graphics.getTexture("player"); // フォールバック
-        }
+        SDL_Texture* playerTex = getPlayerTexture(graphics);
         int playerHeight = BattleConstants::BATTLE_CHARACTER_SIZE;
         if (playerTex) {
             int textureWidth, textureHeight;
@@ -865,21 +856,13 @@ void BattleState::render(Graphics& graphics) {
             }
         }
         
-        int enemyBaseX, enemyBaseY;
-        uiConfigManager.calculatePosition(enemyBaseX, enemyBaseY, battleConfig.enemyPosition, screenWidth, screenHeight);
+        const UIConfig::UIResolvedRect& enemyBaseLayout = uiConfigManager.getLayout(UIConfig::UILayoutId::BATTLE_ENEMY, screenWidth, screenHeight);
+        int enemyBaseX = enemyBaseLayout.x;
+        int enemyBaseY = enemyBaseLayout.y;
         int enemyX = enemyBaseX + (int)charState.enemyAttackOffsetX + (int)charState.enemyHitOffsetX;
         int enemyY = enemyBaseY + (int)charState.enemyAttackOffsetY + (int)charState.enemyHitOffsetY;
         
-        SDL_Texture* enemyTexture = nullptr;
-        if (enemy) {
-            if (enemy->isResident()) {
-                int textureIndex = enemy->getResidentTextureIndex();
-                std::string textureName = "resident_" + std::to_string(textureIndex + 1);
-                enemyTexture = graphics.getTexture(textureName);
-            } else {
-                enemyTexture = graphics.getTexture("enemy_" + enemy->getTypeName());
-            }
-        }
+        SDL_Texture* enemyTexture = enemy ? graphics.getTexture(enemyTextureId) : nullptr;
         
         int enemyHeight = BattleConstants::BATTLE_CHARACTER_SIZE;
         if (enemyTexture) {
@@ -982,7 +965,7 @@ void BattleState::render(Graphics& graphics) {
         if (showGameExplanation && explanationMessageBoard && !explanationMessageBoard->getText().empty()) {
             std::cerr << "[DEBUG] Drawing explanation UI" << std::endl;
             auto& config = UIConfig::UIConfigManager::getInstance();
-            auto mbConfig = config.getMessageBoardConfig();
+            const auto& mbConfig = config.getMessageBoardConfig();
             
             int bgX = 20;  // 左下に配置
             int bgHeight = 60;  // 2行分の高さ
@@ -1043,7 +1026,7 @@ void BattleState::render(Graphics& graphics) {
         
         // UIを描画（説明メッセージボードを含む）
         try {
-            if (graphics.getFont("default") && battleLogLabel && isValidPointer(battleLogLabel)) {
+            if (graphics.getFont(defaultFont) && battleLogLabel && isValidPointer(battleLogLabel)) {
                 ui.render(graphics);
             }
         } catch (const std::exception& e) {
@@ -1083,18 +1066,16 @@ void BattleState::render(Graphics& graphics) {
         // プレイヤーと敵のキャラクター描画（renderResultAnnouncementと同じ構成）
         auto& charState = animationController->getCharacterState();
         auto& config = UIConfig::UIConfigManager::getInstance();
-        auto battleConfig = config.getBattleConfig();
+        const auto& battleConfig = config.getBattleConfig();
         
-        int playerBaseX, playerBaseY;
-        config.calculatePosition(playerBaseX, playerBaseY, battleConfig.playerPosition, screenWidth, screenHeight);
+        const UIConfig::UIResolvedRect& playerBaseLayout = config.getLayout(UIConfig::UILayoutId::BATTLE_PLAYER, screenWidth, screenHeight);
+        int playerBaseX = playerBaseLayout.x;
+        int playerBaseY = playerBaseLayout.y;
         int playerX = playerBaseX + (int)charState.playerAttackOffsetX + (int)charState.playerHitOffsetX;
         int playerY = playerBaseY + (int)charState.playerAttackOffsetY + (int)charState.playerHitOffsetY;
         
         // 窮地モードではplayer_adversity.pngを使用
-        SDL_Texture* playerTex = hasUsedLastChanceMode ? graphics.getTexture("player_adversity") : graphics.getTexture("player");
-        if (!playerTex && hasUsedLastChanceMode) {
-            playerTex = graphics.getTexture("player"); // フォールバック
-        }
+        SDL_Texture* playerTex = getPlayerTexture(graphics);
         
         // 元の画像サイズを取得してアスペクト比を保持（HP表示の位置計算用）
         int playerHeight = BattleConstants::BATTLE_CHARACTER_SIZE;
@@ -1142,10 +1123,9 @@ void BattleState::render(Graphics& graphics) {
         
         SDL_Color textColor = victoryDisplayConfig.textColor;
         
-        SDL_Texture* textTexture = graphics.createTextTexture(victoryText, "default", textColor);
-        if (textTexture) {
-            int textWidth, textHeight;
-            SDL_QueryTexture(textTexture, nullptr, nullptr, &textWidth, &textHeight);
+        int textWidth = 0;
+        int textHeight = 0;
+        if (graphics.measureText(victoryText, defaultFont, textWidth, textHeight)) {
             
             // 位置を計算（JSONから取得）
             int textX, textY;
@@ -1170,9 +1150,7 @@ void BattleState::render(Graphics& graphics) {
                              textWidth + padding * 2, textHeight + padding * 2, false);
             
             // テキストを描画
-            graphics.drawText(victoryText, textX, textY, "default", textColor);
-            
-            SDL_DestroyTexture(textTexture);
+            graphics.drawText(victoryText, textX, textY, defaultFont, textColor);
         }
         
         // 夜のタイマーUIを表示
@@ -1203,18 +1181,16 @@ void BattleState::render(Graphics& graphics) {
         // プレイヤーと敵のキャラクター描画（renderResultAnnouncementと同じ構成）
         auto& charState = animationController->getCharacterState();
         auto& config = UIConfig::UIConfigManager::getInstance();
-        auto battleConfig = config.getBattleConfig();
+        const auto& battleConfig = config.getBattleConfig();
         
-        int playerBaseX, playerBaseY;
-        config.calculatePosition(playerBaseX, playerBaseY, battleConfig.playerPosition, screenWidth, screenHeight);
+        const UIConfig::UIResolvedRect& playerBaseLayout = config.getLayout(UIConfig::UILayoutId::BATTLE_PLAYER, screenWidth, screenHeight);
+        int playerBaseX = playerBaseLayout.x;
+        int playerBaseY = playerBaseLayout.y;
         int playerX = playerBaseX + (int)charState.playerAttackOffsetX + (int)charState.playerHitOffsetX;
         int playerY = playerBaseY + (int)charState.playerAttackOffsetY + (int)charState.playerHitOffsetY;
         
         // 窮地モードではplayer_adversity.pngを使用
-        SDL_Texture* playerTex = hasUsedLastChanceMode ? graphics.getTexture("player_adversity") : graphics.getTexture("player");
-        if (!playerTex && hasUsedLastChanceMode) {
-            playerTex = graphics.getTexture("player"); // フォールバック
-        }
+        SDL_Texture* playerTex = getPlayerTexture(graphics);
         
         // 元の画像サイズを取得してアスペクト比を保持（HP表示の位置計算用）
         int playerHeight = BattleConstants::BATTLE_CHARACTER_SIZE;
@@ -1296,10 +1272,9 @@ void BattleState::render(Graphics& graphics) {
         
         SDL_Color textColor = levelUpDisplayConfig.textColor;
         
-        SDL_Texture* textTexture = graphics.createTextTexture(levelUpText, "default", textColor);
-        if (textTexture) {
-            int textWidth, textHeight;
-            SDL_QueryTexture(textTexture, nullptr, nullptr, &textWidth, &textHeight);
+        int textWidth = 0;
+        int textHeight = 0;
+        if (graphics.measureText(levelUpText, defaultFont, textWidth, textHeight)) {
             
             // 位置を計算（JSONから取得）
             int textX, textY;
@@ -1324,9 +1299,7 @@ void BattleState::render(Graphics& graphics) {
                              textWidth + padding * 2, textHeight + padding * 2, false);
             
             // テキストを描画
-            graphics.drawText(levelUpText, textX, textY, "default", textColor);
-            
-            SDL_DestroyTexture(textTexture);
+            graphics.drawText(levelUpText, textX, textY, defaultFont, textColor);
         }
         
         // 夜のタイマーUIを表示
@@ -1425,13 +1398,14 @@ void BattleState::render(Graphics& graphics) {
     
     // JSONからプレイヤーと敵の位置を取得
     auto& uiConfigManager = UIConfig::UIConfigManager::getInstance();
-    auto battleConfig = uiConfigManager.getBattleConfig();
+    const auto& battleConfig = uiConfigManager.getBattleConfig();
     
     // デバッグ: 位置情報を確認（毎フレーム表示、変更時のみ）
     static int lastPlayerX = -1, lastPlayerY = -1;
     static float lastAbsoluteX = -1, lastAbsoluteY = -1;
-    int playerBaseX, playerBaseY;
-    uiConfigManager.calculatePosition(playerBaseX, playerBaseY, battleConfig.playerPosition, screenWidth, screenHeight);
+    const UIConfig::UIResolvedRect& playerBaseLayout = uiConfigManager.getLayout(UIConfig::UILayoutId::BATTLE_PLAYER, screenWidth, screenHeight);
+    int playerBaseX = playerBaseLayout.x;
+    int playerBaseY = playerBaseLayout.y;
     
     // JSONの値が変更された場合も検出
     bool jsonChanged = (battleConfig.playerPosition.absoluteX != lastAbsoluteX || 
@@ -1458,10 +1432,7 @@ void BattleState::render(Graphics& graphics) {
     }
     
     // 窮地モードではplayer_adversity.pngを使用
-    SDL_Texture* playerTexture = hasUsedLastChanceMode ? graphics.getTexture("player_adversity") : graphics.getTexture("player");
-    if (!playerTexture && hasUsedLastChanceMode) {
-        playerTexture = graphics.getTexture("player"); // フォールバック
-    }
+    SDL_Texture* playerTexture = getPlayerTexture(graphics);
     
     // 元の画像サイズを取得してアスペクト比を保持（HP表示の位置計算用）
     int playerHeight = 300;
@@ -1495,10 +1466,9 @@ void BattleState::render(Graphics& graphics) {
         // プレースホルダーを使わずに直接文字列を組み立て（文字化けを防ぐため）
         std::string statusText = "攻撃倍率: " + multiplierStr + "倍 (残り" + std::to_string(turns) + "ターン)";
         SDL_Color statusColor = attackMultiplierConfig.textColor;
-        SDL_Texture* statusTexture = graphics.createTextTexture(statusText, "default", statusColor);
-        if (statusTexture) {
-            int textWidth, textHeight;
-            SDL_QueryTexture(statusTexture, nullptr, nullptr, &textWidth, &textHeight);
+        int textWidth = 0;
+        int textHeight = 0;
+        if (graphics.measureText(statusText, defaultFont, textWidth, textHeight)) {
             int bgX = static_cast<int>(playerHpX + attackMultiplierConfig.offsetX - attackMultiplierConfig.padding);
             int bgY = static_cast<int>(playerHpY + attackMultiplierConfig.offsetY - attackMultiplierConfig.padding);
             if (shakeState.shakeTargetPlayer && shakeState.shakeTimer > 0.0f) {
@@ -1509,7 +1479,6 @@ void BattleState::render(Graphics& graphics) {
             graphics.drawRect(bgX, bgY, textWidth + attackMultiplierConfig.padding * 2, textHeight + attackMultiplierConfig.padding * 2, true);
             graphics.setDrawColor(attackMultiplierConfig.borderColor.r, attackMultiplierConfig.borderColor.g, attackMultiplierConfig.borderColor.b, attackMultiplierConfig.borderColor.a);
             graphics.drawRect(bgX, bgY, textWidth + attackMultiplierConfig.padding * 2, textHeight + attackMultiplierConfig.padding * 2, false);
-            SDL_DestroyTexture(statusTexture);
         }
         int statusTextX = static_cast<int>(playerHpX + attackMultiplierConfig.offsetX);
         int statusTextY = static_cast<int>(playerHpY + attackMultiplierConfig.offsetY);
@@ -1517,7 +1486,7 @@ void BattleState::render(Graphics& graphics) {
             statusTextX += static_cast<int>(shakeState.shakeOffsetX);
             statusTextY += static_cast<int>(shakeState.shakeOffsetY);
         }
-        graphics.drawText(statusText, statusTextX, statusTextY, "default", statusColor);
+        graphics.drawText(statusText, statusTextX, statusTextY, defaultFont, statusColor);
     }
     
     // アニメーションのオフセットを適用
@@ -1534,8 +1503,9 @@ void BattleState::render(Graphics& graphics) {
         graphics.drawRect(playerAnimX - 300 / 2, playerAnimY - 300 / 2, 300, 300, false);
     }
     
-    int enemyBaseX, enemyBaseY;
-    uiConfigManager.calculatePosition(enemyBaseX, enemyBaseY, battleConfig.enemyPosition, screenWidth, screenHeight);
+    const UIConfig::UIResolvedRect& enemyBaseLayout = uiConfigManager.getLayout(UIConfig::UILayoutId::BATTLE_ENEMY, screenWidth, screenHeight);
+    int enemyBaseX = enemyBaseLayout.x;
+    int enemyBaseY = enemyBaseLayout.y;
     int enemyX = enemyBaseX;
     int enemyY = enemyBaseY;
     
@@ -1549,14 +1519,7 @@ void BattleState::render(Graphics& graphics) {
     int enemyAnimY = enemyY + static_cast<int>(charState.enemyAttackOffsetY + charState.enemyHitOffsetY);
     
     // 住民の場合は住民の画像を使用、それ以外は通常の敵画像を使用
-    SDL_Texture* enemyTexture = nullptr;
-    if (enemy->isResident()) {
-        int textureIndex = enemy->getResidentTextureIndex();
-        std::string textureName = "resident_" + std::to_string(textureIndex + 1);
-        enemyTexture = graphics.getTexture(textureName);
-    } else {
-        enemyTexture = graphics.getTexture("enemy_" + enemy->getTypeName());
-    }
+    SDL_Texture* enemyTexture = graphics.getTexture(enemyTextureId);
     
     // 元の画像サイズを取得してアスペクト比を保持（HP表示の位置計算用）
     int enemyHeight = 300;
@@ -1670,39 +1633,44 @@ void BattleState::setupUI(Graphics& graphics) {
     ui.clear();
     
     auto& config = UIConfig::UIConfigManager::getInstance();
-    auto battleConfig = config.getBattleConfig();
+    const auto& battleConfig = config.getBattleConfig();
     
-    int battleLogX, battleLogY;
-    config.calculatePosition(battleLogX, battleLogY, battleConfig.battleLog.position, graphics.getScreenWidth(), graphics.getScreenHeight());
+    const UIConfig::UIResolvedRect& battleLogLayout = config.getLayout(UIConfig::UILayoutId::BATTLE_LOG, graphics.getScreenWidth(), graphics.getScreenHeight());
+    int battleLogX = battleLogLayout.x;
+    int battleLogY = battleLogLayout.y;
     auto battleLogLabelPtr = std::make_unique<Label>(battleLogX, battleLogY, "", "default");
     battleLogLabelPtr->setColor(battleConfig.battleLog.color);
     battleLogLabel = battleLogLabelPtr.get();
     ui.addElement(std::move(battleLogLabelPtr));
     
-    int playerStatusX, playerStatusY;
-    config.calculatePosition(playerStatusX, playerStatusY, battleConfig.playerStatus.position, graphics.getScreenWidth(), graphics.getScreenHeight());
+    const UIConfig::UIResolvedRect& playerStatusLayout = config.getLayout(UIConfig::UILayoutId::BATTLE_PLAYER_STATUS, graphics.getScreenWidth(), graphics.getScreenHeight());
+    int playerStatusX = playerStatusLayout.x;
+    int playerStatusY = playerStatusLayout.y;
     auto playerStatusLabelPtr = std::make_unique<Label>(playerStatusX, playerStatusY, "", "default");
     playerStatusLabelPtr->setColor(battleConfig.playerStatus.color);
     playerStatusLabel = playerStatusLabelPtr.get();
     ui.addElement(std::move(playerStatusLabelPtr));
     
-    int enemyStatusX, enemyStatusY;
-    config.calculatePosition(enemyStatusX, enemyStatusY, battleConfig.enemyStatus.position, graphics.getScreenWidth(), graphics.getScreenHeight());
+    const UIConfig::UIResolvedRect& enemyStatusLayout = config.getLayout(UIConfig::UILayoutId::BATTLE_ENEMY_STATUS, graphics.getScreenWidth(), graphics.getScreenHeight());
+    int enemyStatusX = enemyStatusLayout.x;
+    int enemyStatusY = enemyStatusLayout.y;
     auto enemyStatusLabelPtr = std::make_unique<Label>(enemyStatusX, enemyStatusY, "", "default");
     enemyStatusLabelPtr->setColor(battleConfig.enemyStatus.color);
     enemyStatusLabel = enemyStatusLabelPtr.get();
     ui.addElement(std::move(enemyStatusLabelPtr));
     
-    int messageX, messageY;
-    config.calculatePosition(messageX, messageY, battleConfig.message.position, graphics.getScreenWidth(), graphics.getScreenHeight());
+    const UIConfig::UIResolvedRect& messageLayout = config.getLayout(UIConfig::UILayoutId::BATTLE_MESSAGE, graphics.getScreenWidth(), graphics.getScreenHeight());
+    int messageX = messageLayout.x;
+    int messageY = messageLayout.y;
     auto messageLabelPtr = std::make_unique<Label>(messageX, messageY, "", "default");
     messageLabelPtr->setColor(battleConfig.message.color);
     messageLabel = messageLabelPtr.get();
     ui.addElement(std::move(messageLabelPtr));
     
     // 説明用メッセージボード（JSONから取得）
-    int explanationX, explanationY;
-    config.calculatePosition(explanationX, explanationY, battleConfig.explanationMessageBoard.text.position, graphics.getScreenWidth(), graphics.getScreenHeight());
+    const UIConfig::UIResolvedRect& explanationLayout = config.getLayout(UIConfig::UILayoutId::BATTLE_EXPLANATION_TEXT, graphics.getScreenWidth(), graphics.getScreenHeight());
+    int explanationX = explanationLayout.x;
+    int explanationY = explanationLayout.y;
     auto explanationLabelPtr = std::make_unique<Label>(explanationX, explanationY, "", "default");
     explanationLabelPtr->setColor(battleConfig.explanationMessageBoard.text.color);
     explanationLabelPtr->setText("");
@@ -1799,52 +1767,47 @@ void BattleState::loadBattleImages() {
 }
 
 SDL_Texture* BattleState::getBattleBackgroundTexture(Graphics& graphics) const {
-    // 住民の場合は夜の背景、衛兵・王様の場合は城の背景、魔王の場合は魔王の背景、それ以外は通常の戦闘背景を使用
-    SDL_Texture* bgTexture = nullptr;
-    if (!enemy) {
-        // enemyがnullptrの場合はデフォルトの背景を使用
-        bgTexture = graphics.getTexture("battle_bg");
-        if (!bgTexture) {
-            bgTexture = graphics.loadTexture("assets/textures/bg/battle_bg.png", "battle_bg");
-        }
-        return bgTexture;
-    }
-    if (enemy->isResident()) {
-        bgTexture = graphics.getTexture("night_bg");
-        if (!bgTexture) {
-            bgTexture = graphics.loadTexture("assets/textures/bg/night_bg.png", "night_bg");
-        }
-    } else if (enemy->getType() == EnemyType::GUARD || enemy->getType() == EnemyType::KING) {
-        bgTexture = graphics.getTexture("castle_bg");
-        if (!bgTexture) {
-            bgTexture = graphics.loadTexture("assets/textures/bg/castle_bg.png", "castle_bg");
-        }
-    } else if (enemy->getType() == EnemyType::DEMON_LORD) {
-        bgTexture = graphics.getTexture("demon_bg");
-        if (!bgTexture) {
-            bgTexture = graphics.loadTexture("assets/textures/bg/demon_bg.png", "demon_bg");
-        }
-    } else {
-        bgTexture = graphics.getTexture("battle_bg");
-        if (!bgTexture) {
-            bgTexture = graphics.loadTexture("assets/textures/bg/battle_bg.png", "battle_bg");
-        }
+    SDL_Texture* bgTexture = graphics.getTexture(backgroundTextureId);
+    if (!bgTexture) {
+        // 読み込まれていない場合のみ名前からパスを組み立てて読み込む
+        const std::string name = BattleUI::getBattleBackgroundName(enemy.get());
+        bgTexture = graphics.loadTexture("assets/textures/bg/" + name + ".png", name);
     }
     return bgTexture;
 }
 
+SDL_Texture* BattleState::getPlayerTexture(Graphics& graphics) const {
+    // 窮地モードではplayer_adversity.pngを使用
+    SDL_Texture* playerTex = hasUsedLastChanceMode ? graphics.getTexture(playerAdversityTextureId) : graphics.getTexture(playerTextureId);
+    if (!playerTex && hasUsedLastChanceMode) {
+        playerTex = graphics.getTexture(playerTextureId); // フォールバック
+    }
+    return playerTex;
+}
+
+void BattleState::resolveRenderHandles(Graphics& graphics) {
+    if (renderHandlesResolved && renderHandlesEnemy == enemy.get()) {
+        return;
+    }
+    // 描画のたびに名前を組み立てて検索しないよう、ハンドルを一度だけ解決する（敵が入れ替わった場合は解決し直す）
+    playerTextureId = graphics.getTextureId("player");
+    playerAdversityTextureId = graphics.getTextureId("player_adversity");
+    enemyTextureId = enemy ? graphics.getTextureId(enemy->getTextureName()) : TextureId{};
+    backgroundTextureId = graphics.getTextureId(BattleUI::getBattleBackgroundName(enemy.get()));
+    rpsTextureId = graphics.getTextureId("rock_paper_scissors");
+    defaultFont = graphics.getFontId("default");
+    renderHandlesEnemy = enemy.get();
+    renderHandlesResolved = true;
+}
+
 void BattleState::showSpellMenu() {
 }
 
 int BattleState::generateResidentCommand() {
     // 住民のコマンドを生成（怯える70%、助けを呼ぶ30%）
-    // より確実な乱数生成のため、時間ベースのシードも使用
-    std::random_device rd;
-    unsigned int seed = rd() ^ static_cast<unsigned int>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
-    std::mt19937 gen(seed);
-    std::uniform_int_distribution<> dis(1, 100);
+    RandomGenerator& gen = Random::get(RandomStream::BATTLE);
     
-    int roll = dis(gen);
+    int roll = gen.nextInt(1, 100);
     // 確率分布：1-70 = 怯える（70%）、71-100 = 助けを呼ぶ（30%）
     if (roll <= 70) {
         return BattleConstants::RESIDENT_COMMAND_AFRAID;  // 怯える
@@ -1875,11 +1838,8 @@ void BattleState::processResidentTurn(int playerCommand, int residentCommand) {
             }
             
             // ランダム判定
-            std::random_device rd;
-            unsigned int seed = rd() ^ static_cast<unsigned int>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
-            std::mt19937 gen(seed);
-            std::uniform_int_distribution<> dis(1, 100);
-            int roll = dis(gen);
+            RandomGenerator& gen = Random::get(RandomStream::BATTLE);
+            int roll = gen.nextInt(1, 100);
             
             if (roll <= successRate) {
                 // 攻撃成功
@@ -2012,19 +1972,9 @@ std::string BattleState::getResidentBehaviorHint() const {
         return cachedResidentBehaviorHint;
     }
     
-    // キャッシュがない場合（念のため）は確率的に予測
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dis(1, 100);
-    
-    int roll = dis(gen);
-    if (roll <= 70) {
-        // 怯えるの可能性が高い → 震えが止まらないようだ
-        return "震えが止まらないようだ";
-    } else {
-        // 助けを呼ぶの可能性が高い → 辺りを見渡している
-        return "辺りを見渡している";
-    }
+    // キャッシュがない場合（念のため）は、可能性が高い方（怯える）の様子を返す
+    // 描画から呼ばれるため、ここで乱数を使うと描画の有無で戦闘の乱数列が変わってしまう
+    return "震えが止まらないようだ";
 }
 
 // 住民戦でも通常のupdateJudgePhaseとupdateJudgeResultPhaseを使用するため、これらの関数は不要
@@ -2080,9 +2030,7 @@ void BattleState::handlePlayerAction(int action) {
     switch (action) {
         case 1:
             {
-                static std::random_device rd;
-                static std::mt19937 gen(rd());
-                std::uniform_int_distribution<> criticalDis(1, 100);
+                RandomGenerator& gen = Random::get(RandomStream::BATTLE);
                 
                 int baseDamage = player->calculateDamageWithBonus(*enemy);
                 int damage = baseDamage;
@@ -2093,7 +2041,7 @@ void BattleState::handlePlayerAction(int action) {
                     player->processNextTurnBonus();
                 }
                 
-                if (criticalDis(gen) <= 8) { // 会心の一撃判定（8%の確率）
+                if (gen.nextInt(1, 100) <= 8) { // 会心の一撃判定（8%の確率）
                     damage = damage * 2;
                     isCritical = true;
                     std::string damageMessage = player->getName() + "の攻撃！【会心の一撃！】\n" + enemy->getTypeName() + "は" + std::to_string(damage) + "のダメージを受けた！";
@@ -2191,6 +2139,7 @@ void BattleState::executeEnemyTurn() {
 }
 
 void BattleState::checkBattleEnd() {
+    TRACE_SCOPE("BattleState::checkBattleEnd");
     if (!player->getIsAlive()) {
         // 最後のチャンスモードをまだ使っていない場合、最後のチャンスモードに遷移
         if (!hasUsedLastChanceMode && 
@@ -2333,6 +2282,7 @@ void BattleState::showResult() {
 }
 
 void BattleState::endBattle() {
+    TRACE_SCOPE("BattleState::endBattle");
     // 戦闘終了時にHPを全回復（敗北時を除く）
     if (lastResult != BattleResult::PLAYER_DEFEAT && player) {
         player->setHp(player->getMaxHp());
@@ -2740,7 +2690,7 @@ void BattleState::executeSelectedOption() {
     isShowingOptions = false;
     
     if (currentPhase == BattlePhase::DESPERATE_MODE_PROMPT) {
-        if (selected == "大勝負に挑む") {
+        if (selected.rfind("大勝負に挑む", 0) == 0) {
             battleLogic->setCommandTurnCount(BattleConstants::DESPERATE_TURN_COUNT);
             battleLogic->setDesperateMode(true);
             currentPhase = BattlePhase::DESPERATE_COMMAND_SELECT;
@@ -2750,7 +2700,7 @@ void BattleState::executeSelectedOption() {
                 AudioManager::getInstance().playMusic("battle", -1);
                 battleMusicStarted = true;
             }
-        } else if (selected == "通常戦闘を続ける") {
+        } else if (selected.rfind("通常戦闘を続ける", 0) == 0) {
             battleLogic->setCommandTurnCount(BattleConstants::NORMAL_TURN_COUNT);
             battleLogic->setDesperateMode(false);
             currentPhase = BattlePhase::COMMAND_SELECT;
@@ -3038,6 +2988,7 @@ std::string BattleState::getSpellDescription(int spellIndex) {
 } 
 
 void BattleState::initializeCommandSelection() {
+    TRACE_SCOPE("BattleState::initializeCommandSelection");
     int turnCount = battleLogic->getCommandTurnCount();
     std::vector<int> playerCmds(turnCount, -1);
     std::vector<int> enemyCmds(turnCount, -1);
@@ -3089,12 +3040,9 @@ void BattleState::initializeCommandSelection() {
         cachedResidentCommand = generateResidentCommand();
         
         // 30%の確率で「様子が伺えない」と表示（どちらのコマンドを使うかわからない）
-        std::random_device rd;
-        unsigned int seed = rd() ^ static_cast<unsigned int>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
-        std::mt19937 gen(seed);
-        std::uniform_int_distribution<> dis(1, 100);
+        RandomGenerator& gen = Random::get(RandomStream::BATTLE);
         
-        int behaviorRoll = dis(gen);
+        int behaviorRoll = gen.nextInt(1, 100);
         if (behaviorRoll <= 50) {
             // 30%の確率で様子が伺えない
             cachedResidentBehaviorHint = "様子が伺えない";
@@ -3176,6 +3124,7 @@ void BattleState::selectCommandForTurn(int turnIndex) {
 }
 
 void BattleState::prepareJudgeResults() {
+    TRACE_SCOPE("BattleState::prepareJudgeResults");
     turnResults.clear();
     
     auto judgeResults = battleLogic->judgeAllRounds();
@@ -3317,14 +3266,14 @@ void BattleState::renderRockPaperScissorsImage(Graphics& graphics) {
         return;
     }
     
-    SDL_Texture* rpsTexture = graphics.getTexture("rock_paper_scissors");
+    SDL_Texture* rpsTexture = graphics.getTexture(rpsTextureId);
     if (rpsTexture) {
         int screenWidth = graphics.getScreenWidth();
         int screenHeight = graphics.getScreenHeight();
         
         // JSONから設定を取得（ホットリロード対応のため、毎回取得）
         auto& config = UIConfig::UIConfigManager::getInstance();
-        auto battleConfig = config.getBattleConfig();
+        const auto& battleConfig = config.getBattleConfig();
         
         // 画像のサイズを取得
         int textureWidth, textureHeight;
@@ -3352,7 +3301,9 @@ void BattleState::renderRockPaperScissorsImage(Graphics& graphics) {
         // 位置を計算（calculatePositionを使用）
         int posX, posY;
         try {
-            config.calculatePosition(posX, posY, battleConfig.rockPaperScissors.position, screenWidth, screenHeight);
+            const UIConfig::UIResolvedRect& posLayout = config.getLayout(UIConfig::UILayoutId::BATTLE_ROCK_PAPER_SCISSORS, screenWidth, screenHeight);
+            posX = posLayout.x;
+            posY = posLayout.y;
         } catch (const std::exception& e) {
             std::cerr << "警告: renderRockPaperScissorsImage: calculatePosition失敗: " << e.what() << std::endl;
             // デフォルト位置を使用
@@ -3372,7 +3323,7 @@ void BattleState::renderRockPaperScissorsImage(Graphics& graphics) {
 void BattleState::renderWinLossUI(Graphics& graphics, bool isResultPhase) {
     // JSONから設定を取得
     auto& config = UIConfig::UIConfigManager::getInstance();
-    auto battleConfig = config.getBattleConfig();
+    const auto& battleConfig = config.getBattleConfig();
     
     auto winLoss = calculateCurrentWinLoss();
     int playerWins = winLoss.first;
@@ -3388,14 +3339,8 @@ void BattleState::renderWinLossUI(Graphics& graphics, bool isResultPhase) {
     // VSの位置を計算
     // VSの最大スケール時の高さを計算（JUDGE_VS_BASE_SCALE = 3.0f）
     // VSテキストの高さを仮定（約30px * 3.0 = 90px）
-    std::string vsText = "VS";
-    SDL_Color vsTextColor = {255, 255, 255, 255};
-    SDL_Texture* vsTexture = graphics.createTextTexture(vsText, "default", vsTextColor);
     int vsTextWidth = 0, vsTextHeight = 0;
-    if (vsTexture) {
-        SDL_QueryTexture(vsTexture, nullptr, nullptr, &vsTextWidth, &vsTextHeight);
-        SDL_DestroyTexture(vsTexture);
-    }
+    graphics.measureText("VS", defaultFont, vsTextWidth, vsTextHeight);
     int vsScaledHeight = static_cast<int>(vsTextHeight * BattleConstants::JUDGE_VS_BASE_SCALE);
     int vsPadding = BattleConstants::JUDGE_COMMAND_TEXT_PADDING_LARGE;
     
@@ -3410,22 +3355,13 @@ void BattleState::renderWinLossUI(Graphics& graphics, bool isResultPhase) {
     int textHeight = 0;  // 結果フェーズでは0、通常フェーズでは実際の高さを設定
     if (!isResultPhase) {
         // 勝敗テキスト（JSONからフォーマットを取得）
-        std::string winLossText = winLossTextConfig.format;
-        // プレースホルダーを置換（安全な方法：文字列を前後で結合）
-        size_t pos = winLossText.find("{playerWins}");
-        if (pos != std::string::npos) {
-            winLossText = winLossText.substr(0, pos) + std::to_string(playerWins) + winLossText.substr(pos + 12);
-        }
-        pos = winLossText.find("{enemyWins}");
-        if (pos != std::string::npos) {
-            winLossText = winLossText.substr(0, pos) + std::to_string(enemyWins) + winLossText.substr(pos + 11);
-        }
+        ArenaString winLossText(winLossTextConfig.format.c_str());
+        replacePlaceholder(winLossText, "{playerWins}", std::to_string(playerWins).c_str());
+        replacePlaceholder(winLossText, "{enemyWins}", std::to_string(enemyWins).c_str());
         SDL_Color textColor = winLossTextConfig.color;
         
-        SDL_Texture* textTexture = graphics.createTextTexture(winLossText, "default", textColor);
-        if (textTexture) {
-            int textWidth;
-            SDL_QueryTexture(textTexture, nullptr, nullptr, &textWidth, &textHeight);
+        int textWidth = 0;
+        if (graphics.measureText(winLossText.c_str(), defaultFont, textWidth, textHeight)) {
             
             int padding = winLossTextConfig.padding;
             int bgX = centerX - textWidth / 2 - padding;
@@ -3436,9 +3372,7 @@ void BattleState::renderWinLossUI(Graphics& graphics, bool isResultPhase) {
             graphics.drawRect(bgX, bgY, textWidth + padding * 2, textHeight + padding * 2, true);
             
             // テキスト白
-            graphics.drawText(winLossText, centerX - textWidth / 2, winLossY, "default", textColor);
-            
-            SDL_DestroyTexture(textTexture);
+            graphics.drawText(winLossText.c_str(), centerX - textWidth / 2, winLossY, defaultFont, textColor);
         }
     }
     
@@ -3446,38 +3380,25 @@ void BattleState::renderWinLossUI(Graphics& graphics, bool isResultPhase) {
     if (isResultPhase) {
         // 1. 「〜ターン分の攻撃を実行」を常に表示（勝敗UIの下）
         auto& totalAttackTextConfig = battleConfig.winLossUI.totalAttackText;
-        std::string totalAttackText;
+        ArenaString totalAttackText;
         // 住民戦で攻撃失敗時は「ためらいました」を表示
         if (enemy->isResident() && residentAttackFailed) {
-            totalAttackText = totalAttackTextConfig.hesitateFormat;
-            size_t pos = totalAttackText.find("{playerName}");
-            if (pos != std::string::npos) {
-                totalAttackText = totalAttackText.substr(0, pos) + player->getName() + totalAttackText.substr(pos + 12);
-            }
+            totalAttackText = totalAttackTextConfig.hesitateFormat.c_str();
+            replacePlaceholder(totalAttackText, "{playerName}", player->getName().c_str());
         } else if (playerWins > enemyWins) {
-            totalAttackText = totalAttackTextConfig.playerWinFormat;
-            size_t pos = totalAttackText.find("{playerName}");
-            if (pos != std::string::npos) {
-                totalAttackText = totalAttackText.substr(0, pos) + player->getName() + totalAttackText.substr(pos + 12);
-            }
-            pos = totalAttackText.find("{turns}");
-            if (pos != std::string::npos) {
-                totalAttackText = totalAttackText.substr(0, pos) + std::to_string(playerWins) + totalAttackText.substr(pos + 7);
-            }
+            totalAttackText = totalAttackTextConfig.playerWinFormat.c_str();
+            replacePlaceholder(totalAttackText, "{playerName}", player->getName().c_str());
+            replacePlaceholder(totalAttackText, "{turns}", std::to_string(playerWins).c_str());
         } else if (enemyWins > playerWins) {
-            totalAttackText = totalAttackTextConfig.enemyWinFormat;
-            size_t pos = totalAttackText.find("{turns}");
-            if (pos != std::string::npos) {
-                totalAttackText = totalAttackText.substr(0, pos) + std::to_string(enemyWins) + totalAttackText.substr(pos + 7);
-            }
+            totalAttackText = totalAttackTextConfig.enemyWinFormat.c_str();
+            replacePlaceholder(totalAttackText, "{turns}", std::to_string(enemyWins).c_str());
         } else {
-            totalAttackText = totalAttackTextConfig.drawFormat;
+            totalAttackText = totalAttackTextConfig.drawFormat.c_str();
         }
         
-        SDL_Texture* totalAttackTexture = graphics.createTextTexture(totalAttackText, "default", totalAttackTextConfig.color);
-        if (totalAttackTexture) {
-            int totalAttackTextWidth, totalAttackTextHeight;
-            SDL_QueryTexture(totalAttackTexture, nullptr, nullptr, &totalAttackTextWidth, &totalAttackTextHeight);
+        int totalAttackTextWidth = 0;
+        int totalAttackTextHeight = 0;
+        if (graphics.measureText(totalAttackText.c_str(), defaultFont, totalAttackTextWidth, totalAttackTextHeight)) {
             
             // 勝敗UIの下に配置（JSONから設定を取得）
             // 結果フェーズでは「自分〜勝」テキストを表示しないので、winLossYから直接オフセットを適用
@@ -3491,14 +3412,12 @@ void BattleState::renderWinLossUI(Graphics& graphics, bool isResultPhase) {
             graphics.drawRect(totalAttackBgX, totalAttackBgY, totalAttackTextWidth + totalAttackPadding * 2, totalAttackTextHeight + totalAttackPadding * 2, true);
             
             // テキスト白
-            graphics.drawText(totalAttackText, centerX - totalAttackTextWidth / 2, totalAttackY, "default", totalAttackTextConfig.color);
-            
-            SDL_DestroyTexture(totalAttackTexture);
+            graphics.drawText(totalAttackText.c_str(), centerX - totalAttackTextWidth / 2, totalAttackY, defaultFont, totalAttackTextConfig.color);
             
             // 2. 現在実行中のターンに応じたメッセージを表示（「〜ターン分の攻撃を実行」の下）
             if (playerWins > enemyWins) {
                     auto& attackTextConfig = battleConfig.winLossUI.attackText;
-                    std::string attackText;
+                    const char* attackFormat = "";
                     
                     // 現在実行中のターンに対応するメッセージを生成
                     // skipAnimationがtrueの場合でも、テキストは表示する必要があるため、
@@ -3514,9 +3433,9 @@ void BattleState::renderWinLossUI(Graphics& graphics, bool isResultPhase) {
                         const auto& damageInfo = pendingDamages[displayTurnIndex];
                         
                         if (damageInfo.commandType == BattleConstants::COMMAND_ATTACK) {
-                            attackText = attackTextConfig.attackFormat;
+                            attackFormat = attackTextConfig.attackFormat.c_str();
                         } else if (damageInfo.commandType == BattleConstants::COMMAND_DEFEND) {
-                            attackText = attackTextConfig.rushFormat;
+                            attackFormat = attackTextConfig.rushFormat.c_str();
                         } else if (damageInfo.commandType == BattleConstants::COMMAND_SPELL) {
                             // 呪文の種類を取得
                             auto it = executedSpellsByDamageIndex.find(displayTurnIndex);
@@ -3524,38 +3443,34 @@ void BattleState::renderWinLossUI(Graphics& graphics, bool isResultPhase) {
                                 SpellType spellType = it->second;
                                 switch (spellType) {
                                     case SpellType::STATUS_UP:
-                                        attackText = attackTextConfig.statusUpSpellFormat;
+                                        attackFormat = attackTextConfig.statusUpSpellFormat.c_str();
                                         break;
                                     case SpellType::HEAL:
-                                        attackText = attackTextConfig.healSpellFormat;
+                                        attackFormat = attackTextConfig.healSpellFormat.c_str();
                                         break;
                                     case SpellType::ATTACK:
-                                        attackText = attackTextConfig.attackSpellFormat;
+                                        attackFormat = attackTextConfig.attackSpellFormat.c_str();
                                         break;
                                     default:
-                                        attackText = attackTextConfig.defaultSpellFormat;
+                                        attackFormat = attackTextConfig.defaultSpellFormat.c_str();
                                         break;
                                 }
                             } else {
-                                attackText = attackTextConfig.defaultSpellFormat;
+                                attackFormat = attackTextConfig.defaultSpellFormat.c_str();
                             }
                         } else {
                             // デフォルトメッセージ
-                            attackText = attackTextConfig.defaultAttackFormat;
+                            attackFormat = attackTextConfig.defaultAttackFormat.c_str();
                         }
                         
-                        // プレースホルダーを置換（安全な方法：文字列を前後で結合）
-                        size_t pos = attackText.find("{playerName}");
-                        if (pos != std::string::npos) {
-                            attackText = attackText.substr(0, pos) + player->getName() + attackText.substr(pos + 12);
-                        }
                     }
                     
+                    ArenaString attackText(attackFormat);
+                    replacePlaceholder(attackText, "{playerName}", player->getName().c_str());
                     if (!attackText.empty()) {
-                        SDL_Texture* attackTexture = graphics.createTextTexture(attackText, "default", attackTextConfig.color);
-                        if (attackTexture) {
-                            int attackTextWidth, attackTextHeight;
-                            SDL_QueryTexture(attackTexture, nullptr, nullptr, &attackTextWidth, &attackTextHeight);
+                        int attackTextWidth = 0;
+                        int attackTextHeight = 0;
+                        if (graphics.measureText(attackText.c_str(), defaultFont, attackTextWidth, attackTextHeight)) {
                             
                             // 「〜ターン分の攻撃を実行」の下に配置（JSONから設定を取得）
                             int attackY = totalAttackY + totalAttackTextHeight + static_cast<int>(attackTextConfig.position.offsetY);
@@ -3568,9 +3483,7 @@ void BattleState::renderWinLossUI(Graphics& graphics, bool isResultPhase) {
                             graphics.drawRect(attackBgX, attackBgY, attackTextWidth + attackPadding * 2, attackTextHeight + attackPadding * 2, true);
                             
                             // テキスト白
-                            graphics.drawText(attackText, centerX - attackTextWidth / 2, attackY, "default", attackTextConfig.color);
-                            
-                            SDL_DestroyTexture(attackTexture);
+                            graphics.drawText(attackText.c_str(), centerX - attackTextWidth / 2, attackY, defaultFont, attackTextConfig.color);
                         }
             }
         } else if (enemyWins > playerWins) {
@@ -3579,16 +3492,17 @@ void BattleState::renderWinLossUI(Graphics& graphics, bool isResultPhase) {
             auto& effectMessageTextConfig = battleConfig.winLossUI.effectMessageText;
                     
                     // すべてのpendingDamagesをチェックして、特殊技名と効果メッセージの両方がある最初のターンを見つける
-                    std::string skillNameText = "";
-                    std::string effectMessageText = "";
+                    FrameArena& arena = FrameArena::getInstance();
+                    const char* skillNameText = "";
+                    const char* effectMessageText = "";
                     int foundIndex = -1;
                     
                     // まず、特殊技名と効果メッセージの両方があるターンを探す
                     for (size_t i = 0; i < pendingDamages.size(); i++) {
                         const auto& damageInfo = pendingDamages[i];
                         if (damageInfo.isSpecialSkill && !damageInfo.specialSkillName.empty() && !damageInfo.specialSkillEffectMessage.empty()) {
-                            skillNameText = enemy->getTypeName() + "の【" + damageInfo.specialSkillName + "】";
-                            effectMessageText = "（" + damageInfo.specialSkillEffectMessage + "）";
+                            skillNameText = arena.format("%sの【%s】", enemy->getTypeName().c_str(), damageInfo.specialSkillName.c_str());
+                            effectMessageText = arena.format("（%s）", damageInfo.specialSkillEffectMessage.c_str());
                             foundIndex = static_cast<int>(i);
                             break;
                         }
@@ -3606,27 +3520,26 @@ void BattleState::renderWinLossUI(Graphics& graphics, bool isResultPhase) {
                             
                             if (damageInfo.isSpecialSkill && !damageInfo.specialSkillName.empty()) {
                                 // 特殊技の場合は「敵名の【特殊技名】」を表示
-                                skillNameText = enemy->getTypeName() + "の【" + damageInfo.specialSkillName + "】";
+                                skillNameText = arena.format("%sの【%s】", enemy->getTypeName().c_str(), damageInfo.specialSkillName.c_str());
                                 // 効果メッセージがある場合は別行で表示
                                 if (!damageInfo.specialSkillEffectMessage.empty()) {
-                                    effectMessageText = "（" + damageInfo.specialSkillEffectMessage + "）";
+                                    effectMessageText = arena.format("（%s）", damageInfo.specialSkillEffectMessage.c_str());
                                 }
                             } else {
                                 // 通常攻撃
-                                skillNameText = enemy->getTypeName() + "の攻撃！";
+                                skillNameText = arena.format("%sの攻撃！", enemy->getTypeName().c_str());
                             }
                         } else {
                             // デフォルトメッセージ
-                            skillNameText = enemy->getTypeName() + "の攻撃！";
+                            skillNameText = arena.format("%sの攻撃！", enemy->getTypeName().c_str());
                         }
                     }
                     
                     // 特殊技名を表示
-                    if (!skillNameText.empty()) {
-                        SDL_Texture* skillNameTexture = graphics.createTextTexture(skillNameText, "default", attackTextConfig.color);
-                        if (skillNameTexture) {
-                            int skillNameTextWidth, skillNameTextHeight;
-                            SDL_QueryTexture(skillNameTexture, nullptr, nullptr, &skillNameTextWidth, &skillNameTextHeight);
+                    if (*skillNameText) {
+                        int skillNameTextWidth = 0;
+                        int skillNameTextHeight = 0;
+                        if (graphics.measureText(skillNameText, defaultFont, skillNameTextWidth, skillNameTextHeight)) {
                             
                             // 「〜ターン分の攻撃を実行」の下に配置
                             int skillNameY = totalAttackY + totalAttackTextHeight + static_cast<int>(attackTextConfig.position.offsetY);
@@ -3640,16 +3553,13 @@ void BattleState::renderWinLossUI(Graphics& graphics, bool isResultPhase) {
                             graphics.drawRect(skillNameBgX, skillNameBgY, skillNameTextWidth + attackPadding * 2, skillNameTextHeight + attackPadding * 2, true);
                             
                             // テキスト白
-                            graphics.drawText(skillNameText, centerX - skillNameTextWidth / 2, skillNameY, "default", attackTextConfig.color);
-                            
-                            SDL_DestroyTexture(skillNameTexture);
+                            graphics.drawText(skillNameText, centerX - skillNameTextWidth / 2, skillNameY, defaultFont, attackTextConfig.color);
                             
                             // 効果メッセージがある場合は、特殊技名の下に表示
-                            if (!effectMessageText.empty()) {
-                                SDL_Texture* effectMessageTexture = graphics.createTextTexture(effectMessageText, "default", effectMessageTextConfig.color);
-                                if (effectMessageTexture) {
-                                    int effectMessageTextWidth, effectMessageTextHeight;
-                                    SDL_QueryTexture(effectMessageTexture, nullptr, nullptr, &effectMessageTextWidth, &effectMessageTextHeight);
+                            if (*effectMessageText) {
+                                int effectMessageTextWidth = 0;
+                                int effectMessageTextHeight = 0;
+                                if (graphics.measureText(effectMessageText, defaultFont, effectMessageTextWidth, effectMessageTextHeight)) {
                                     
                                     // 特殊技名の下に配置（JSON設定のoffsetYを使用、position.offsetYを優先）
                                     float offsetY = effectMessageTextConfig.position.offsetY != 0.0f ? 
@@ -3666,9 +3576,7 @@ void BattleState::renderWinLossUI(Graphics& graphics, bool isResultPhase) {
                                     graphics.drawRect(effectMessageBgX, effectMessageBgY, effectMessageTextWidth + effectMessagePadding * 2, effectMessageTextHeight + effectMessagePadding * 2, true);
                                     
                                     // テキスト（JSON設定の色を使用）
-                                    graphics.drawText(effectMessageText, centerX - effectMessageTextWidth / 2, effectMessageY, "default", effectMessageTextConfig.color);
-                                    
-                                    SDL_DestroyTexture(effectMessageTexture);
+                                    graphics.drawText(effectMessageText, centerX - effectMessageTextWidth / 2, effectMessageY, defaultFont, effectMessageTextConfig.color);
                                 }
                             }
                         }
@@ -3721,19 +3629,23 @@ void BattleState::prepareDamageList(float damageMultiplier) {
 }
 
 void BattleState::executeWinningTurns(float damageMultiplier) {
+    TRACE_SCOPE("BattleState::executeWinningTurns");
     auto stats = battleLogic->getStats();
     auto playerCmds = battleLogic->getPlayerCommands();
     auto enemyCmds = battleLogic->getEnemyCommands();
     
     // JSONからプレイヤーと敵の位置を取得
     auto& config = UIConfig::UIConfigManager::getInstance();
-    auto battleConfig = config.getBattleConfig();
     int screenWidth = BattleConstants::SCREEN_WIDTH;
     int screenHeight = BattleConstants::SCREEN_HEIGHT;
     
     int playerX, playerY, enemyX, enemyY;
-    config.calculatePosition(playerX, playerY, battleConfig.playerPosition, screenWidth, screenHeight);
-    config.calculatePosition(enemyX, enemyY, battleConfig.enemyPosition, screenWidth, screenHeight);
+    const UIConfig::UIResolvedRect& playerLayout = config.getLayout(UIConfig::UILayoutId::BATTLE_PLAYER, screenWidth, screenHeight);
+    playerX = playerLayout.x;
+    playerY = playerLayout.y;
+    const UIConfig::UIResolvedRect& enemyLayout = config.getLayout(UIConfig::UILayoutId::BATTLE_ENEMY, screenWidth, screenHeight);
+    enemyX = enemyLayout.x;
+    enemyY = enemyLayout.y;
     
     if (stats.playerWins > stats.enemyWins) {
         for (int i = 0; i < battleLogic->getCommandTurnCount(); i++) {
@@ -3843,6 +3755,7 @@ void BattleState::showDesperateModePrompt() {
 }
 
 void BattleState::updateJudgePhase(float deltaTime, bool isDesperateMode) {
+    TRACE_SCOPE("BattleState::updateJudgePhase");
     if (currentJudgingTurnIndex < battleLogic->getCommandTurnCount()) {
         // サブフェーズが変更された時（judgeDisplayTimerが0の時）に効果音を再生
         static JudgeSubPhase lastJudgeSubPhase = JudgeSubPhase::SHOW_RESULT; // 初期値をSHOW_RESULTに設定（最初のSHOW_PLAYER_COMMANDを検出するため）
@@ -3959,6 +3872,7 @@ void BattleState::updateJudgePhase(float deltaTime, bool isDesperateMode) {
 }
 
 void BattleState::updateJudgeResultPhase(float deltaTime, bool isDesperateMode) {
+    TRACE_SCOPE("BattleState::updateJudgeResultPhase");
     // フェーズが既に変更されている場合は処理をスキップ
     if (currentPhase != BattlePhase::JUDGE_RESULT && currentPhase != BattlePhase::DESPERATE_JUDGE_RESULT) {
         return;
@@ -3966,13 +3880,16 @@ void BattleState::updateJudgeResultPhase(float deltaTime, bool isDesperateMode)
     
     // JSONからプレイヤーと敵の位置を取得
     auto& uiConfigManager = UIConfig::UIConfigManager::getInstance();
-    auto battleConfig = uiConfigManager.getBattleConfig();
     int screenWidth = BattleConstants::SCREEN_WIDTH;
     int screenHeight = BattleConstants::SCREEN_HEIGHT;
     
     int playerX, playerY, enemyX, enemyY;
-    uiConfigManager.calculatePosition(playerX, playerY, battleConfig.playerPosition, screenWidth, screenHeight);
-    uiConfigManager.calculatePosition(enemyX, enemyY, battleConfig.enemyPosition, screenWidth, screenHeight);
+    const UIConfig::UIResolvedRect& playerLayout = uiConfigManager.getLayout(UIConfig::UILayoutId::BATTLE_PLAYER, screenWidth, screenHeight);
+    playerX = playerLayout.x;
+    playerY = playerLayout.y;
+    const UIConfig::UIResolvedRect& enemyLayout = uiConfigManager.getLayout(UIConfig::UILayoutId::BATTLE_ENEMY, screenWidth, screenHeight);
+    enemyX = enemyLayout.x;
+    enemyY = enemyLayout.y;
     
     // 住民戦の場合は特別な処理（最初の1回だけprocessResidentTurnを呼ぶ）
     if (enemy->isResident()) {
@@ -4643,10 +4560,7 @@ void BattleState::updateJudgeResultPhase(float deltaTime, bool isDesperateMode)
 }
 
 int BattleState::applyEnemySpecialSkill(EnemyType enemyType, int baseDamage, std::string& effectMessage) {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::uniform_int_distribution<> percentDis(0, 99);
-    std::uniform_int_distribution<> chaosDis(0, 2);
+    RandomGenerator& gen = Random::get(RandomStream::BATTLE);
     
     auto& skillEffects = player->getPlayerStats().getEnemySkillEffects();
     int finalDamage = baseDamage;
@@ -4714,7 +4628,7 @@ int BattleState::applyEnemySpecialSkill(EnemyType enemyType, int baseDamage, std
             
         case EnemyType::DEMON_SOLDIER:
             // 通常 + 5%の確率でプレイヤーを即死させる
-            if (percentDis(gen) < 5) {
+            if (gen.nextInt(0, 99) < 5) {
                 player->takeDamage(player->getHp());
                 effectMessage = "5%確率で即死（発動）";
                 addBattleLog("地獄の一撃が直撃した！即死した！");
@@ -4767,7 +4681,7 @@ int BattleState::applyEnemySpecialSkill(EnemyType enemyType, int baseDamage, std
             
         case EnemyType::ICE_GIANT:
             // 通常 + 20%の確率で氷漬けにして次のターンコマンド選択できず一方的に攻撃される
-            if (percentDis(gen) < 20) {
+            if (gen.nextInt(0, 99) < 20) {
                 skillEffects.isFrozen = true;
                 effectMessage = "20%確率で氷漬け（発動）";
                 addBattleLog("氷結の息吹で体が凍りついた！次のターン動けない！");
@@ -4931,6 +4845,7 @@ std::string BattleState::getEnemySpecialSkillEffectMessage(EnemyType enemyType)
 }
 
 void BattleState::processEnemySkillEffects() {
+    TRACE_SCOPE("BattleState::processEnemySkillEffects");
     auto& skillEffects = player->getPlayerStats().getEnemySkillEffects();
     
     // 火傷の処理
@@ -5020,6 +4935,7 @@ int BattleState::applyPlayerAttackSkillEffects(int baseDamage) {
 }
 
 void BattleState::updateLastChanceJudgeResultPhase(float deltaTime) {
+    TRACE_SCOPE("BattleState::updateLastChanceJudgeResultPhase");
     // フェーズが既に変更されている場合は処理をスキップ
     if (currentPhase != BattlePhase::LAST_CHANCE_JUDGE_RESULT) {
         return;
@@ -5027,13 +4943,16 @@ void BattleState::updateLastChanceJudgeResultPhase(float deltaTime) {
     
     // JSONからプレイヤーと敵の位置を取得
     auto& uiConfigManager = UIConfig::UIConfigManager::getInstance();
-    auto battleConfig = uiConfigManager.getBattleConfig();
     int screenWidth = BattleConstants::SCREEN_WIDTH;
     int screenHeight = BattleConstants::SCREEN_HEIGHT;
     
     int playerX, playerY, enemyX, enemyY;
-    uiConfigManager.calculatePosition(playerX, playerY, battleConfig.playerPosition, screenWidth, screenHeight);
-    uiConfigManager.calculatePosition(enemyX, enemyY, battleConfig.enemyPosition, screenWidth, screenHeight);
+    const UIConfig::UIResolvedRect& playerLayout = uiConfigManager.getLayout(UIConfig::UILayoutId::BATTLE_PLAYER, screenWidth, screenHeight);
+    playerX = playerLayout.x;
+    playerY = playerLayout.y;
+    const UIConfig::UIResolvedRect& enemyLayout = uiConfigManager.getLayout(UIConfig::UILayoutId::BATTLE_ENEMY, screenWidth, screenHeight);
+    enemyX = enemyLayout.x;
+    enemyY = enemyLayout.y;
     
     auto stats = battleLogic->getStats();
     int playerWins = stats.playerWins;
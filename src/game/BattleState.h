@@ -125,6 +125,16 @@ private:
     std::vector<std::string> gameExplanationTexts;
     Label* explanationMessageBoard;  // 説明用メッセージボード（左下に表示）
     
+    // 描画に使用するテクスチャ・フォントのハンドル（resolveRenderHandles()で解決する）
+    const Enemy* renderHandlesEnemy;   // ハンドルを解決したときの敵
+    bool renderHandlesResolved;
+    TextureId playerTextureId;
+    TextureId playerAdversityTextureId;
+    TextureId enemyTextureId;
+    TextureId backgroundTextureId;
+    TextureId rpsTextureId;
+    FontId defaultFont;
+    
     // 戦闘ロジック（単一責任の原則）
     std::unique_ptr<BattleLogic> battleLogic;
     
@@ -271,6 +281,20 @@ private:
      */
     SDL_Texture* getBattleBackgroundTexture(Graphics& graphics) const;
     
+    /**
+     * @brief プレイヤー画像の取得
+     * @param graphics グラフィックスオブジェクトへの参照
+     * @return プレイヤーのテクスチャ（窮地モードではplayer_adversity、読み込まれていない場合はplayer）
+     */
+    SDL_Texture* getPlayerTexture(Graphics& graphics) const;
+    
+    /**
+     * @brief 描画に使用するテクスチャ・フォントのハンドルの解決
+     * @details 初回と敵が入れ替わった場合のみ解決し、以降の描画ではハンドルで参照する。
+     * @param graphics グラフィックスオブジェクトへの参照
+     */
+    void resolveRenderHandles(Graphics& graphics);
+    
     // 住民との戦闘用メソッド
     void processResidentTurn(int playerCommand, int residentCommand);
     int generateResidentCommand();  /**< @brief 住民のコマンドを生成（怯える70%、助けを呼ぶ30%） */
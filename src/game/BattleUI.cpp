@@ -1,15 +1,77 @@
 #include "BattleUI.h"
 #include "BattleConstants.h"
 #include "../core/utils/ui_config_manager.h"
+#include "../core/FrameProfiler.h"
+#include "../core/FrameArena.h"
 #include <cmath>
 #include <algorithm>
 #include <random>
 
+namespace {
+    /**
+     * @brief コマンド名とコマンド画像のテクスチャ名の対応
+     */
+    struct CommandTextureName {
+        const char* commandName;
+        const char* textureName;
+    };
+    
+    const CommandTextureName COMMAND_TEXTURE_NAMES[] = {
+        {"攻撃", "command_attack"},
+        {"防御", "command_defend"},
+        {"呪文", "command_magic"},
+        {"身を隠す", "command_hide"},
+        {"怯える", "command_fear"},
+        {"助けを呼ぶ", "command_help"},
+    };
+}
+
 BattleUI::BattleUI(Graphics* graphics, std::shared_ptr<Player> player, Enemy* enemy,
                    BattleLogic* battleLogic, BattleAnimationController* animationController)
     : graphics(graphics), player(player), enemy(enemy),
       battleLogic(battleLogic), animationController(animationController),
       hasUsedLastChanceMode(false) {
+    // 描画のたびに名前を組み立てて検索しないよう、使用するテクスチャとフォントをここで解決しておく
+    playerTextureId = graphics->getTextureId("player");
+    playerAdversityTextureId = graphics->getTextureId("player_adversity");
+    if (enemy) {
+        enemyTextureId = graphics->getTextureId(enemy->getTextureName());
+    }
+    backgroundTextureId = graphics->getTextureId(getBattleBackgroundName(enemy));
+    vsImageTextureId = graphics->getTextureId("vs_image");
+    lifeTextureId = graphics->getTextureId("life");
+    for (const CommandTextureName& command : COMMAND_TEXTURE_NAMES) {
+        commandTextureIds.push_back(graphics->getTextureId(command.textureName));
+    }
+    defaultFont = graphics->getFontId("default");
+}
+
+const char* BattleUI::getBattleBackgroundName(const Enemy* enemy) {
+    // 住民の場合は夜の背景、衛兵・王様の場合は城の背景、魔王の場合は魔王の背景、それ以外は通常の戦闘背景を使用
+    if (!enemy) {
+        return "battle_bg";
+    }
+    if (enemy->isResident()) {
+        return "night_bg";
+    } else if (enemy->getType() == EnemyType::GUARD || enemy->getType() == EnemyType::KING) {
+        return "castle_bg";
+    } else if (enemy->getType() == EnemyType::DEMON_LORD) {
+        return "demon_bg";
+    }
+    return "battle_bg";
+}
+
+SDL_Texture* BattleUI::getPlayerTexture() const {
+    // 窮地モードではplayer_adversity.pngを使用
+    SDL_Texture* playerTex = hasUsedLastChanceMode ? graphics->getTexture(playerAdversityTextureId) : graphics->getTexture(playerTextureId);
+    if (!playerTex && hasUsedLastChanceMode) {
+        playerTex = graphics->getTexture(playerTextureId); // フォールバック
+    }
+    return playerTex;
+}
+
+SDL_Texture* BattleUI::getEnemyTexture() const {
+    return graphics->getTexture(enemyTextureId);
 }
 
 void BattleUI::setHasUsedLastChanceMode(bool hasUsed) {
@@ -17,6 +79,7 @@ void BattleUI::setHasUsedLastChanceMode(bool hasUsed) {
 }
 
 void BattleUI::renderJudgeAnimation(const JudgeRenderParams& params) {
+    FrameProfiler::Scope profile(FrameProfiler::Section::BATTLE_UI);
     if (params.currentJudgingTurnIndex >= params.commandTurnCount) return;
     
     int screenWidth = graphics->getScreenWidth();
@@ -26,13 +89,15 @@ void BattleUI::renderJudgeAnimation(const JudgeRenderParams& params) {
     
     // JSONからプレイヤーと敵の位置を取得
     auto& config = UIConfig::UIConfigManager::getInstance();
-    auto battleConfig = config.getBattleConfig();
+    const auto& battleConfig = config.getBattleConfig();
     
-    int playerBaseX, playerBaseY;
-    config.calculatePosition(playerBaseX, playerBaseY, battleConfig.playerPosition, screenWidth, screenHeight);
+    const UIConfig::UIResolvedRect& playerBaseLayout = config.getLayout(UIConfig::UILayoutId::BATTLE_PLAYER, screenWidth, screenHeight);
+    int playerBaseX = playerBaseLayout.x;
+    int playerBaseY = playerBaseLayout.y;
     
-    int enemyBaseX, enemyBaseY;
-    config.calculatePosition(enemyBaseX, enemyBaseY, battleConfig.enemyPosition, screenWidth, screenHeight);
+    const UIConfig::UIResolvedRect& enemyBaseLayout = config.getLayout(UIConfig::UILayoutId::BATTLE_ENEMY, screenWidth, screenHeight);
+    int enemyBaseX = enemyBaseLayout.x;
+    int enemyBaseY = enemyBaseLayout.y;
     
     int leftX = playerBaseX;
     int rightX = enemyBaseX;
@@ -52,10 +117,7 @@ void BattleUI::renderJudgeAnimation(const JudgeRenderParams& params) {
     // graphics->drawRect(0, 0, screenWidth, screenHeight, true);
     
     // 窮地モードではplayer_adversity.pngを使用
-    SDL_Texture* playerTex = hasUsedLastChanceMode ? graphics->getTexture("player_adversity") : graphics->getTexture("player");
-    if (!playerTex && hasUsedLastChanceMode) {
-        playerTex = graphics->getTexture("player"); // フォールバック
-    }
+    SDL_Texture* playerTex = getPlayerTexture();
     
     if (playerTex) {
         graphics->drawTextureAspectRatio(playerTex, playerBaseX, playerBaseY, BattleConstants::BATTLE_CHARACTER_SIZE);
@@ -65,14 +127,7 @@ void BattleUI::renderJudgeAnimation(const JudgeRenderParams& params) {
     }
     
     // 住民の場合は住民の画像を使用、それ以外は通常の敵画像を使用
-    SDL_Texture* enemyTex = nullptr;
-    if (enemy->isResident()) {
-        int textureIndex = enemy->getResidentTextureIndex();
-        std::string textureName = "resident_" + std::to_string(textureIndex + 1);
-        enemyTex = graphics->getTexture(textureName);
-    } else {
-        enemyTex = graphics->getTexture("enemy_" + enemy->getTypeName());
-    }
+    SDL_Texture* enemyTex = getEnemyTexture();
     
     if (enemyTex) {
         graphics->drawTextureAspectRatio(enemyTex, enemyBaseX, enemyBaseY, BattleConstants::BATTLE_CHARACTER_SIZE);
@@ -82,19 +137,18 @@ void BattleUI::renderJudgeAnimation(const JudgeRenderParams& params) {
     }
     
     // 住民戦の場合は10ターン制限を表示
-    std::string turnText;
+    const char* turnText;
     if (params.residentTurnCount > 0) {
-        turnText = "ターン " + std::to_string(params.residentTurnCount) + " / 10";
+        turnText = FrameArena::getInstance().format("ターン %d / 10", params.residentTurnCount);
     } else {
-        turnText = "ターン " + std::to_string(params.currentJudgingTurnIndex + 1) + " / " + std::to_string(params.commandTurnCount);
+        turnText = FrameArena::getInstance().format("ターン %d / %d", params.currentJudgingTurnIndex + 1, params.commandTurnCount);
     }
     SDL_Color turnColor = {255, 255, 255, 255};
     
     // ターンテキストの背景を描画（コマンド選択フェーズと同じ位置）
-    SDL_Texture* turnTexture = graphics->createTextTexture(turnText, "default", turnColor);
-    if (turnTexture) {
-        int textWidth, textHeight;
-        SDL_QueryTexture(turnTexture, nullptr, nullptr, &textWidth, &textHeight);
+    int textWidth = 0;
+    int textHeight = 0;
+    if (graphics->measureText(turnText, defaultFont, textWidth, textHeight)) {
         
         // コマンド選択フェーズと同じ位置に設定
         int turnNumberY = 70; // コマンド選択フェーズと同じ位置
@@ -108,13 +162,11 @@ void BattleUI::renderJudgeAnimation(const JudgeRenderParams& params) {
         graphics->drawRect(bgX, bgY, bgWidth, bgHeight, true);
         graphics->setDrawColor(255, 255, 255, 255);
         graphics->drawRect(bgX, bgY, bgWidth, bgHeight, false);
-        
-        SDL_DestroyTexture(turnTexture);
     }
     
     // コマンド選択フェーズと同じ位置にテキストを描画
     int turnNumberY = 70; // コマンド選択フェーズと同じ位置
-    graphics->drawText(turnText, 18, turnNumberY, "default", turnColor);
+    graphics->drawText(turnText, 18, turnNumberY, defaultFont, turnColor);
     
     int hitCount = params.residentHitCount;
     renderHP(playerBaseX, playerBaseY, enemyBaseX, enemyBaseY, BattleConstants::BATTLE_CHARACTER_SIZE, BattleConstants::BATTLE_CHARACTER_SIZE, params.residentBehaviorHint, false, hitCount);
@@ -133,7 +185,7 @@ void BattleUI::renderJudgeAnimation(const JudgeRenderParams& params) {
             playerCmd = params.playerCommandName;
         } else {
             // 通常戦闘：battleLogicから取得
-            auto playerCmds = battleLogic->getPlayerCommands();
+            const auto& playerCmds = battleLogic->getPlayerCommands();
             playerCmd = BattleLogic::getCommandName(playerCmds[params.currentJudgingTurnIndex]);
         }
         SDL_Color playerCmdColor = {255, 255, 255, 255}; // 白いテキスト
@@ -167,10 +219,10 @@ void BattleUI::renderJudgeAnimation(const JudgeRenderParams& params) {
             graphics->drawTexture(playerCmdImage, imageX, imageY, displayWidth, displayHeight);
         } else {
             // フォールバック：テキスト表示
-        SDL_Texture* playerCmdTexture = graphics->createTextTexture(playerCmd, "default", playerCmdColor);
-        if (playerCmdTexture) {
-            int textWidth, textHeight;
-            SDL_QueryTexture(playerCmdTexture, nullptr, nullptr, &textWidth, &textHeight);
+        TextTexture playerCmdTexture = graphics->getTextTexture(playerCmd, defaultFont, playerCmdColor);
+        if (playerCmdTexture.texture) {
+            int textWidth = playerCmdTexture.width;
+            int textHeight = playerCmdTexture.height;
             
             int scaledWidth = static_cast<int>(textWidth * BattleConstants::JUDGE_COMMAND_TEXT_SCALE);
             int scaledHeight = static_cast<int>(textHeight * BattleConstants::JUDGE_COMMAND_TEXT_SCALE);
@@ -186,10 +238,9 @@ void BattleUI::renderJudgeAnimation(const JudgeRenderParams& params) {
             graphics->setDrawColor(255, 255, 255, 255);
             graphics->drawRect(bgX, bgY, bgWidth, bgHeight, false);
             
-            graphics->drawTexture(playerCmdTexture, cmdTextX, cmdTextY, scaledWidth, scaledHeight);
-            SDL_DestroyTexture(playerCmdTexture);
+            graphics->drawTexture(playerCmdTexture.texture, cmdTextX, cmdTextY, scaledWidth, scaledHeight);
         } else {
-            graphics->drawText(playerCmd, cmdTextX, cmdTextY, "default", playerCmdColor);
+            graphics->drawText(playerCmd, cmdTextX, cmdTextY, defaultFont, playerCmdColor);
             }
         }
     }
@@ -210,7 +261,7 @@ void BattleUI::renderJudgeAnimation(const JudgeRenderParams& params) {
         
         if (shouldShowVS) {
             // VS画像を表示
-            SDL_Texture* vsImage = graphics->getTexture("vs_image");
+            SDL_Texture* vsImage = graphics->getTexture(vsImageTextureId);
             if (vsImage) {
                 int imageWidth, imageHeight;
                 SDL_QueryTexture(vsImage, nullptr, nullptr, &imageWidth, &imageHeight);
@@ -238,7 +289,7 @@ void BattleUI::renderJudgeAnimation(const JudgeRenderParams& params) {
                 // フォールバック：テキスト表示
                 std::string vsText = "VS";
                 SDL_Color vsTextColor = {255, 255, 255, 255};
-                graphics->drawText(vsText, centerX - 30, centerY + BattleConstants::JUDGE_COMMAND_Y_OFFSET, "default", vsTextColor);
+                graphics->drawText(vsText, centerX - 30, centerY + BattleConstants::JUDGE_COMMAND_Y_OFFSET, defaultFont, vsTextColor);
             }
         }
         
@@ -259,7 +310,7 @@ void BattleUI::renderJudgeAnimation(const JudgeRenderParams& params) {
                 enemyCmd = params.enemyCommandName;
             } else {
                 // 通常戦闘：battleLogicから取得
-                auto enemyCmds = battleLogic->getEnemyCommands();
+                const auto& enemyCmds = battleLogic->getEnemyCommands();
                 // 範囲チェック
                 if (params.currentJudgingTurnIndex >= 0 && 
                     params.currentJudgingTurnIndex < static_cast<int>(enemyCmds.size())) {
@@ -301,10 +352,10 @@ void BattleUI::renderJudgeAnimation(const JudgeRenderParams& params) {
                     graphics->drawTexture(enemyCmdImage, imageX, imageY, displayWidth, displayHeight);
                 } else {
                     // フォールバック：テキスト表示
-                SDL_Texture* enemyCmdTexture = graphics->createTextTexture(enemyCmd, "default", enemyCmdColor);
-                if (enemyCmdTexture) {
-                    int textWidth, textHeight;
-                    SDL_QueryTexture(enemyCmdTexture, nullptr, nullptr, &textWidth, &textHeight);
+                TextTexture enemyCmdTexture = graphics->getTextTexture(enemyCmd, defaultFont, enemyCmdColor);
+                if (enemyCmdTexture.texture) {
+                    int textWidth = enemyCmdTexture.width;
+                    int textHeight = enemyCmdTexture.height;
                     
                     int scaledWidth = static_cast<int>(textWidth * BattleConstants::JUDGE_COMMAND_TEXT_SCALE);
                     int scaledHeight = static_cast<int>(textHeight * BattleConstants::JUDGE_COMMAND_TEXT_SCALE);
@@ -320,10 +371,9 @@ void BattleUI::renderJudgeAnimation(const JudgeRenderParams& params) {
                     graphics->setDrawColor(255, 255, 255, 255);
                     graphics->drawRect(bgX, bgY, bgWidth, bgHeight, false);
                     
-                    graphics->drawTexture(enemyCmdTexture, cmdTextX, cmdTextY, scaledWidth, scaledHeight);
-                    SDL_DestroyTexture(enemyCmdTexture);
+                    graphics->drawTexture(enemyCmdTexture.texture, cmdTextX, cmdTextY, scaledWidth, scaledHeight);
                 } else {
-                    graphics->drawText(enemyCmd, cmdTextX, cmdTextY, "default", enemyCmdColor);
+                    graphics->drawText(enemyCmd, cmdTextX, cmdTextY, defaultFont, enemyCmdColor);
                     }
                 }
             }
@@ -346,7 +396,7 @@ void BattleUI::renderJudgeAnimation(const JudgeRenderParams& params) {
         // JSONから設定を取得
         auto& judgePhaseConfig = battleConfig.judgePhase;
         
-        std::string resultText;
+        const char* resultText;
         SDL_Color resultTextColor;
         SDL_Color resultBackgroundColor;
         
@@ -354,15 +404,15 @@ void BattleUI::renderJudgeAnimation(const JudgeRenderParams& params) {
         float scale = BattleConstants::JUDGE_RESULT_MIN_SCALE + scaleProgress * BattleConstants::JUDGE_RESULT_SCALE_RANGE;
         
         if (result == 1) {
-            resultText = judgePhaseConfig.win.text;
+            resultText = judgePhaseConfig.win.text.c_str();
             resultTextColor = judgePhaseConfig.win.textColor;
             resultBackgroundColor = judgePhaseConfig.win.backgroundColor;
         } else if (result == -1) {
-            resultText = judgePhaseConfig.lose.text;
+            resultText = judgePhaseConfig.lose.text.c_str();
             resultTextColor = judgePhaseConfig.lose.textColor;
             resultBackgroundColor = judgePhaseConfig.lose.backgroundColor;
         } else {
-            resultText = judgePhaseConfig.draw.text;
+            resultText = judgePhaseConfig.draw.text.c_str();
             resultTextColor = judgePhaseConfig.draw.textColor;
             resultBackgroundColor = judgePhaseConfig.draw.backgroundColor;
         }
@@ -388,7 +438,7 @@ void BattleUI::renderJudgeAnimation(const JudgeRenderParams& params) {
         graphics->drawRect(textX - backgroundPadding, textY - backgroundPadding, scaledWidth + backgroundPadding * 2, scaledHeight + backgroundPadding * 2, true);
         
         // テキストを描画（テキスト色を使用）
-        graphics->drawText(resultText, textX, textY, "default", resultTextColor);
+        graphics->drawText(resultText, textX, textY, defaultFont, resultTextColor);
         
         if (result == 1) {
             float glowProgress = std::sin(params.judgeDisplayTimer * 3.14159f * 4.0f) * 0.5f + 0.5f;
@@ -400,8 +450,9 @@ void BattleUI::renderJudgeAnimation(const JudgeRenderParams& params) {
 }
 
 void BattleUI::renderCommandSelectionUI(const CommandSelectRenderParams& params) {
+    FrameProfiler::Scope profile(FrameProfiler::Section::BATTLE_UI);
     // フォントが読み込まれていない場合は描画をスキップ
-    if (!graphics->getFont("default")) {
+    if (!graphics->getFont(defaultFont)) {
         return;
     }
     
@@ -426,15 +477,13 @@ void BattleUI::renderCommandSelectionUI(const CommandSelectRenderParams& params)
     
     // JSONからプレイヤーと敵の位置を取得
     auto& config = UIConfig::UIConfigManager::getInstance();
-    auto battleConfig = config.getBattleConfig();
+    const auto& battleConfig = config.getBattleConfig();
     
-    int playerBaseX, playerBaseY;
-    config.calculatePosition(playerBaseX, playerBaseY, battleConfig.playerPosition, screenWidth, screenHeight);
+    const UIConfig::UIResolvedRect& playerBaseLayout = config.getLayout(UIConfig::UILayoutId::BATTLE_PLAYER, screenWidth, screenHeight);
+    int playerBaseX = playerBaseLayout.x;
+    int playerBaseY = playerBaseLayout.y;
     // 窮地モードではplayer_adversity.pngを使用
-    SDL_Texture* playerTex = hasUsedLastChanceMode ? graphics->getTexture("player_adversity") : graphics->getTexture("player");
-    if (!playerTex && hasUsedLastChanceMode) {
-        playerTex = graphics->getTexture("player"); // フォールバック
-    }
+    SDL_Texture* playerTex = getPlayerTexture();
     
     if (playerTex) {
         graphics->drawTextureAspectRatio(playerTex, playerBaseX, playerBaseY, BattleConstants::BATTLE_CHARACTER_SIZE);
@@ -443,30 +492,12 @@ void BattleUI::renderCommandSelectionUI(const CommandSelectRenderParams& params)
         graphics->drawRect(playerBaseX - BattleConstants::BATTLE_CHARACTER_SIZE / 2, playerBaseY - BattleConstants::BATTLE_CHARACTER_SIZE / 2, BattleConstants::BATTLE_CHARACTER_SIZE, BattleConstants::BATTLE_CHARACTER_SIZE, true);
     }
     
-    int enemyBaseX, enemyBaseY;
-    config.calculatePosition(enemyBaseX, enemyBaseY, battleConfig.enemyPosition, screenWidth, screenHeight);
+    const UIConfig::UIResolvedRect& enemyBaseLayout = config.getLayout(UIConfig::UILayoutId::BATTLE_ENEMY, screenWidth, screenHeight);
+    int enemyBaseX = enemyBaseLayout.x;
+    int enemyBaseY = enemyBaseLayout.y;
     
     // 住民の場合は住民の画像を使用、それ以外は通常の敵画像を使用
-    SDL_Texture* enemyTex = nullptr;
-    bool isResident = false;
-    try {
-        isResident = enemy->isResident();
-    } catch (const std::exception& e) {
-        std::cerr << "[ERROR] Exception in enemy->isResident(): " << e.what() << std::endl;
-        return;
-    } catch (...) {
-        std::cerr << "[ERROR] Unknown exception in enemy->isResident()" << std::endl;
-        return;
-    }
-    
-    if (isResident) {
-        int textureIndex = enemy->getResidentTextureIndex();
-        std::string textureName = "resident_" + std::to_string(textureIndex + 1);
-        enemyTex = graphics->getTexture(textureName);
-    } else {
-        std::string typeName = enemy->getTypeName();
-        enemyTex = graphics->getTexture("enemy_" + typeName);
-    }
+    SDL_Texture* enemyTex = getEnemyTexture();
     
     if (enemyTex) {
         graphics->drawTextureAspectRatio(enemyTex, enemyBaseX, enemyBaseY, BattleConstants::BATTLE_CHARACTER_SIZE);
@@ -516,8 +547,10 @@ void BattleUI::renderCommandSelectionUI(const CommandSelectRenderParams& params)
         int startX = centerX - ((params.currentSelectingTurn - 1) * imageSpacing / 2);
         
         int totalWidth = 0;
-        std::vector<SDL_Texture*> commandImages;
-        std::vector<int> imageWidths;
+        ArenaVector<SDL_Texture*> commandImages;
+        ArenaVector<int> imageWidths;
+        commandImages.reserve(params.currentSelectingTurn);
+        imageWidths.reserve(params.currentSelectingTurn);
         
         // まず全ての画像を取得してサイズを計算
         for (int i = 0; i < params.currentSelectingTurn && i < static_cast<int>(playerCmds.size()); i++) {
@@ -589,7 +622,7 @@ void BattleUI::renderCommandSelectionUI(const CommandSelectRenderParams& params)
                 // フォールバック：テキスト表示
                 std::string cmdName = BattleLogic::getCommandName(playerCmds[i]);
                 SDL_Color selectedCmdColor = {255, 255, 255, 255};
-                graphics->drawText(cmdName, currentX, selectedCmdY - 15, "default", selectedCmdColor);
+                graphics->drawText(cmdName, currentX, selectedCmdY - 15, defaultFont, selectedCmdColor);
                 currentX += 60;
             }
         }
@@ -652,10 +685,10 @@ void BattleUI::renderCommandSelectionUI(const CommandSelectRenderParams& params)
                 int textX = startX + (buttonWidth / 2) - 50;
                 int textY = buttonY + (buttonHeight / 2) - 15;
                 if (isSelected) {
-                    graphics->drawText("▶", textX - 30, textY, "default", {255, 215, 0, 255});
-                    graphics->drawText(commandName, textX, textY, "default", textColor);
+                    graphics->drawText("▶", textX - 30, textY, defaultFont, {255, 215, 0, 255});
+                    graphics->drawText(commandName, textX, textY, defaultFont, textColor);
                 } else {
-                    graphics->drawText(commandName, textX, textY, "default", textColor);
+                    graphics->drawText(commandName, textX, textY, defaultFont, textColor);
                 }
                 continue;
             }
@@ -666,10 +699,10 @@ void BattleUI::renderCommandSelectionUI(const CommandSelectRenderParams& params)
                 int textX = startX + (buttonWidth / 2) - 50;
                 int textY = buttonY + (buttonHeight / 2) - 15;
                 if (isSelected) {
-                    graphics->drawText("▶", textX - 30, textY, "default", {255, 215, 0, 255});
-                    graphics->drawText(commandName, textX, textY, "default", textColor);
+                    graphics->drawText("▶", textX - 30, textY, defaultFont, {255, 215, 0, 255});
+                    graphics->drawText(commandName, textX, textY, defaultFont, textColor);
                 } else {
-                    graphics->drawText(commandName, textX, textY, "default", textColor);
+                    graphics->drawText(commandName, textX, textY, defaultFont, textColor);
                 }
                 continue;
             }
@@ -683,10 +716,10 @@ void BattleUI::renderCommandSelectionUI(const CommandSelectRenderParams& params)
                 int textX = startX + (buttonWidth / 2) - 50;
                 int textY = buttonY + (buttonHeight / 2) - 15;
                 if (isSelected) {
-                    graphics->drawText("▶", textX - 30, textY, "default", {255, 215, 0, 255});
-                    graphics->drawText(commandName, textX, textY, "default", textColor);
+                    graphics->drawText("▶", textX - 30, textY, defaultFont, {255, 215, 0, 255});
+                    graphics->drawText(commandName, textX, textY, defaultFont, textColor);
                 } else {
-                    graphics->drawText(commandName, textX, textY, "default", textColor);
+                    graphics->drawText(commandName, textX, textY, defaultFont, textColor);
                 }
                 continue;
             }
@@ -695,7 +728,7 @@ void BattleUI::renderCommandSelectionUI(const CommandSelectRenderParams& params)
             int imageY = buttonY + (buttonHeight / 2) - (displayHeight / 2);
             
             if (isSelected) {
-                graphics->drawText("▶", startX + 10, buttonY + (buttonHeight / 2) - 15, "default", cmdSelectConfig.selectedBorderColor);
+                graphics->drawText("▶", startX + 10, buttonY + (buttonHeight / 2) - 15, defaultFont, cmdSelectConfig.selectedBorderColor);
             }
             // テクスチャが有効な場合のみ描画
             if (commandImage && displayWidth > 0 && displayHeight > 0) {
@@ -707,21 +740,21 @@ void BattleUI::renderCommandSelectionUI(const CommandSelectRenderParams& params)
             int textY = buttonY + (buttonHeight / 2) - 15;
             
             if (isSelected) {
-                graphics->drawText("▶", textX - 30, textY, "default", {255, 215, 0, 255});
-                graphics->drawText(commandName, textX, textY, "default", textColor);
+                graphics->drawText("▶", textX - 30, textY, defaultFont, {255, 215, 0, 255});
+                graphics->drawText(commandName, textX, textY, defaultFont, textColor);
             } else {
-                graphics->drawText(commandName, textX, textY, "default", textColor);
+                graphics->drawText(commandName, textX, textY, defaultFont, textColor);
             }
         }
     }
     
     // コマンド選択ヒントテキスト（JSONから設定を取得）
     auto& commandHintConfig = battleConfig.commandHint;
-    std::string hintText;
+    const char* hintText;
     if (params.residentTurnCount > 0) {
-        hintText = commandHintConfig.residentText;
+        hintText = commandHintConfig.residentText.c_str();
     } else {
-        hintText = commandHintConfig.normalText;
+        hintText = commandHintConfig.normalText.c_str();
     }
     SDL_Color hintColor = commandHintConfig.color;
     
@@ -736,10 +769,9 @@ void BattleUI::renderCommandSelectionUI(const CommandSelectRenderParams& params)
     }
     
     // 選択方法のテキスト背景を描画
-    SDL_Texture* hintTexture = graphics->createTextTexture(hintText, "default", hintColor);
-    if (hintTexture) {
-        int textWidth, textHeight;
-        SDL_QueryTexture(hintTexture, nullptr, nullptr, &textWidth, &textHeight);
+    int textWidth = 0;
+    int textHeight = 0;
+    if (graphics->measureText(hintText, defaultFont, textWidth, textHeight)) {
         
         int padding = commandHintConfig.padding;
         int bgX = hintX - padding;
@@ -751,17 +783,16 @@ void BattleUI::renderCommandSelectionUI(const CommandSelectRenderParams& params)
         graphics->drawRect(bgX, bgY, bgWidth, bgHeight, true);
         graphics->setDrawColor(255, 255, 255, 255);
         graphics->drawRect(bgX, bgY, bgWidth, bgHeight, false);
-        
-        SDL_DestroyTexture(hintTexture);
     }
     
-    graphics->drawText(hintText, hintX, hintY, "default", hintColor);
+    graphics->drawText(hintText, hintX, hintY, defaultFont, hintColor);
     
     int hitCount = params.residentHitCount;
     renderHP(playerBaseX, playerBaseY, enemyBaseX, enemyBaseY, BattleConstants::BATTLE_CHARACTER_SIZE, BattleConstants::BATTLE_CHARACTER_SIZE, params.residentBehaviorHint, false, hitCount);
 }
 
 void BattleUI::renderResultAnnouncement(const ResultAnnouncementRenderParams& params) {
+    FrameProfiler::Scope profile(FrameProfiler::Section::BATTLE_UI);
     int screenWidth = graphics->getScreenWidth();
     int screenHeight = graphics->getScreenHeight();
     int centerX = screenWidth / 2;
@@ -769,7 +800,7 @@ void BattleUI::renderResultAnnouncement(const ResultAnnouncementRenderParams& pa
     
     // JSONから設定を取得（ホットリロード対応のため、毎回取得）
     auto& config = UIConfig::UIConfigManager::getInstance();
-    auto battleConfig = config.getBattleConfig();
+    const auto& battleConfig = config.getBattleConfig();
     
     // 画面をクリア（背景画像で覆う前に）
     graphics->setDrawColor(0, 0, 0, 255);
@@ -786,7 +817,7 @@ void BattleUI::renderResultAnnouncement(const ResultAnnouncementRenderParams& pa
     // graphics->drawRect(0, 0, screenWidth, screenHeight, true);
     
     // メイン結果テキスト（JSONから設定を取得）
-    std::string mainText;
+    const char* mainText;
     SDL_Color mainTextColor;
     SDL_Color mainBackgroundColor;
     
@@ -800,23 +831,13 @@ void BattleUI::renderResultAnnouncement(const ResultAnnouncementRenderParams& pa
         } else if (params.hasThreeWinStreak) {
             // 3連勝の場合は「3連勝！ダメージ{multiplier}倍ボーナス！」を表示
             float multiplier = BattleConstants::THREE_WIN_STREAK_MULTIPLIER;
-            std::string multiplierStr;
-            // 小数点以下が0の場合は整数として表示、そうでない場合は小数点以下1桁まで表示
+            // 小数点以下が0の場合は整数として表示、そうでない場合は小数点以下1桁まで表示（切り捨て）
             if (multiplier == static_cast<int>(multiplier)) {
-                multiplierStr = std::to_string(static_cast<int>(multiplier));
+                mainText = FrameArena::getInstance().format("3連勝！ダメージ%d倍ボーナス！", static_cast<int>(multiplier));
             } else {
-                multiplierStr = std::to_string(multiplier);
-                // 小数点以下1桁までに制限（例: 2.5 → "2.5", 2.50 → "2.5"）
-                size_t dotPos = multiplierStr.find('.');
-                if (dotPos != std::string::npos && dotPos + 2 < multiplierStr.length()) {
-                    multiplierStr = multiplierStr.substr(0, dotPos + 2);
-                    // 末尾の0を削除（例: "2.50" → "2.5"）
-                    if (multiplierStr.back() == '0') {
-                        multiplierStr.pop_back();
-                    }
-                }
+                int multiplierInt = static_cast<int>(multiplier * 10);
+                mainText = FrameArena::getInstance().format("3連勝！ダメージ%d.%d倍ボーナス！", multiplierInt / 10, multiplierInt % 10);
             }
-            mainText = "3連勝！ダメージ" + multiplierStr + "倍ボーナス！";
             mainTextColor = resultTextConfig.victory.textColor;
             mainBackgroundColor = resultTextConfig.victory.backgroundColor;
         } else {
@@ -865,7 +886,7 @@ void BattleUI::renderResultAnnouncement(const ResultAnnouncementRenderParams& pa
                           mainBackgroundColor.a);
     graphics->drawRect(textX - 30, textY - 30, scaledWidth + 60, scaledHeight + 60, true);
     
-    graphics->drawText(mainText, textX, textY, "default", mainTextColor);
+    graphics->drawText(mainText, textX, textY, defaultFont, mainTextColor);
     
     if (params.isVictory) {
         float outerGlow = std::sin(resultState.resultAnimationTimer * 3.14159f * 6.0f) * 0.5f + 0.5f;
@@ -912,18 +933,20 @@ void BattleUI::renderResultAnnouncement(const ResultAnnouncementRenderParams& pa
             float angle = (i * 3.14159f * 2.0f) / 8.0f;
             int starX = centerX + (int)(std::cos(angle) * starRadius * starDisplayScale);
             int starY = centerY - 100 + (int)(std::sin(angle) * starRadius * starDisplayScale);
-            graphics->drawText("★", starX, starY, "default", starColor);
+            graphics->drawText("★", starX, starY, defaultFont, starColor);
         }
     }
     
     // 敗北時の暗いオーバーレイを削除（勝った時と同じように背景が見えるように）
     
     // プレイヤーと敵の位置を取得（battleConfigは既に取得済み）
-    int playerBaseX, playerBaseY;
-    config.calculatePosition(playerBaseX, playerBaseY, battleConfig.playerPosition, screenWidth, screenHeight);
+    const UIConfig::UIResolvedRect& playerBaseLayout = config.getLayout(UIConfig::UILayoutId::BATTLE_PLAYER, screenWidth, screenHeight);
+    int playerBaseX = playerBaseLayout.x;
+    int playerBaseY = playerBaseLayout.y;
     
-    int enemyBaseX, enemyBaseY;
-    config.calculatePosition(enemyBaseX, enemyBaseY, battleConfig.enemyPosition, screenWidth, screenHeight);
+    const UIConfig::UIResolvedRect& enemyBaseLayout = config.getLayout(UIConfig::UILayoutId::BATTLE_ENEMY, screenWidth, screenHeight);
+    int enemyBaseX = enemyBaseLayout.x;
+    int enemyBaseY = enemyBaseLayout.y;
     
     auto& charState = animationController->getCharacterState();
     int playerX = playerBaseX + (int)charState.playerAttackOffsetX + (int)charState.playerHitOffsetX;
@@ -947,11 +970,9 @@ void BattleUI::renderResultAnnouncement(const ResultAnnouncementRenderParams& pa
 
 void BattleUI::renderCharacters(int playerX, int playerY, int enemyX, int enemyY,
                                  int playerWidth, int playerHeight, int enemyWidth, int enemyHeight) {
+    FrameProfiler::Scope profile(FrameProfiler::Section::BATTLE_UI);
     // 窮地モードではplayer_adversity.pngを使用
-    SDL_Texture* playerTex = hasUsedLastChanceMode ? graphics->getTexture("player_adversity") : graphics->getTexture("player");
-    if (!playerTex && hasUsedLastChanceMode) {
-        playerTex = graphics->getTexture("player"); // フォールバック
-    }
+    SDL_Texture* playerTex = getPlayerTexture();
     
     if (playerTex) {
         graphics->drawTextureAspectRatio(playerTex, playerX, playerY, BattleConstants::BATTLE_CHARACTER_SIZE);
@@ -963,16 +984,7 @@ void BattleUI::renderCharacters(int playerX, int playerY, int enemyX, int enemyY
     }
     
     // 住民の場合は住民の画像を使用、それ以外は通常の敵画像を使用
-    SDL_Texture* enemyTex = nullptr;
-    if (enemy) {
-        if (enemy->isResident()) {
-            int textureIndex = enemy->getResidentTextureIndex();
-            std::string textureName = "resident_" + std::to_string(textureIndex + 1);
-            enemyTex = graphics->getTexture(textureName);
-        } else {
-            enemyTex = graphics->getTexture("enemy_" + enemy->getTypeName());
-        }
-    }
+    SDL_Texture* enemyTex = getEnemyTexture();
     
     if (enemyTex) {
         graphics->drawTextureAspectRatio(enemyTex, enemyX, enemyY, BattleConstants::BATTLE_CHARACTER_SIZE);
@@ -986,28 +998,27 @@ void BattleUI::renderCharacters(int playerX, int playerY, int enemyX, int enemyY
 
 void BattleUI::renderHP(int playerX, int playerY, int enemyX, int enemyY,
                   int playerHeight, int enemyHeight, const std::string& residentBehaviorHint, bool hideEnemyUI, int residentHitCount) {
+    FrameProfiler::Scope profile(FrameProfiler::Section::BATTLE_UI);
     auto& config = UIConfig::UIConfigManager::getInstance();
-    auto battleConfig = config.getBattleConfig();
+    const auto& battleConfig = config.getBattleConfig();
     
     int padding = BattleConstants::JUDGE_COMMAND_TEXT_PADDING_SMALL;
     
     // プレイヤーの名前とレベル（HPの上に表示）- 住民戦でも表示
-    std::string playerNameText = player->getName() + " Lv." + std::to_string(player->getLevel());
-    SDL_Texture* playerNameTexture = graphics->createTextTexture(playerNameText, "default", battleConfig.playerName.color);
-    if (playerNameTexture) {
-        int textWidth, textHeight;
-        SDL_QueryTexture(playerNameTexture, nullptr, nullptr, &textWidth, &textHeight);
+    const char* playerNameText = FrameArena::getInstance().format("%s Lv.%d", player->getName().c_str(), player->getLevel());
+    int textWidth = 0;
+    int textHeight = 0;
+    if (graphics->measureText(playerNameText, defaultFont, textWidth, textHeight)) {
         int bgX = static_cast<int>(playerX + battleConfig.playerName.offsetX - padding);
         int bgY = static_cast<int>(playerY - playerHeight / 2 + battleConfig.playerName.offsetY - padding);
         graphics->setDrawColor(0, 0, 0, BattleConstants::BATTLE_BACKGROUND_ALPHA);
         graphics->drawRect(bgX, bgY, textWidth + padding * 2, textHeight + padding * 2, true);
         graphics->setDrawColor(255, 255, 255, 255);
         graphics->drawRect(bgX, bgY, textWidth + padding * 2, textHeight + padding * 2, false);
-        SDL_DestroyTexture(playerNameTexture);
     }
     int playerNameX = static_cast<int>(playerX + battleConfig.playerName.offsetX);
     int playerNameY = static_cast<int>(playerY - playerHeight / 2 + battleConfig.playerName.offsetY);
-    graphics->drawText(playerNameText, playerNameX, playerNameY, "default", battleConfig.playerName.color);
+    graphics->drawText(playerNameText, playerNameX, playerNameY, defaultFont, battleConfig.playerName.color);
     
     // 住民戦の場合はプレイヤーのHP表示をスキップ
     if (!enemy->isResident()) {
@@ -1047,25 +1058,21 @@ void BattleUI::renderHP(int playerX, int playerY, int enemyX, int enemyY,
         int turns = player->getNextTurnBonusTurns();
         // 倍率を文字列に変換（小数点以下1桁まで表示）
         int multiplierInt = static_cast<int>(multiplier * 10);
-        std::string multiplierStr = std::to_string(multiplierInt / 10) + "." + std::to_string(multiplierInt % 10);
-        // プレースホルダーを使わずに直接文字列を組み立て（文字化けを防ぐため）
-        std::string statusText = "攻撃倍率: " + multiplierStr + "倍 (残り" + std::to_string(turns) + "ターン)";
+        const char* statusText = FrameArena::getInstance().format("攻撃倍率: %d.%d倍 (残り%dターン)", multiplierInt / 10, multiplierInt % 10, turns);
             SDL_Color statusColor = attackMultiplierConfig.textColor;
-        SDL_Texture* statusTexture = graphics->createTextTexture(statusText, "default", statusColor);
-        if (statusTexture) {
-            int textWidth, textHeight;
-            SDL_QueryTexture(statusTexture, nullptr, nullptr, &textWidth, &textHeight);
+        int textWidth = 0;
+        int textHeight = 0;
+        if (graphics->measureText(statusText, defaultFont, textWidth, textHeight)) {
                 int bgX = static_cast<int>(playerX + attackMultiplierConfig.offsetX - attackMultiplierConfig.padding);
                 int bgY = static_cast<int>(playerY - playerHeight / 2 + attackMultiplierConfig.offsetY - attackMultiplierConfig.padding);
                 graphics->setDrawColor(attackMultiplierConfig.bgColor.r, attackMultiplierConfig.bgColor.g, attackMultiplierConfig.bgColor.b, BattleConstants::BATTLE_BACKGROUND_ALPHA);
                 graphics->drawRect(bgX, bgY, textWidth + attackMultiplierConfig.padding * 2, textHeight + attackMultiplierConfig.padding * 2, true);
                 graphics->setDrawColor(attackMultiplierConfig.borderColor.r, attackMultiplierConfig.borderColor.g, attackMultiplierConfig.borderColor.b, attackMultiplierConfig.borderColor.a);
                 graphics->drawRect(bgX, bgY, textWidth + attackMultiplierConfig.padding * 2, textHeight + attackMultiplierConfig.padding * 2, false);
-            SDL_DestroyTexture(statusTexture);
         }
             int statusTextX = static_cast<int>(playerX + attackMultiplierConfig.offsetX);
             int statusTextY = static_cast<int>(playerY - playerHeight / 2 + attackMultiplierConfig.offsetY);
-            graphics->drawText(statusText, statusTextX, statusTextY, "default", statusColor);
+            graphics->drawText(statusText, statusTextX, statusTextY, defaultFont, statusColor);
         }
     }
     
@@ -1099,8 +1106,13 @@ void BattleUI::renderHP(int playerX, int playerY, int enemyX, int enemyY,
     
     // 敵の名前とレベル（HPの位置に表示、体力に応じて色を変更）
     // 住民の場合は住民の名前を使用、それ以外は通常の敵名を使用
-    std::string enemyName = enemy ? (enemy->isResident() ? enemy->getName() : enemy->getTypeName()) : "敵";
-    std::string enemyNameText = enemyName + " Lv." + std::to_string(enemy ? enemy->getLevel() : 0);
+    const char* enemyNameText;
+    if (enemy) {
+        const std::string enemyName = enemy->isResident() ? enemy->getName() : enemy->getTypeName();
+        enemyNameText = FrameArena::getInstance().format("%s Lv.%d", enemyName.c_str(), enemy->getLevel());
+    } else {
+        enemyNameText = "敵 Lv.0";
+    }
     
     // 体力に応じて色を決定
     SDL_Color whiteColor = {255, 255, 255, 255};
@@ -1128,22 +1140,20 @@ void BattleUI::renderHP(int playerX, int playerY, int enemyX, int enemyY,
     if (enemy->isResident()) {
         // 住民名を少し上に移動（通常より30ピクセル上）
         int residentNameOffsetY = -40; // 通常の-50から-80に変更
-        SDL_Texture* enemyNameTexture = graphics->createTextTexture(enemyNameText, "default", enemyNameColor);
-        if (enemyNameTexture) {
-            int textWidth, textHeight;
-            SDL_QueryTexture(enemyNameTexture, nullptr, nullptr, &textWidth, &textHeight);
+        int textWidth = 0;
+        int textHeight = 0;
+        if (graphics->measureText(enemyNameText, defaultFont, textWidth, textHeight)) {
             int bgX = enemyX - 50 - padding;
             int bgY = enemyY - enemyHeight / 2 - padding + residentNameOffsetY;
             graphics->setDrawColor(0, 0, 0, BattleConstants::BATTLE_BACKGROUND_ALPHA);
             graphics->drawRect(bgX, bgY, textWidth + padding * 2, textHeight + padding * 2, true);
             graphics->setDrawColor(255, 255, 255, 255);
             graphics->drawRect(bgX, bgY, textWidth + padding * 2, textHeight + padding * 2, false);
-            SDL_DestroyTexture(enemyNameTexture);
         }
-        graphics->drawText(enemyNameText, enemyX - 50, enemyY - enemyHeight / 2 + residentNameOffsetY, "default", enemyNameColor);
+        graphics->drawText(enemyNameText, enemyX - 50, enemyY - enemyHeight / 2 + residentNameOffsetY, defaultFont, enemyNameColor);
         
         // life.pngを3つ横並びで表示（住民名の下）
-        SDL_Texture* lifeTexture = graphics->getTexture("life");
+        SDL_Texture* lifeTexture = graphics->getTexture(lifeTextureId);
         if (lifeTexture) {
             int lifeSize = 50; // life.pngの表示サイズ
             int lifeSpacing = 5; // life.pngの間隔
@@ -1162,10 +1172,9 @@ void BattleUI::renderHP(int playerX, int playerY, int enemyX, int enemyY,
         }
     } else {
         // 通常の戦闘の場合は従来通り
-        SDL_Texture* enemyNameTexture = graphics->createTextTexture(enemyNameText, "default", enemyNameColor);
-        if (enemyNameTexture) {
-            int textWidth, textHeight;
-            SDL_QueryTexture(enemyNameTexture, nullptr, nullptr, &textWidth, &textHeight);
+        int textWidth = 0;
+        int textHeight = 0;
+        if (graphics->measureText(enemyNameText, defaultFont, textWidth, textHeight)) {
             int bgX = enemyX - 50 - padding;
             // ヒントが表示されている場合は、名前の位置を下にずらす
             int nameOffsetY = hasHint ? 40 : 0;
@@ -1174,18 +1183,16 @@ void BattleUI::renderHP(int playerX, int playerY, int enemyX, int enemyY,
             graphics->drawRect(bgX, bgY, textWidth + padding * 2, textHeight + padding * 2, true);
             graphics->setDrawColor(255, 255, 255, 255);
             graphics->drawRect(bgX, bgY, textWidth + padding * 2, textHeight + padding * 2, false);
-            SDL_DestroyTexture(enemyNameTexture);
         }
         // ヒントが表示されている場合は、名前の位置を下にずらす
         int nameOffsetY = hasHint ? 40 : 0;
-        graphics->drawText(enemyNameText, enemyX - 50, enemyY - enemyHeight / 2 + nameOffsetY-50, "default", enemyNameColor);
+        graphics->drawText(enemyNameText, enemyX - 50, enemyY - enemyHeight / 2 + nameOffsetY-50, defaultFont, enemyNameColor);
     }
     
     if (hasHint) {
-            SDL_Texture* hintTexture = graphics->createTextTexture(hintText, "default", whiteColor);
-            if (hintTexture) {
-                int hintWidth, hintHeight;
-                SDL_QueryTexture(hintTexture, nullptr, nullptr, &hintWidth, &hintHeight);
+            int hintWidth = 0;
+            int hintHeight = 0;
+            if (graphics->measureText(hintText, defaultFont, hintWidth, hintHeight)) {
                 int hintBgX = enemyX - 80 - padding;
                 int hintOffsetY = hasHint ? 40 : 0;
                 int hintBgY = enemyY - enemyHeight / 2 + 250 - padding + hintOffsetY;
@@ -1193,23 +1200,19 @@ void BattleUI::renderHP(int playerX, int playerY, int enemyX, int enemyY,
                 graphics->drawRect(hintBgX, hintBgY, hintWidth + padding * 2, hintHeight + padding * 2, true);
                 graphics->setDrawColor(255, 255, 255, 255);
                 graphics->drawRect(hintBgX, hintBgY, hintWidth + padding * 2, hintHeight + padding * 2, false);
-                graphics->drawText(hintText, enemyX - 80, enemyY - enemyHeight / 2 + 250 + hintOffsetY, "default", whiteColor);
-                SDL_DestroyTexture(hintTexture);
+                graphics->drawText(hintText, enemyX - 80, enemyY - enemyHeight / 2 + 250 + hintOffsetY, defaultFont, whiteColor);
             }
         }
 }
 
 void BattleUI::renderTurnNumber(int turnNumber, int totalTurns, bool isDesperateMode) {
-    std::string turnText = "ターン " + std::to_string(turnNumber) + " / " + std::to_string(totalTurns);
-    if (isDesperateMode) {
-        turnText += "  ⚡ 大勝負 ⚡";
-    }
+    FrameProfiler::Scope profile(FrameProfiler::Section::BATTLE_UI);
+    const char* turnText = FrameArena::getInstance().format(isDesperateMode ? "ターン %d / %d  ⚡ 大勝負 ⚡" : "ターン %d / %d", turnNumber, totalTurns);
     
     // テキストのサイズを取得して背景を描画
-    SDL_Texture* textTexture = graphics->createTextTexture(turnText, "default", {255, 255, 255, 255});
-    if (textTexture) {
-        int textWidth, textHeight;
-        SDL_QueryTexture(textTexture, nullptr, nullptr, &textWidth, &textHeight);
+    int textWidth = 0;
+    int textHeight = 0;
+    if (graphics->measureText(turnText, defaultFont, textWidth, textHeight)) {
         
         // 背景を描画（パディング付き）
         // ターン数UIを少し下に移動（夜のタイマーUIの下に表示）
@@ -1227,30 +1230,20 @@ void BattleUI::renderTurnNumber(int turnNumber, int totalTurns, bool isDesperate
         
         // テキストを描画
         SDL_Color turnColor = {255, 255, 255, 255};
-        graphics->drawText(turnText, 18, turnNumberY, "default", turnColor);
-        
-        SDL_DestroyTexture(textTexture);
+        graphics->drawText(turnText, 18, turnNumberY, defaultFont, turnColor);
     } else {
         // フォールバック：通常のテキスト描画
         int turnNumberY = 60; // 20から60に変更
         SDL_Color turnColor = {255, 255, 255, 255};
-        graphics->drawText(turnText, 20, turnNumberY, "default", turnColor);
+        graphics->drawText(turnText, 20, turnNumberY, defaultFont, turnColor);
     }
 }
 
 SDL_Texture* BattleUI::getCommandTexture(const std::string& commandName) const {
-    if (commandName == "攻撃") {
-        return graphics->getTexture("command_attack");
-    } else if (commandName == "防御") {
-        return graphics->getTexture("command_defend");
-    } else if (commandName == "呪文") {
-        return graphics->getTexture("command_magic");
-    } else if (commandName == "身を隠す") {
-        return graphics->getTexture("command_hide");
-    } else if (commandName == "怯える") {
-        return graphics->getTexture("command_fear");
-    } else if (commandName == "助けを呼ぶ") {
-        return graphics->getTexture("command_help");
+    for (size_t i = 0; i < commandTextureIds.size(); i++) {
+        if (commandName == COMMAND_TEXTURE_NAMES[i].commandName) {
+            return graphics->getTexture(commandTextureIds[i]);
+        }
     }
     return nullptr;
 }
@@ -1269,36 +1262,11 @@ void BattleUI::drawCommandImage(const std::string& commandName, int x, int y, in
 }
 
 SDL_Texture* BattleUI::getBattleBackgroundTexture() const {
-    // 住民の場合は夜の背景、衛兵・王様の場合は城の背景、魔王の場合は魔王の背景、それ以外は通常の戦闘背景を使用
-    SDL_Texture* bgTexture = nullptr;
-    // enemyがnullの場合はデフォルトの背景を使用
-    if (!enemy) {
-        bgTexture = graphics->getTexture("battle_bg");
-        if (!bgTexture) {
-            bgTexture = graphics->loadTexture("assets/textures/bg/battle_bg.png", "battle_bg");
-        }
-        return bgTexture;
-    }
-    if (enemy->isResident()) {
-        bgTexture = graphics->getTexture("night_bg");
-        if (!bgTexture) {
-            bgTexture = graphics->loadTexture("assets/textures/bg/night_bg.png", "night_bg");
-        }
-    } else if (enemy->getType() == EnemyType::GUARD || enemy->getType() == EnemyType::KING) {
-        bgTexture = graphics->getTexture("castle_bg");
-        if (!bgTexture) {
-            bgTexture = graphics->loadTexture("assets/textures/bg/castle_bg.png", "castle_bg");
-        }
-    } else if (enemy->getType() == EnemyType::DEMON_LORD) {
-        bgTexture = graphics->getTexture("demon_bg");
-        if (!bgTexture) {
-            bgTexture = graphics->loadTexture("assets/textures/bg/demon_bg.png", "demon_bg");
-        }
-    } else {
-        bgTexture = graphics->getTexture("battle_bg");
-        if (!bgTexture) {
-            bgTexture = graphics->loadTexture("assets/textures/bg/battle_bg.png", "battle_bg");
-        }
+    SDL_Texture* bgTexture = graphics->getTexture(backgroundTextureId);
+    if (!bgTexture) {
+        // 読み込まれていない場合のみ名前からパスを組み立てて読み込む
+        const std::string name = getBattleBackgroundName(enemy);
+        bgTexture = graphics->loadTexture("assets/textures/bg/" + name + ".png", name);
     }
     return bgTexture;
 }
@@ -81,6 +81,16 @@ private:
     BattleLogic* battleLogic;
     BattleAnimationController* animationController;
     bool hasUsedLastChanceMode;  /**< @brief 最後のチャンスモードを使用したか */
+    
+    // 描画に使用するテクスチャ・フォントのハンドル（コンストラクタで解決する）
+    TextureId playerTextureId;
+    TextureId playerAdversityTextureId;
+    TextureId enemyTextureId;
+    TextureId backgroundTextureId;
+    TextureId vsImageTextureId;
+    TextureId lifeTextureId;
+    std::vector<TextureId> commandTextureIds;  // COMMAND_TEXTURE_NAMESと同じ順序
+    FontId defaultFont;
 
 public:
     /**
@@ -136,6 +146,26 @@ public:
      */
     SDL_Texture* getBattleBackgroundTexture() const;
     
+    /**
+     * @brief 戦闘背景画像のテクスチャ名の取得
+     * @details 画像は"assets/textures/bg/<テクスチャ名>.png"に置かれている。
+     * @param enemy 敵へのポインタ（nullptrの場合は通常の戦闘背景）
+     * @return テクスチャ名（住民は夜、衛兵・王様は城、魔王は魔王の背景、それ以外は通常の戦闘背景）
+     */
+    static const char* getBattleBackgroundName(const Enemy* enemy);
+    
+    /**
+     * @brief プレイヤー画像の取得
+     * @return プレイヤーのテクスチャ（窮地モードではplayer_adversity、読み込まれていない場合はplayer）
+     */
+    SDL_Texture* getPlayerTexture() const;
+    
+    /**
+     * @brief 敵画像の取得
+     * @return 敵のテクスチャ（住民の場合は住民の画像。読み込まれていない場合はnullptr）
+     */
+    SDL_Texture* getEnemyTexture() const;
+    
     /**
      * @brief キャラクター描画（共通）
      * @details プレイヤーと敵のキャラクターを指定された位置とサイズで描画する。
@@ -7,6 +7,7 @@
 #include "NightState.h"
 #include "../ui/CommonUI.h"
 #include "../core/utils/ui_config_manager.h"
+#include <algorithm>
 #include <iostream>
 #include <nlohmann/json.hpp>
 
@@ -161,14 +162,17 @@ void CastleState::render(Graphics& graphics) {
     }
     
     // ホットリロード対応
-    static bool lastReloadState = false;
     auto& config = UIConfig::UIConfigManager::getInstance();
-    bool currentReloadState = config.checkAndReloadConfig();
+    // このStateが使うセクションが変わった時だけUIを作り直す
+    uint64_t configGeneration = std::max(config.getGeneration(UIConfig::UIConfigSection::CASTLE),
+                                         config.getGeneration(UIConfig::UIConfigSection::MESSAGE_BOARD));
+    static uint64_t lastConfigGeneration = configGeneration;
+    bool configReloaded = configGeneration != lastConfigGeneration;
     
     bool uiJustInitialized = false;
     // フォントが読み込まれている場合のみUIをセットアップ
     if (graphics.getFont("default")) {
-        if (!messageBoard || (!lastReloadState && currentReloadState)) {
+        if (!messageBoard || configReloaded) {
             setupUI(graphics);
             uiJustInitialized = true;
         }
@@ -180,7 +184,7 @@ void CastleState::render(Graphics& graphics) {
             fontWarningShown = true;
         }
     }
-    lastReloadState = currentReloadState;
+    lastConfigGeneration = configGeneration;
     
     // 王様を倒した場合のメッセージを表示（setupUI()の後、messageBoardが初期化されているため）
     if (messageBoard && kingDefeated && allDefeated && !isShowingMessage) {
@@ -204,11 +208,11 @@ void CastleState::render(Graphics& graphics) {
     
     if (messageBoard && !messageBoard->getText().empty()) {
         auto& config = UIConfig::UIConfigManager::getInstance();
-        auto castleConfig = config.getCastleConfig();
+        const auto& castleConfig = config.getCastleConfig();
         
         int bgX, bgY;
         config.calculatePosition(bgX, bgY, castleConfig.messageBoard.background.position, graphics.getScreenWidth(), graphics.getScreenHeight());
-        auto mbConfig = config.getMessageBoardConfig();
+        const auto& mbConfig = config.getMessageBoardConfig();
         
         graphics.setDrawColor(mbConfig.backgroundColor.r, mbConfig.backgroundColor.g, mbConfig.backgroundColor.b, mbConfig.backgroundColor.a);
         graphics.drawRect(bgX, bgY, castleConfig.messageBoard.background.width, castleConfig.messageBoard.background.height, true);
@@ -242,10 +246,10 @@ void CastleState::render(Graphics& graphics) {
             
             // テキストを中央揃えにするため、テキストの幅を取得して調整
             SDL_Color textColor = {255, 255, 255, 255};
-            SDL_Texture* enterTexture = graphics.createTextTexture("ENTER", "default", textColor);
-            if (enterTexture) {
-                int textWidth, textHeight;
-                SDL_QueryTexture(enterTexture, nullptr, nullptr, &textWidth, &textHeight);
+            TextTexture enterTexture = graphics.getTextTexture("ENTER", "default", textColor);
+            if (enterTexture.texture) {
+                int textWidth = enterTexture.width;
+                int textHeight = enterTexture.height;
                 
                 // テキストサイズを小さくする（80%に縮小）
                 const float SCALE = 0.8f;
@@ -272,8 +276,7 @@ void CastleState::render(Graphics& graphics) {
                 // テキストを小さく描画（中央揃え）
                 int drawX = textX - scaledWidth / 2;
                 int drawY = textY + PADDING;
-                graphics.drawTexture(enterTexture, drawX, drawY, scaledWidth, scaledHeight);
-                SDL_DestroyTexture(enterTexture);
+                graphics.drawTexture(enterTexture.texture, drawX, drawY, scaledWidth, scaledHeight);
             } else {
                 // フォールバック: drawTextを使用
                 graphics.drawText("ENTER", textX, textY, "default", textColor);
@@ -341,7 +344,7 @@ void CastleState::setupUI(Graphics& graphics) {
     ui.clear();
     
     auto& config = UIConfig::UIConfigManager::getInstance();
-    auto castleConfig = config.getCastleConfig();
+    const auto& castleConfig = config.getCastleConfig();
     
     int textX, textY;
     config.calculatePosition(textX, textY, castleConfig.messageBoard.text.position, graphics.getScreenWidth(), graphics.getScreenHeight());
@@ -364,6 +367,7 @@ void CastleState::loadTextures(Graphics& graphics) {
     kingTexture = GameState::loadKingTexture(graphics);
     guardTexture = GameState::loadGuardTexture(graphics);
     castleTileTexture = graphics.loadTexture("assets/textures/tiles/castletile.png", "castle_tile");
+    castleTileTextureId = graphics.getTextureId("castle_tile");
     
     // デバッグ: テクスチャの読み込み状況を確認
     if (!playerTexture) {
@@ -604,7 +608,7 @@ void CastleState::drawCastle(Graphics& graphics) {
     graphics.setDrawColor(0, 0, 0, 255); // 黒色
     graphics.drawRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, true);
     
-    SDL_Texture* castleTexture = graphics.getTexture("castle_tile");
+    SDL_Texture* castleTexture = graphics.getTexture(castleTileTextureId);
     if (castleTexture) {
         graphics.drawTexture(castleTexture, ROOM_OFFSET_X, ROOM_OFFSET_Y, ROOM_PIXEL_WIDTH, ROOM_PIXEL_HEIGHT);
     } else {
@@ -55,6 +55,7 @@ private:
     SDL_Texture* kingTexture;
     SDL_Texture* guardTexture;
     SDL_Texture* castleTileTexture;
+    TextureId castleTileTextureId;  // 描画時に参照するハンドル（loadTextures()で解決する）
     
     // 夜のタイマー機能（TownStateと共有）
     bool nightTimerActive;
@@ -6,6 +6,7 @@
 #include "../entities/Enemy.h"
 #include "../core/utils/ui_config_manager.h"
 #include "../core/AudioManager.h"
+#include <algorithm>
 #include <iostream>
 
 static bool s_demonCastleFirstTime = true;
@@ -116,16 +117,19 @@ void DemonCastleState::render(Graphics& graphics) {
     }
     
     // ホットリロード対応
-    static bool lastReloadState = false;
     auto& config = UIConfig::UIConfigManager::getInstance();
-    bool currentReloadState = config.checkAndReloadConfig();
+    // このStateが使うセクションが変わった時だけUIを作り直す
+    uint64_t configGeneration = std::max(config.getGeneration(UIConfig::UIConfigSection::DEMON_CASTLE),
+                                         config.getGeneration(UIConfig::UIConfigSection::MESSAGE_BOARD));
+    static uint64_t lastConfigGeneration = configGeneration;
+    bool configReloaded = configGeneration != lastConfigGeneration;
     
     bool uiJustInitialized = false;
-    if (!messageBoard || (!lastReloadState && currentReloadState)) {
+    if (!messageBoard || configReloaded) {
         setupUI(graphics);
         uiJustInitialized = true;
     }
-    lastReloadState = currentReloadState;
+    lastConfigGeneration = configGeneration;
     
     // 会話を開始（pendingDialogueがtrueの場合、または初回の城からの入場で会話がまだ開始されていない場合）
     if (pendingDialogue || (fromCastleState && !isTalkingToDemon && !isShowingMessage)) {
@@ -142,11 +146,11 @@ void DemonCastleState::render(Graphics& graphics) {
     
     if (messageBoard && !messageBoard->getText().empty()) {
         auto& config = UIConfig::UIConfigManager::getInstance();
-        auto demonCastleConfig = config.getDemonCastleConfig();
+        const auto& demonCastleConfig = config.getDemonCastleConfig();
         
         int bgX, bgY;
         config.calculatePosition(bgX, bgY, demonCastleConfig.messageBoard.background.position, graphics.getScreenWidth(), graphics.getScreenHeight());
-        auto mbConfig = config.getMessageBoardConfig();
+        const auto& mbConfig = config.getMessageBoardConfig();
         
         graphics.setDrawColor(mbConfig.backgroundColor.r, mbConfig.backgroundColor.g, mbConfig.backgroundColor.b, mbConfig.backgroundColor.a);
         graphics.drawRect(bgX, bgY, demonCastleConfig.messageBoard.background.width, demonCastleConfig.messageBoard.background.height, true);
@@ -193,7 +197,7 @@ void DemonCastleState::setupUI(Graphics& graphics) {
     ui.clear();
     
     auto& config = UIConfig::UIConfigManager::getInstance();
-    auto demonCastleConfig = config.getDemonCastleConfig();
+    const auto& demonCastleConfig = config.getDemonCastleConfig();
     
     int textX, textY;
     config.calculatePosition(textX, textY, demonCastleConfig.messageBoard.text.position, graphics.getScreenWidth(), graphics.getScreenHeight());
@@ -213,6 +217,7 @@ void DemonCastleState::loadTextures(Graphics& graphics) {
     playerTexture = GameState::loadPlayerTexture(graphics);
     demonTexture = GameState::loadDemonTexture(graphics);
     demonCastleTileTexture = graphics.loadTexture("assets/textures/tiles/demoncastletile.png", "demon_castle_tile");
+    demonCastleTileTextureId = graphics.getTextureId("demon_castle_tile");
 }
 
 void DemonCastleState::handleMovement(const InputManager& input) {
@@ -342,7 +347,7 @@ void DemonCastleState::drawDemonCastle(Graphics& graphics) {
     graphics.setDrawColor(0, 0, 0, 255); // 黒色
     graphics.drawRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, true);
     
-    SDL_Texture* demonCastleTileTexture = graphics.getTexture("demon_castle_tile");
+    SDL_Texture* demonCastleTileTexture = graphics.getTexture(demonCastleTileTextureId);
     if (demonCastleTileTexture) {
         for (int y = 1; y < ROOM_HEIGHT - 1; y++) {
             for (int x = 1; x < ROOM_WIDTH - 1; x++) {
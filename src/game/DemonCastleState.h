@@ -49,6 +49,7 @@ private:
     SDL_Texture* playerTexture;
     SDL_Texture* demonTexture;
     SDL_Texture* demonCastleTileTexture;
+    TextureId demonCastleTileTextureId;  // 描画時に参照するハンドル（loadTextures()で解決する）
     
     // CastleStateから来たかどうか
     bool fromCastleState;
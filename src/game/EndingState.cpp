@@ -31,14 +31,15 @@ void EndingState::update(float deltaTime) {
     phaseTimer += deltaTime;
     ui.update(deltaTime);
     
-    static bool lastReloadState = false;
     auto& config = UIConfig::UIConfigManager::getInstance();
-    bool currentReloadState = config.checkAndReloadConfig();
+    uint64_t configGeneration = config.getGeneration(UIConfig::UIConfigSection::ENDING);
+    static uint64_t lastConfigGeneration = configGeneration;
+    bool configReloaded = configGeneration != lastConfigGeneration;
     
-    if (!lastReloadState && currentReloadState) {
+    if (configReloaded) {
         setupUI();
     }
-    lastReloadState = currentReloadState;
+    lastConfigGeneration = configGeneration;
     
     switch (currentPhase) {
         case EndingPhase::ENDING_MESSAGE:
@@ -79,7 +80,7 @@ void EndingState::render(Graphics& graphics) {
         case EndingPhase::ENDING_MESSAGE:
             if (messageLabel) {
                 auto& config = UIConfig::UIConfigManager::getInstance();
-                auto endingConfig = config.getEndingConfig();
+                const auto& endingConfig = config.getEndingConfig();
                 int msgX, msgY;
                 config.calculatePosition(msgX, msgY, endingConfig.message.position, graphics.getScreenWidth(), graphics.getScreenHeight());
                 graphics.drawText(messageLabel->getText(), msgX, msgY, "default", endingConfig.message.color);
@@ -89,7 +90,7 @@ void EndingState::render(Graphics& graphics) {
         case EndingPhase::STAFF_ROLL:
             {
                 auto& config = UIConfig::UIConfigManager::getInstance();
-                auto endingConfig = config.getEndingConfig();
+                const auto& endingConfig = config.getEndingConfig();
                 int staffX, staffY;
                 config.calculatePosition(staffX, staffY, endingConfig.staffRoll.position, graphics.getScreenWidth(), graphics.getScreenHeight());
                 for (int i = 0; i < currentStaffIndex && i < staffRoll.size(); i++) {
@@ -104,7 +105,7 @@ void EndingState::render(Graphics& graphics) {
         case EndingPhase::COMPLETE:
             {
                 auto& config = UIConfig::UIConfigManager::getInstance();
-                auto endingConfig = config.getEndingConfig();
+                const auto& endingConfig = config.getEndingConfig();
                 int theEndX, theEndY, returnX, returnY;
                 config.calculatePosition(theEndX, theEndY, endingConfig.theEnd.position, graphics.getScreenWidth(), graphics.getScreenHeight());
                 config.calculatePosition(returnX, returnY, endingConfig.returnToMenu.position, graphics.getScreenWidth(), graphics.getScreenHeight());
@@ -134,7 +135,7 @@ void EndingState::handleInput(const InputManager& input) {
 
 void EndingState::setupUI() {
     auto& config = UIConfig::UIConfigManager::getInstance();
-    auto endingConfig = config.getEndingConfig();
+    const auto& endingConfig = config.getEndingConfig();
     
     int msgX, msgY;
     config.calculatePosition(msgX, msgY, endingConfig.message.position, 1100, 650);
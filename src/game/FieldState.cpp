@@ -10,8 +10,9 @@
 #include "../ui/CommonUI.h"
 #include "../core/utils/ui_config_manager.h"
 #include "../core/AudioManager.h"
+#include "../core/Random.h"
+#include <algorithm>
 #include <iostream>
-#include <random>
 #include <vector>
 
 static int s_staticPlayerX = 25;  // 街の入り口の近く：25
@@ -20,10 +21,40 @@ static bool s_positionInitialized = false;
 static bool firstEnter= true;
 static bool saved = TownState::saved;
 
+namespace {
+    // 地形レイヤーに焼き込むタイルテクスチャ（terrainTextureIdsと同じ順序）
+    const char* const TERRAIN_TEXTURE_NAMES[] = {"grass", "forest", "river", "bridge", "rock"};
+    constexpr int TERRAIN_TEXTURE_GRASS = 0;
+    
+    /**
+     * @brief 地形タイプに対応するテクスチャの取得
+     * @param terrain 地形タイプ
+     * @return TERRAIN_TEXTURE_NAMESの添字
+     */
+    int getTerrainTextureIndex(TerrainType terrain) {
+        switch (terrain) {
+            case TerrainType::GRASS:
+                return TERRAIN_TEXTURE_GRASS;
+            case TerrainType::FOREST:
+                return 1;
+            case TerrainType::WATER:
+                return 2;
+            case TerrainType::BRIDGE:
+                return 3;
+            case TerrainType::ROCK:
+                return 4;
+            case TerrainType::TOWN_ENTRANCE:
+                return TERRAIN_TEXTURE_GRASS; // town_entrance.pngが存在しないため、grassを使用
+            default:
+                return TERRAIN_TEXTURE_GRASS; // デフォルト
+        }
+    }
+}
+
 FieldState::FieldState(std::shared_ptr<Player> player)
     : player(player), storyBox(nullptr), hasMoved(false),
       moveTimer(0), nightTimerActive(false), nightTimer(0.0f),
-      shouldRelocateMonster(false), lastBattleX(0), lastBattleY(0),
+      shouldRelocateMonster(false), lastBattleX(0), lastBattleY(0), terrainLayerDirty(true),
       messageBoard(nullptr), isShowingMessage(false),
       showGameExplanation(false), explanationStep(0) {
     
@@ -87,6 +118,7 @@ FieldState::FieldState(std::shared_ptr<Player> player)
     }
     
     terrainMap = staticTerrainMap;
+    terrainLayerDirty = true;
     playerX = s_staticPlayerX;
     playerY = s_staticPlayerY;
     
@@ -281,17 +313,22 @@ void FieldState::update(float deltaTime) {
 }
 
 void FieldState::render(Graphics& graphics) {
+    resolveRenderHandles(graphics);
+    
     // ホットリロード対応
-    static bool lastReloadState = false;
     auto& config = UIConfig::UIConfigManager::getInstance();
-    bool currentReloadState = config.checkAndReloadConfig();
+    // このStateが使うセクションが変わった時だけUIを作り直す
+    uint64_t configGeneration = std::max(config.getGeneration(UIConfig::UIConfigSection::FIELD),
+                                         config.getGeneration(UIConfig::UIConfigSection::MESSAGE_BOARD));
+    static uint64_t lastConfigGeneration = configGeneration;
+    bool configReloaded = configGeneration != lastConfigGeneration;
     
     bool uiJustInitialized = false;
-    if (!messageBoard || (!lastReloadState && currentReloadState)) {
+    if (!messageBoard || configReloaded) {
         setupUI(graphics);
         uiJustInitialized = true;
     }
-    lastReloadState = currentReloadState;
+    lastConfigGeneration = configGeneration;
     
     // 説明UIが設定されている場合は表示
     // uiJustInitializedがtrueの場合（UIが初期化された直後）は確実に1番目のメッセージを表示
@@ -318,10 +355,11 @@ void FieldState::render(Graphics& graphics) {
     
     if (messageBoard && !messageBoard->getText().empty()) {
         auto& config = UIConfig::UIConfigManager::getInstance();
-        auto mbConfig = config.getMessageBoardConfig();
+        const auto& mbConfig = config.getMessageBoardConfig();
         
-        int bgX, bgY;
-        config.calculatePosition(bgX, bgY, mbConfig.background.position, graphics.getScreenWidth(), graphics.getScreenHeight());
+        const UIConfig::UIResolvedRect& bgLayout = config.getLayout(UIConfig::UILayoutId::MESSAGE_BOARD_BACKGROUND, graphics.getScreenWidth(), graphics.getScreenHeight());
+        int bgX = bgLayout.x;
+        int bgY = bgLayout.y;
         
         graphics.setDrawColor(mbConfig.backgroundColor.r, mbConfig.backgroundColor.g, mbConfig.backgroundColor.b, mbConfig.backgroundColor.a);
         graphics.drawRect(bgX, bgY, mbConfig.background.width, mbConfig.background.height, true);
@@ -421,10 +459,11 @@ void FieldState::setupUI(Graphics& graphics) {
     storyBox = nullptr;
     
     auto& config = UIConfig::UIConfigManager::getInstance();
-    auto mbConfig = config.getMessageBoardConfig();
+    const auto& mbConfig = config.getMessageBoardConfig();
     
-    int textX, textY;
-    config.calculatePosition(textX, textY, mbConfig.text.position, graphics.getScreenWidth(), graphics.getScreenHeight());
+    const UIConfig::UIResolvedRect& textLayout = config.getLayout(UIConfig::UILayoutId::MESSAGE_BOARD_TEXT, graphics.getScreenWidth(), graphics.getScreenHeight());
+    int textX = textLayout.x;
+    int textY = textLayout.y;
     
     auto messageBoardLabel = std::make_unique<Label>(textX, textY, "", "default");
     messageBoardLabel->setColor(mbConfig.text.color);
@@ -542,52 +581,82 @@ void FieldState::checkEncounter() {
 }
 
 void FieldState::drawMap(Graphics& graphics) {
-    for (int y = 0; y < 16; y++) {
-        for (int x = 0; x < 28; x++) {
-            drawTerrain(graphics, terrainMap[y][x], x, y);
+    SDL_Texture* terrainLayer = updateTerrainLayer(graphics);
+    if (terrainLayer) {
+        graphics.drawTexture(terrainLayer, 0, 0, MAP_WIDTH * TILE_SIZE, MAP_HEIGHT * TILE_SIZE);
+    } else {
+        // レンダーターゲットが使用できない場合はタイルごとに描画する
+        for (int y = 0; y < MAP_HEIGHT; y++) {
+            for (int x = 0; x < MAP_WIDTH; x++) {
+                drawTerrain(graphics, terrainMap[y][x], x, y);
+            }
+        }
+    }
+    
+    for (int y = 0; y < MAP_HEIGHT; y++) {
+        for (int x = 0; x < MAP_WIDTH; x++) {
+            drawTileObject(graphics, terrainMap[y][x], x, y);
         }
     }
 }
 
-void FieldState::drawTerrain(Graphics& graphics, const MapTile& tile, int x, int y) {
-    int drawX = x * TILE_SIZE;
-    int drawY = y * TILE_SIZE;
+SDL_Texture* FieldState::updateTerrainLayer(Graphics& graphics) {
+    bool needsRedraw = false;
+    SDL_Texture* terrainLayer = graphics.getRenderTarget("field_terrain", MAP_WIDTH * TILE_SIZE, MAP_HEIGHT * TILE_SIZE, needsRedraw);
+    if (!terrainLayer) {
+        return nullptr;
+    }
     
-    SDL_Texture* terrainTexture = nullptr;
-    std::string textureName;
+    // タイルテクスチャが差し替えられた場合も焼き直す
+    for (size_t i = 0; i < TERRAIN_TEXTURE_COUNT; i++) {
+        SDL_Texture* texture = graphics.getTexture(terrainTextureIds[i]);
+        if (texture != terrainLayerTextures[i]) {
+            terrainLayerTextures[i] = texture;
+            needsRedraw = true;
+        }
+    }
     
-    switch (tile.terrain) {
-        case TerrainType::GRASS:
-            textureName = "grass";
-            break;
-        case TerrainType::FOREST:
-            textureName = "forest";
-            break;
-        case TerrainType::WATER:
-            textureName = "river";
-            break;
-        case TerrainType::BRIDGE:
-            textureName = "bridge";
-            break;
-        case TerrainType::ROCK:
-            textureName = "rock";
-            break;
-        case TerrainType::TOWN_ENTRANCE:
-            textureName = "grass"; // town_entrance.pngが存在しないため、grassを使用
-            break;
-        default:
-            textureName = "grass"; // デフォルト
-            break;
+    if (!needsRedraw && !terrainLayerDirty) {
+        return terrainLayer;
+    }
+    
+    if (!graphics.beginRenderTarget(terrainLayer)) {
+        terrainLayerDirty = true;  // テクスチャの記録は更新済みなので、次のフレームで確実に焼き直す
+        return nullptr;
+    }
+    // 全タイルの下地が不透明なテクスチャなら、レイヤー自体もブレンドなしで描画できる
+    bool layerOpaque = true;
+    for (int y = 0; y < MAP_HEIGHT; y++) {
+        for (int x = 0; x < MAP_WIDTH; x++) {
+            const MapTile& tile = terrainMap[y][x];
+            drawTerrain(graphics, tile, x, y);
+            
+            const int baseIndex = (tile.terrain == TerrainType::ROCK) ? TERRAIN_TEXTURE_GRASS : getTerrainTextureIndex(tile.terrain);
+            SDL_Texture* baseTexture = graphics.getTexture(terrainTextureIds[baseIndex]);
+            if (!baseTexture || !graphics.isTextureOpaque(baseTexture)) {
+                layerOpaque = false;
+            }
+        }
     }
+    graphics.endRenderTarget();
+    SDL_SetTextureBlendMode(terrainLayer, layerOpaque ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
+    
+    terrainLayerDirty = false;
+    return terrainLayer;
+}
+
+void FieldState::drawTerrain(Graphics& graphics, const MapTile& tile, int x, int y) {
+    int drawX = x * TILE_SIZE;
+    int drawY = y * TILE_SIZE;
     
     if (tile.terrain == TerrainType::ROCK) {
-        SDL_Texture* grassTexture = graphics.getTexture("grass");
+        SDL_Texture* grassTexture = graphics.getTexture(terrainTextureIds[TERRAIN_TEXTURE_GRASS]);
         if (grassTexture) {
             graphics.drawTexture(grassTexture, drawX, drawY, TILE_SIZE, TILE_SIZE);
         }
     }
     
-    terrainTexture = graphics.getTexture(textureName);
+    SDL_Texture* terrainTexture = graphics.getTexture(terrainTextureIds[getTerrainTextureIndex(tile.terrain)]);
     if (terrainTexture) {
         graphics.drawTexture(terrainTexture, drawX, drawY, TILE_SIZE, TILE_SIZE);
     } else {
@@ -610,6 +679,11 @@ void FieldState::drawTerrain(Graphics& graphics, const MapTile& tile, int x, int
         }
         graphics.drawRect(drawX, drawY, TILE_SIZE, TILE_SIZE, false);
     }
+}
+
+void FieldState::drawTileObject(Graphics& graphics, const MapTile& tile, int x, int y) {
+    int drawX = x * TILE_SIZE;
+    int drawY = y * TILE_SIZE;
     
     // オブジェクトがある場合は描画
     if (tile.hasObject) {
@@ -633,10 +707,7 @@ void FieldState::drawTerrain(Graphics& graphics, const MapTile& tile, int x, int
                 }
             }
             
-            Enemy tempEnemy(enemyType);
-            tempEnemy.setLevel(enemyLevel);
-            std::string enemyTextureName = "enemy_" + tempEnemy.getTypeName();
-            SDL_Texture* enemyTexture = graphics.getTexture(enemyTextureName);
+            SDL_Texture* enemyTexture = graphics.getTexture(getEnemyTextureId(graphics, enemyType));
             
             // プレイヤーレベルと比較して色を決定
             int playerLevel = player->getLevel();
@@ -650,7 +721,7 @@ void FieldState::drawTerrain(Graphics& graphics, const MapTile& tile, int x, int
             }
             
             auto& config = UIConfig::UIConfigManager::getInstance();
-            auto fieldConfig = config.getFieldConfig();
+            const auto& fieldConfig = config.getFieldConfig();
             
             if (enemyTexture) {
                 // 元の画像サイズを取得してアスペクト比を保持
@@ -679,7 +750,7 @@ void FieldState::drawTerrain(Graphics& graphics, const MapTile& tile, int x, int
                 std::string levelText = "Lv" + std::to_string(enemyLevel);
                 int levelX = drawX + 6 + static_cast<int>(fieldConfig.monsterLevel.position.absoluteX);
                 int levelY = drawY - 10 + static_cast<int>(fieldConfig.monsterLevel.position.absoluteY);
-                graphics.drawText(levelText, levelX, levelY, "default", levelColor);
+                graphics.drawText(levelText, levelX, levelY, defaultFont, levelColor);
             } else {
                 graphics.setDrawColor(255, 0, 0, 255);
                 graphics.drawRect(objX, objY, objSize, objSize, true);
@@ -687,7 +758,7 @@ void FieldState::drawTerrain(Graphics& graphics, const MapTile& tile, int x, int
                 std::string levelText = "Lv" + std::to_string(enemyLevel);
                 int levelX = drawX + 6 + static_cast<int>(fieldConfig.monsterLevel.position.absoluteX);
                 int levelY = drawY - 10 + static_cast<int>(fieldConfig.monsterLevel.position.absoluteY);
-                graphics.drawText(levelText, levelX, levelY, "default", levelColor);
+                graphics.drawText(levelText, levelX, levelY, defaultFont, levelColor);
             }
 
         } else { // 岩や木の場合は四角形
@@ -705,7 +776,7 @@ void FieldState::drawPlayer(Graphics& graphics) {
     int drawX = playerX * TILE_SIZE;
     int drawY = playerY * TILE_SIZE;
     
-    SDL_Texture* playerTexture = graphics.getTexture("player_field");
+    SDL_Texture* playerTexture = graphics.getTexture(playerTextureId);
     if (playerTexture) {
         // アスペクト比を保持して縦幅に合わせて描画
         int centerX = drawX + TILE_SIZE / 2;
@@ -723,7 +794,7 @@ void FieldState::drawPlayer(Graphics& graphics) {
     
     // プレイヤーの上にレベルを表示
     auto& config = UIConfig::UIConfigManager::getInstance();
-    auto fieldConfig = config.getFieldConfig();
+    const auto& fieldConfig = config.getFieldConfig();
     int playerLevel = player->getLevel();
     std::string levelText = "Lv" + std::to_string(playerLevel);
     SDL_Color levelColor = {255, 255, 255, 255}; // 白（プレイヤー自身なので固定）
@@ -731,7 +802,7 @@ void FieldState::drawPlayer(Graphics& graphics) {
     // 敵のレベル表示と同じ位置計算（タイルの左上から相対位置）
     int levelX = drawX + 6 + static_cast<int>(fieldConfig.monsterLevel.position.absoluteX);
     int levelY = drawY - 10 + static_cast<int>(fieldConfig.monsterLevel.position.absoluteY);
-    graphics.drawText(levelText, levelX, levelY, "default", levelColor);
+    graphics.drawText(levelText, levelX, levelY, defaultFont, levelColor);
 }
 
 void FieldState::checkTownEntrance() {
@@ -780,10 +851,7 @@ void FieldState::loadFieldImages() {
 }
 
 void FieldState::generateMonsterSpawnPoints() {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::uniform_int_distribution<> disX(1, 26); // 境界を避ける
-    std::uniform_int_distribution<> disY(1, 14); // 境界を避ける
+    RandomGenerator& gen = Random::get(RandomStream::ENCOUNTER);
     
     monsterSpawnPoints.clear();
     activeMonsterPoints.clear();
@@ -791,22 +859,21 @@ void FieldState::generateMonsterSpawnPoints() {
     activeMonsterLevels.clear();
     
     int playerLevel = player->getLevel();
-    std::uniform_int_distribution<> disLevel(std::max(1, playerLevel - 2), playerLevel + 2); // プレイヤーレベル±2の範囲
     
     for (int i = 0; i < 5; i++) {
         int x, y;
         bool validPosition;
         
         do {
-            x = disX(gen);
-            y = disY(gen);
+            x = gen.nextInt(1, 26); // 境界を避ける
+            y = gen.nextInt(1, 14); // 境界を避ける
             validPosition = isValidPosition(x, y) && 
                           terrainMap[y][x].terrain == TerrainType::GRASS &&
                           !terrainMap[y][x].hasObject;
         } while (!validPosition);
         
         EnemyType enemyType = Enemy::createRandomEnemy(playerLevel).getType();
-        int enemyLevel = disLevel(gen); // プレイヤーレベル±2の範囲でランダム
+        int enemyLevel = gen.nextInt(std::max(1, playerLevel - 2), playerLevel + 2); // プレイヤーレベル±2の範囲でランダム
         
         // 敵タイプの基本レベルを取得して上限を適用
         Enemy tempEnemy(enemyType);
@@ -824,10 +891,7 @@ void FieldState::generateMonsterSpawnPoints() {
 }
 
 void FieldState::relocateMonsterSpawnPoint(int oldX, int oldY) {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::uniform_int_distribution<> disX(1, 26);
-    std::uniform_int_distribution<> disY(1, 14);
+    RandomGenerator& gen = Random::get(RandomStream::ENCOUNTER);
     
     terrainMap[oldY][oldX].hasObject = false;
     terrainMap[oldY][oldX].objectType = 0;
@@ -836,8 +900,8 @@ void FieldState::relocateMonsterSpawnPoint(int oldX, int oldY) {
     bool validPosition;
     
     do {
-        newX = disX(gen);
-        newY = disY(gen);
+        newX = gen.nextInt(1, 26);
+        newY = gen.nextInt(1, 14);
         validPosition = isValidPosition(newX, newY) && 
                       terrainMap[newY][newX].terrain == TerrainType::GRASS &&
                       !terrainMap[newY][newX].hasObject;
@@ -847,14 +911,13 @@ void FieldState::relocateMonsterSpawnPoint(int oldX, int oldY) {
     terrainMap[newY][newX].objectType = 2;
     
     int playerLevel = player->getLevel();
-    std::uniform_int_distribution<> disLevel(std::max(1, playerLevel - 2), playerLevel + 2); // プレイヤーレベル±2の範囲
     
     for (size_t i = 0; i < activeMonsterPoints.size(); i++) {
         if (activeMonsterPoints[i].first == oldX && activeMonsterPoints[i].second == oldY) {
             activeMonsterPoints[i].first = newX;
             activeMonsterPoints[i].second = newY;
             EnemyType newEnemyType = Enemy::createRandomEnemy(playerLevel).getType();
-            int newEnemyLevel = disLevel(gen); // プレイヤーレベル±2の範囲でランダム
+            int newEnemyLevel = gen.nextInt(std::max(1, playerLevel - 2), playerLevel + 2); // プレイヤーレベル±2の範囲でランダム
             
             // 敵タイプの基本レベルを取得して上限を適用
             Enemy tempEnemy(newEnemyType);
@@ -883,18 +946,44 @@ void FieldState::showLevelUpStory(int newLevel) {
     }
 }
 
+void FieldState::resolveRenderHandles(Graphics& graphics) {
+    if (!terrainTextureIds.empty()) {
+        return;
+    }
+    // 描画のたびに名前で検索しないよう、使用するテクスチャとフォントを一度だけ解決する
+    static_assert(sizeof(TERRAIN_TEXTURE_NAMES) / sizeof(TERRAIN_TEXTURE_NAMES[0]) == TERRAIN_TEXTURE_COUNT,
+                  "TERRAIN_TEXTURE_NAMES must match TERRAIN_TEXTURE_COUNT");
+    for (const char* name : TERRAIN_TEXTURE_NAMES) {
+        terrainTextureIds.push_back(graphics.getTextureId(name));
+    }
+    playerTextureId = graphics.getTextureId("player_field");
+    toriiTextureId = graphics.getTextureId("torii");
+    defaultFont = graphics.getFontId("default");
+}
+
+TextureId FieldState::getEnemyTextureId(Graphics& graphics, EnemyType type) {
+    const size_t index = static_cast<size_t>(type);
+    if (index >= enemyTextureIds.size()) {
+        enemyTextureIds.resize(index + 1);
+    }
+    if (!enemyTextureIds[index].isValid()) {
+        enemyTextureIds[index] = graphics.getTextureId(Enemy(type).getTextureName());
+    }
+    return enemyTextureIds[index];
+}
+
 void FieldState::drawFieldGate(Graphics& graphics) {
     int gateX = 26;
     int gateY = 8;
     
-    SDL_Texture* grassTexture = graphics.getTexture("grass");
+    SDL_Texture* grassTexture = graphics.getTexture(terrainTextureIds[TERRAIN_TEXTURE_GRASS]);
     if (grassTexture) {
         int drawX = gateX * TILE_SIZE;
         int drawY = gateY * TILE_SIZE;
         graphics.drawTexture(grassTexture, drawX, drawY, TILE_SIZE, TILE_SIZE);
     }
     
-    SDL_Texture* toriiTexture = graphics.getTexture("torii");
+    SDL_Texture* toriiTexture = graphics.getTexture(toriiTextureId);
     if (toriiTexture) {
         int drawX = gateX * TILE_SIZE;
         int drawY = gateY * TILE_SIZE;
@@ -10,6 +10,7 @@
 #include "../entities/Player.h"
 #include "../entities/Enemy.h"
 #include "../utils/MapTerrain.h"
+#include <array>
 #include <memory>
 
 /**
@@ -27,6 +28,7 @@ private:
     const int TILE_SIZE = 38;
     const int MAP_WIDTH = 28;  // 25 → 28に拡大（画面幅1100px ÷ 38px = 約29タイル、UI部分を考慮して28）
     const int MAP_HEIGHT = 16; // 18 → 16に調整（画面高さ650px ÷ 38px = 約17タイル、UI部分を考慮して16）
+    static constexpr size_t TERRAIN_TEXTURE_COUNT = 5;  // 地形レイヤーに焼き込むタイルテクスチャの数
     
     // 移動タイマー
     float moveTimer;
@@ -48,6 +50,17 @@ private:
     std::vector<std::vector<MapTile>> terrainMap;
     bool hasMoved;
     
+    // 地形レイヤー（地形タイルをレンダーターゲットに焼き込み、毎フレーム1回の描画で済ませる）
+    bool terrainLayerDirty;                          // 地形マップが変わり焼き直しが必要か
+    std::array<SDL_Texture*, TERRAIN_TEXTURE_COUNT> terrainLayerTextures = {};  // 焼き込みに使用したタイルテクスチャ
+    
+    // 描画に使用するテクスチャ・フォントのハンドル（resolveRenderHandles()で解決する）
+    std::vector<TextureId> terrainTextureIds;        // TERRAIN_TEXTURE_NAMESと同じ順序
+    std::vector<TextureId> enemyTextureIds;          // EnemyTypeの値を添字とする（初めて描画する種類の時に解決する）
+    TextureId playerTextureId;
+    TextureId toriiTextureId;
+    FontId defaultFont;
+    
     // 夜のタイマー機能（TownStateと共有）
     bool nightTimerActive;
     float nightTimer;
@@ -163,6 +176,7 @@ private:
     
     /**
      * @brief 地形の描画
+     * @details 地形タイルのみを描画する。オブジェクトはdrawTileObject()で描画する。
      * @param graphics グラフィックスオブジェクトへの参照
      * @param tile マップタイル
      * @param x X座標
@@ -170,6 +184,24 @@ private:
      */
     void drawTerrain(Graphics& graphics, const MapTile& tile, int x, int y);
     
+    /**
+     * @brief タイル上のオブジェクトの描画
+     * @details 岩・モンスター出現場所・街の入り口など、地形レイヤーの上に毎フレーム描画するものを描画する。
+     * @param graphics グラフィックスオブジェクトへの参照
+     * @param tile マップタイル
+     * @param x X座標
+     * @param y Y座標
+     */
+    void drawTileObject(Graphics& graphics, const MapTile& tile, int x, int y);
+    
+    /**
+     * @brief 地形レイヤーの取得（必要な場合は焼き直す）
+     * @details 地形マップ、タイルテクスチャ、出力解像度のいずれかが変わった場合のみ焼き直す。
+     * @param graphics グラフィックスオブジェクトへの参照
+     * @return 地形レイヤーのテクスチャ（レンダーターゲットが使用できない場合はnullptr）
+     */
+    SDL_Texture* updateTerrainLayer(Graphics& graphics);
+    
     /**
      * @brief 有効な位置かどうかの判定
      * @param x X座標
@@ -207,6 +239,21 @@ private:
      */
     void drawFieldGate(Graphics& graphics);
     
+    /**
+     * @brief 描画に使用するテクスチャ・フォントのハンドルの解決
+     * @details 初回の描画時に一度だけ解決し、以降の描画ではハンドルで参照する。
+     * @param graphics グラフィックスオブジェクトへの参照
+     */
+    void resolveRenderHandles(Graphics& graphics);
+    
+    /**
+     * @brief 敵の種類に対応するテクスチャのハンドルの取得
+     * @param graphics グラフィックスオブジェクトへの参照
+     * @param type 敵の種類
+     * @return テクスチャのハンドル
+     */
+    TextureId getEnemyTextureId(Graphics& graphics, EnemyType type);
+    
     /**
      * @brief ゲーム説明のセットアップ
      * @param isFirstVictory 初勝利後の説明かどうか（falseの場合は初回フィールド説明）
@@ -40,24 +40,27 @@ void GameOverState::exit() {
 void GameOverState::update(float deltaTime) {
     ui.update(deltaTime);
     
-    static bool lastReloadState = false;
     auto& config = UIConfig::UIConfigManager::getInstance();
-    bool currentReloadState = config.checkAndReloadConfig();
+    uint64_t configGeneration = config.getGeneration(UIConfig::UIConfigSection::GAME_OVER);
+    static uint64_t lastConfigGeneration = configGeneration;
+    bool configReloaded = configGeneration != lastConfigGeneration;
     
-    if (!lastReloadState && currentReloadState) {
+    if (configReloaded) {
         setupUI();
     }
-    lastReloadState = currentReloadState;
+    lastConfigGeneration = configGeneration;
 }
 
 void GameOverState::render(Graphics& graphics) {
+    resolveRenderHandles(graphics);
+    
     int screenWidth = graphics.getScreenWidth();
     int screenHeight = graphics.getScreenHeight();
     
     // 通常戦の場合はbattle_bg.pngを背景に、住民戦の場合は黒背景
     if (!isResidentBattle) {
         // 通常戦：battle_bg.pngを背景に表示
-        SDL_Texture* bgTexture = graphics.getTexture("battle_bg");
+        SDL_Texture* bgTexture = graphics.getTexture(battleBgTextureId);
         if (!bgTexture) {
             bgTexture = graphics.loadTexture("assets/textures/bg/battle_bg.png", "battle_bg");
         }
@@ -70,7 +73,7 @@ void GameOverState::render(Graphics& graphics) {
         }
         
         // 画面の中心にplayer_defeat.pngを表示
-        SDL_Texture* defeatTexture = graphics.getTexture("player_defeat");
+        SDL_Texture* defeatTexture = graphics.getTexture(defeatTextureId);
         if (!defeatTexture) {
             defeatTexture = graphics.loadTexture("assets/textures/characters/player_defeat.png", "player_defeat");
         }
@@ -80,7 +83,7 @@ void GameOverState::render(Graphics& graphics) {
             
             // アスペクト比を維持しながら適切なサイズで表示
             auto& config = UIConfig::UIConfigManager::getInstance();
-            auto gameOverConfig = config.getGameOverConfig();
+            const auto& gameOverConfig = config.getGameOverConfig();
             int baseSize = gameOverConfig.image.baseSize;
             float aspectRatio = static_cast<float>(imgWidth) / static_cast<float>(imgHeight);
             int displayWidth, displayHeight;
@@ -102,7 +105,7 @@ void GameOverState::render(Graphics& graphics) {
         }
     } else {
         // 住民戦：night_bg.pngを背景に表示
-        SDL_Texture* bgTexture = graphics.getTexture("night_bg");
+        SDL_Texture* bgTexture = graphics.getTexture(nightBgTextureId);
         if (!bgTexture) {
             bgTexture = graphics.loadTexture("assets/textures/bg/night_bg.png", "night_bg");
         }
@@ -115,7 +118,7 @@ void GameOverState::render(Graphics& graphics) {
         }
         
         // 画面の中心にplayer_captured.pngを表示
-        SDL_Texture* capturedTexture = graphics.getTexture("player_captured");
+        SDL_Texture* capturedTexture = graphics.getTexture(capturedTextureId);
         if (!capturedTexture) {
             capturedTexture = graphics.loadTexture("assets/textures/characters/player_captured.png", "player_captured");
         }
@@ -125,7 +128,7 @@ void GameOverState::render(Graphics& graphics) {
             
             // アスペクト比を維持しながら適切なサイズで表示
             auto& config = UIConfig::UIConfigManager::getInstance();
-            auto gameOverConfig = config.getGameOverConfig();
+            const auto& gameOverConfig = config.getGameOverConfig();
             int baseSize = gameOverConfig.image.baseSize;
             float aspectRatio = static_cast<float>(imgWidth) / static_cast<float>(imgHeight);
             int displayWidth, displayHeight;
@@ -149,7 +152,7 @@ void GameOverState::render(Graphics& graphics) {
     
     // テキストUIの背景を描画
     auto& config = UIConfig::UIConfigManager::getInstance();
-    auto gameOverConfig = config.getGameOverConfig();
+    const auto& gameOverConfig = config.getGameOverConfig();
     
     // title背景
     if (titleLabel && !titleLabel->getText().empty()) {
@@ -359,7 +362,7 @@ void GameOverState::setupUI() {
     ui.clear();
     
     auto& config = UIConfig::UIConfigManager::getInstance();
-    auto gameOverConfig = config.getGameOverConfig();
+    const auto& gameOverConfig = config.getGameOverConfig();
     
     int titleX, titleY;
     config.calculatePosition(titleX, titleY, gameOverConfig.title.text.position, 1100, 650);
@@ -410,4 +413,15 @@ void GameOverState::setupUI() {
         retryLabel = nullptr;
         extendTimeLabel = nullptr;
     }
-} 
\ No newline at end of file
+} 
+
+void GameOverState::resolveRenderHandles(Graphics& graphics) {
+    if (battleBgTextureId.isValid()) {
+        return;
+    }
+    // 描画のたびに名前で検索しないよう、使用するテクスチャを一度だけ解決する
+    battleBgTextureId = graphics.getTextureId("battle_bg");
+    defeatTextureId = graphics.getTextureId("player_defeat");
+    nightBgTextureId = graphics.getTextureId("night_bg");
+    capturedTextureId = graphics.getTextureId("player_captured");
+}
@@ -36,6 +36,12 @@ private:
     // 目標レベル達成用の敵に負けた場合の情報
     bool isTargetLevelEnemy;  /**< @brief 目標レベル達成用の敵に負けたか */
     
+    // 描画に使用するテクスチャのハンドル（resolveRenderHandles()で解決する）
+    TextureId battleBgTextureId;
+    TextureId defeatTextureId;
+    TextureId nightBgTextureId;
+    TextureId capturedTextureId;
+    
     // UI要素
     Label* titleLabel;
     Label* reasonLabel;
@@ -97,9 +103,22 @@ public:
      */
     StateType getType() const override { return StateType::GAME_OVER; }
     
+    /**
+     * @brief 入力待ちで画面が変化しない状態か
+     * @return 表示の変化中でないか
+     */
+    bool isIdle() const override { return !ui.isAnimating(); }
+    
 private:
     /**
      * @brief UIのセットアップ
      */
     void setupUI();
+    
+    /**
+     * @brief 描画に使用するテクスチャのハンドルの解決
+     * @details 初回の描画時に一度だけ解決し、以降の描画ではハンドルで参照する。
+     * @param graphics グラフィックスオブジェクトへの参照
+     */
+    void resolveRenderHandles(Graphics& graphics);
 }; 
\ No newline at end of file
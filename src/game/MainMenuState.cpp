@@ -53,22 +53,25 @@ void MainMenuState::update(float deltaTime) {
         }
     }
     
-    static bool lastReloadState = false;
     auto& config = UIConfig::UIConfigManager::getInstance();
-    bool currentReloadState = config.checkAndReloadConfig();
+    uint64_t configGeneration = config.getGeneration(UIConfig::UIConfigSection::MAIN_MENU);
+    static uint64_t lastConfigGeneration = configGeneration;
+    bool configReloaded = configGeneration != lastConfigGeneration;
     
-    if (!lastReloadState && currentReloadState) {
+    if (configReloaded) {
         setupUI();
     }
-    lastReloadState = currentReloadState;
+    lastConfigGeneration = configGeneration;
 }
 
 void MainMenuState::render(Graphics& graphics) {
+    resolveRenderHandles(graphics);
+    
     graphics.setDrawColor(0, 0, 0, 255);
     graphics.clear();
     
     // タイトル背景画像を描画
-    SDL_Texture* titleBg = graphics.getTexture("title_bg");
+    SDL_Texture* titleBg = graphics.getTexture(titleBgTextureId);
     if (titleBg) {
         int screenWidth = graphics.getScreenWidth();
         int screenHeight = graphics.getScreenHeight();
@@ -77,7 +80,7 @@ void MainMenuState::render(Graphics& graphics) {
     }
     
     // タイトルロゴ画像を描画
-    SDL_Texture* titleLogo = graphics.getTexture("title_logo");
+    SDL_Texture* titleLogo = graphics.getTexture(titleLogoTextureId);
     if (titleLogo) {
         int screenWidth = graphics.getScreenWidth();
         int screenHeight = graphics.getScreenHeight();
@@ -108,23 +111,22 @@ void MainMenuState::render(Graphics& graphics) {
     
     // "START GAME : PRESS ENTER" テキストを表示
     auto& config = UIConfig::UIConfigManager::getInstance();
-    auto mainMenuConfig = config.getMainMenuConfig();
+    const auto& mainMenuConfig = config.getMainMenuConfig();
     
     int screenWidth = graphics.getScreenWidth();
     int screenHeight = graphics.getScreenHeight();
     std::string startText = "START GAME : PRESS ENTER";
     int textX, textY;
     config.calculatePosition(textX, textY, mainMenuConfig.startGameText.position, screenWidth, screenHeight);
-    SDL_Texture* startTexture = graphics.createTextTexture(startText, "default", mainMenuConfig.startGameText.color);
-    if (startTexture) {
-        int textWidth, textHeight;
-        SDL_QueryTexture(startTexture, nullptr, nullptr, &textWidth, &textHeight);
+    TextTexture startTexture = graphics.getTextTexture(startText, "default", mainMenuConfig.startGameText.color);
+    if (startTexture.texture) {
+        int textWidth = startTexture.width;
+        int textHeight = startTexture.height;
         // 中央揃えの場合は、計算されたX座標を中央に調整
         if (mainMenuConfig.startGameText.position.useRelative && mainMenuConfig.startGameText.position.offsetX == 0.0f) {
             textX = (screenWidth - textWidth) / 2;
         }
-        graphics.drawTexture(startTexture, textX, textY, textWidth, textHeight);
-        SDL_DestroyTexture(startTexture);
+        graphics.drawTexture(startTexture.texture, textX, textY, textWidth, textHeight);
     } else {
         // フォールバック：通常のテキスト描画
         graphics.drawText(startText, textX, textY, "default", mainMenuConfig.startGameText.color);
@@ -157,7 +159,7 @@ void MainMenuState::setupUI() {
     ui.clear();
     
     auto& config = UIConfig::UIConfigManager::getInstance();
-    auto mainMenuConfig = config.getMainMenuConfig();
+    const auto& mainMenuConfig = config.getMainMenuConfig();
     
     // タイトルテキストは画像に置き換えたため、ラベルは作成しない
     
@@ -240,4 +242,13 @@ void MainMenuState::updatePlayerInfo() {
             playerInfoLabel->setText(info.str());
         }
     }
-} 
\ No newline at end of file
+} 
+
+void MainMenuState::resolveRenderHandles(Graphics& graphics) {
+    if (titleBgTextureId.isValid()) {
+        return;
+    }
+    // 描画のたびに名前で検索しないよう、使用するテクスチャを一度だけ解決する
+    titleBgTextureId = graphics.getTextureId("title_bg");
+    titleLogoTextureId = graphics.getTextureId("title_logo");
+}
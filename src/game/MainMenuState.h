@@ -20,6 +20,10 @@ private:
     std::shared_ptr<Player> player;
     std::unique_ptr<Label> titleLabel;
     std::unique_ptr<Label> playerInfoLabel;
+    
+    // 描画に使用するテクスチャのハンドル（resolveRenderHandles()で解決する）
+    TextureId titleBgTextureId;
+    TextureId titleLogoTextureId;
 
 public:
     /**
@@ -62,6 +66,12 @@ public:
      */
     StateType getType() const override { return StateType::MAIN_MENU; }
     
+    /**
+     * @brief 入力待ちで画面が変化しない状態か
+     * @return フェード中でも表示の変化中でもないか
+     */
+    bool isIdle() const override { return !isFading() && !ui.isAnimating(); }
+    
 private:
     /**
      * @brief UIのセットアップ
@@ -72,4 +82,11 @@ private:
      * @brief プレイヤー情報の更新
      */
     void updatePlayerInfo();
+    
+    /**
+     * @brief 描画に使用するテクスチャのハンドルの解決
+     * @details 初回の描画時に一度だけ解決し、以降の描画ではハンドルで参照する。
+     * @param graphics グラフィックスオブジェクトへの参照
+     */
+    void resolveRenderHandles(Graphics& graphics);
 }; 
\ No newline at end of file
@@ -12,9 +12,9 @@
 #include "../core/utils/ui_config_manager.h"
 #include "../core/AudioManager.h"
 #include "../utils/TownLayout.h"
+#include "../core/Random.h"
 #include <nlohmann/json.hpp>
 #include <iostream>
-#include <random>
 #include <algorithm>
 
 int NightState::residentsKilled = 0;
@@ -294,14 +294,17 @@ void NightState::update(float deltaTime) {
         ui.update(deltaTime);
         
         // ホットリロード対応
-        static bool lastReloadState = false;
         auto& config = UIConfig::UIConfigManager::getInstance();
-        bool currentReloadState = config.checkAndReloadConfig();
+        // このStateが使うセクションが変わった時だけUIを作り直す
+        uint64_t configGeneration = std::max(config.getGeneration(UIConfig::UIConfigSection::NIGHT),
+                                             config.getGeneration(UIConfig::UIConfigSection::MESSAGE_BOARD));
+        static uint64_t lastConfigGeneration = configGeneration;
+        bool configReloaded = configGeneration != lastConfigGeneration;
         
-        if (!lastReloadState && currentReloadState) {
+        if (configReloaded) {
             setupUI();
         }
-        lastReloadState = currentReloadState;
+        lastConfigGeneration = configGeneration;
         
         updateGuards(deltaTime);
         
@@ -368,7 +371,7 @@ void NightState::render(Graphics& graphics) {
         updateUI();
         
         auto& config = UIConfig::UIConfigManager::getInstance();
-        auto nightConfig = config.getNightConfig();
+        const auto& nightConfig = config.getNightConfig();
         
         if (nightDisplayLabel && !nightDisplayLabel->getText().empty()) {
             int bgX, bgY;
@@ -409,10 +412,11 @@ void NightState::render(Graphics& graphics) {
         }
         
         if (showGameExplanation && explanationMessageBoard && !explanationMessageBoard->getText().empty()) {
-            auto mbConfig = config.getMessageBoardConfig();
+            const auto& mbConfig = config.getMessageBoardConfig();
             
-            int bgX, bgY;
-            config.calculatePosition(bgX, bgY, mbConfig.background.position, graphics.getScreenWidth(), graphics.getScreenHeight());
+            const UIConfig::UIResolvedRect& bgLayout = config.getLayout(UIConfig::UILayoutId::MESSAGE_BOARD_BACKGROUND, graphics.getScreenWidth(), graphics.getScreenHeight());
+            int bgX = bgLayout.x;
+            int bgY = bgLayout.y;
             
             graphics.setDrawColor(0, 0, 0, 255); // 黒色
             graphics.drawRect(bgX, bgY, mbConfig.background.width, mbConfig.background.height, true);
@@ -462,10 +466,10 @@ void NightState::render(Graphics& graphics) {
                 
                 // テキストを中央揃えにするため、テキストの幅を取得して調整
                 SDL_Color textColor = {255, 255, 255, 255};
-                SDL_Texture* enterTexture = graphics.createTextTexture("ENTER", "default", textColor);
-                if (enterTexture) {
-                    int textWidth, textHeight;
-                    SDL_QueryTexture(enterTexture, nullptr, nullptr, &textWidth, &textHeight);
+                TextTexture enterTexture = graphics.getTextTexture("ENTER", "default", textColor);
+                if (enterTexture.texture) {
+                    int textWidth = enterTexture.width;
+                    int textHeight = enterTexture.height;
                     
                     // テキストサイズを小さくする（80%に縮小）
                     const float SCALE = 0.8f;
@@ -492,8 +496,7 @@ void NightState::render(Graphics& graphics) {
                     // テキストを小さく描画（中央揃え）
                     int drawX = textX - scaledWidth / 2;
                     int drawY = textY + PADDING;
-                    graphics.drawTexture(enterTexture, drawX, drawY, scaledWidth, scaledHeight);
-                    SDL_DestroyTexture(enterTexture);
+                    graphics.drawTexture(enterTexture.texture, drawX, drawY, scaledWidth, scaledHeight);
                 } else {
                     // フォールバック: drawTextを使用
                     graphics.drawText("ENTER", textX, textY, "default", textColor);
@@ -677,7 +680,7 @@ void NightState::setupUI() {
         ui.clear();
         
         auto& config = UIConfig::UIConfigManager::getInstance();
-        auto nightConfig = config.getNightConfig();
+        const auto& nightConfig = config.getNightConfig();
         
         // メッセージボード（画面中央下部）
         int messageX, messageY;
@@ -706,7 +709,7 @@ void NightState::setupUI() {
         ui.addElement(std::move(nightOperationLabel));
         
         // 説明用メッセージボード（TownStateと同じ仕様）
-        auto mbConfig = config.getMessageBoardConfig();
+        const auto& mbConfig = config.getMessageBoardConfig();
         
         int textX, textY;
         config.calculatePosition(textX, textY, mbConfig.text.position, 1100, 650);  // 画面サイズは固定値（実際の画面サイズはrender()で取得可能だが、ここでは固定値を使用）
@@ -872,11 +875,9 @@ void NightState::executeResidentChoice(int choice) {
         }
         
         // ランダム判定
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        std::uniform_int_distribution<> dis(1, 100);
+        RandomGenerator& gen = Random::get(RandomStream::NIGHT);
         
-        if (dis(gen) <= successRate) {
+        if (gen.nextInt(1, 100) <= successRate) {
             residentsKilled++;
             
             player->changeDemonTrust(10); // 魔王からの信頼度を10上昇
@@ -1111,12 +1112,10 @@ void NightState::loadTextures(Graphics& graphics) {
 void NightState::updateGuards(float deltaTime) {
     try {
         if (!guardsInitialized) {
-            std::random_device rd;
-            std::mt19937 gen(rd());
-            std::uniform_int_distribution<> dis(0, residentHomes.size() - 1);
+            RandomGenerator& gen = Random::get(RandomStream::NIGHT);
             
             for (size_t i = 0; i < guards.size(); ++i) {
-                guardTargetHomeIndices[i] = dis(gen);
+                guardTargetHomeIndices[i] = gen.nextInt(0, residentHomes.size() - 1);
             }
             guardsInitialized = true;
         }
@@ -1138,13 +1137,11 @@ void NightState::updateGuards(float deltaTime) {
                     int distanceToHome = std::max(abs(currentX - targetX), abs(currentY - targetY));
                     
                     if (distanceToHome <= 1) {
-                        std::random_device rd;
-                        std::mt19937 gen(rd());
-                        std::uniform_int_distribution<> dis(0, residentHomes.size() - 1);
+                        RandomGenerator& gen = Random::get(RandomStream::NIGHT);
                         
                         int newTargetIndex;
                         do {
-                            newTargetIndex = dis(gen);
+                            newTargetIndex = gen.nextInt(0, residentHomes.size() - 1);
                         } while (newTargetIndex == targetHomeIndex);
                         guardTargetHomeIndices[i] = newTargetIndex;
                     } else {
@@ -7,6 +7,7 @@
 #include "../ui/CommonUI.h"
 #include "../core/utils/ui_config_manager.h"
 #include "../core/AudioManager.h"
+#include <algorithm>
 #include <iostream>
 #include <nlohmann/json.hpp>
 
@@ -104,14 +105,17 @@ void RoomState::render(Graphics& graphics) {
     }
     
     // ホットリロード対応
-    static bool lastReloadState = false;
     auto& config = UIConfig::UIConfigManager::getInstance();
-    bool currentReloadState = config.checkAndReloadConfig();
+    // このStateが使うセクションが変わった時だけUIを作り直す
+    uint64_t configGeneration = std::max(config.getGeneration(UIConfig::UIConfigSection::ROOM),
+                                         config.getGeneration(UIConfig::UIConfigSection::MESSAGE_BOARD));
+    static uint64_t lastConfigGeneration = configGeneration;
+    bool configReloaded = configGeneration != lastConfigGeneration;
     
     bool uiJustInitialized = false;
     // フォントが読み込まれている場合のみUIをセットアップ
     if (graphics.getFont("default")) {
-        if (!messageBoard || (!lastReloadState && currentReloadState)) {
+        if (!messageBoard || configReloaded) {
             setupUI(graphics);
             uiJustInitialized = true;
         }
@@ -123,7 +127,7 @@ void RoomState::render(Graphics& graphics) {
             fontWarningShown = true;
         }
     }
-    lastReloadState = currentReloadState;
+    lastConfigGeneration = configGeneration;
     
     if (uiJustInitialized) {
         if (pendingWelcomeMessage) {
@@ -157,10 +161,10 @@ void RoomState::render(Graphics& graphics) {
         
         // テキストを中央揃えにするため、テキストの幅を取得して調整
         SDL_Color textColor = {255, 255, 255, 255};
-        SDL_Texture* enterTexture = graphics.createTextTexture("ENTER", "default", textColor);
-        if (enterTexture) {
-            int textWidth, textHeight;
-            SDL_QueryTexture(enterTexture, nullptr, nullptr, &textWidth, &textHeight);
+        TextTexture enterTexture = graphics.getTextTexture("ENTER", "default", textColor);
+        if (enterTexture.texture) {
+            int textWidth = enterTexture.width;
+            int textHeight = enterTexture.height;
             
             // テキストサイズを小さくする（70%に縮小）
             const float SCALE = 0.8f;
@@ -187,8 +191,7 @@ void RoomState::render(Graphics& graphics) {
             // テキストを小さく描画（中央揃え）
             int drawX = textX - scaledWidth / 2;
             int drawY = textY + PADDING;
-            graphics.drawTexture(enterTexture, drawX, drawY, scaledWidth, scaledHeight);
-            SDL_DestroyTexture(enterTexture);
+            graphics.drawTexture(enterTexture.texture, drawX, drawY, scaledWidth, scaledHeight);
         } else {
             // フォールバック: drawTextを使用
             graphics.drawText("ENTER", textX, textY, "default", textColor);
@@ -197,11 +200,11 @@ void RoomState::render(Graphics& graphics) {
     
     if (messageBoard && !messageBoard->getText().empty()) {
         auto& config = UIConfig::UIConfigManager::getInstance();
-        auto roomConfig = config.getRoomConfig();
+        const auto& roomConfig = config.getRoomConfig();
         
         int bgX, bgY;
         config.calculatePosition(bgX, bgY, roomConfig.messageBoard.background.position, graphics.getScreenWidth(), graphics.getScreenHeight());
-        auto mbConfig = config.getMessageBoardConfig();
+        const auto& mbConfig = config.getMessageBoardConfig();
         
         graphics.setDrawColor(mbConfig.backgroundColor.r, mbConfig.backgroundColor.g, mbConfig.backgroundColor.b, mbConfig.backgroundColor.a);
         graphics.drawRect(bgX, bgY, roomConfig.messageBoard.background.width, roomConfig.messageBoard.background.height, true);
@@ -211,7 +214,7 @@ void RoomState::render(Graphics& graphics) {
 
     if (howtooperateBoard && !howtooperateBoard->getText().empty()) {
         auto& config = UIConfig::UIConfigManager::getInstance();
-        auto roomConfig = config.getRoomConfig();
+        const auto& roomConfig = config.getRoomConfig();
         
         int bgX, bgY;
         config.calculatePosition(bgX, bgY, roomConfig.howToOperateBackground.position, graphics.getScreenWidth(), graphics.getScreenHeight());
@@ -253,7 +256,7 @@ void RoomState::setupUI(Graphics& graphics) {
     ui.clear();
     
     auto& config = UIConfig::UIConfigManager::getInstance();
-    auto roomConfig = config.getRoomConfig();
+    const auto& roomConfig = config.getRoomConfig();
     
     int messageX, messageY;
     config.calculatePosition(messageX, messageY, roomConfig.messageBoard.text.position, graphics.getScreenWidth(), graphics.getScreenHeight());
@@ -285,6 +288,11 @@ void RoomState::loadTextures(Graphics& graphics) {
     bedTexture = graphics.loadTexture("assets/textures/objects/bed.png", "bed");
     houseTileTexture = graphics.loadTexture("assets/textures/tiles/housetile.png", "house_tile");
     graphics.loadTexture("assets/textures/objects/door.png", "door");
+    // 描画のたびに名前で検索しないよう、ハンドルを解決しておく
+    houseTileTextureId = graphics.getTextureId("house_tile");
+    bedTextureId = graphics.getTextureId("bed");
+    deskTextureId = graphics.getTextureId("desk");
+    doorTextureId = graphics.getTextureId("door");
     
     // デバッグ: テクスチャの読み込み状況を確認
     if (!playerTexture) {
@@ -332,7 +340,7 @@ void RoomState::drawRoom(Graphics& graphics) {
     graphics.setDrawColor(0, 0, 0, 255); // 黒色
     graphics.drawRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, true);
     
-    SDL_Texture* houseTileTexture = graphics.getTexture("house_tile");
+    SDL_Texture* houseTileTexture = graphics.getTexture(houseTileTextureId);
     if (houseTileTexture) {
         for (int y = 1; y < ROOM_HEIGHT - 1; y++) {
             for (int x = 1; x < ROOM_WIDTH - 1; x++) {
@@ -365,7 +373,7 @@ void RoomState::drawRoomObjects(Graphics& graphics) {
     const int ROOM_OFFSET_X = (SCREEN_WIDTH - ROOM_PIXEL_WIDTH) / 2;   // (1100 - 266) / 2 = 417
     const int ROOM_OFFSET_Y = (SCREEN_HEIGHT - ROOM_PIXEL_HEIGHT) / 2; // (650 - 190) / 2 = 230
     
-    SDL_Texture* bedTexture = graphics.getTexture("bed");
+    SDL_Texture* bedTexture = graphics.getTexture(bedTextureId);
     if (bedTexture) {
         graphics.drawTexture(bedTexture, ROOM_OFFSET_X + bedX * TILE_SIZE, ROOM_OFFSET_Y + bedY * TILE_SIZE, TILE_SIZE, TILE_SIZE);
     } else {
@@ -375,7 +383,7 @@ void RoomState::drawRoomObjects(Graphics& graphics) {
         graphics.drawRect(ROOM_OFFSET_X + bedX * TILE_SIZE, ROOM_OFFSET_Y + bedY * TILE_SIZE, TILE_SIZE, TILE_SIZE);
     }
     
-    SDL_Texture* deskTexture = graphics.getTexture("desk");
+    SDL_Texture* deskTexture = graphics.getTexture(deskTextureId);
     if (deskTexture) {
         graphics.drawTexture(deskTexture, ROOM_OFFSET_X + deskX * TILE_SIZE, ROOM_OFFSET_Y + deskY * TILE_SIZE, TILE_SIZE, TILE_SIZE);
     } else {
@@ -385,7 +393,7 @@ void RoomState::drawRoomObjects(Graphics& graphics) {
         graphics.drawRect(ROOM_OFFSET_X + deskX * TILE_SIZE, ROOM_OFFSET_Y + deskY * TILE_SIZE, TILE_SIZE, TILE_SIZE);
     }
     
-    SDL_Texture* doorTexture = graphics.getTexture("door");
+    SDL_Texture* doorTexture = graphics.getTexture(doorTextureId);
     if (doorTexture) {
         graphics.drawTexture(doorTexture, ROOM_OFFSET_X + doorX * TILE_SIZE, ROOM_OFFSET_Y + doorY * TILE_SIZE, TILE_SIZE, TILE_SIZE);
     } else {
@@ -53,6 +53,11 @@ private:
     SDL_Texture* deskTexture;
     SDL_Texture* bedTexture;
     SDL_Texture* houseTileTexture;
+    // 描画時に参照するテクスチャのハンドル（loadTextures()で解決する）
+    TextureId houseTileTextureId;
+    TextureId bedTextureId;
+    TextureId deskTextureId;
+    TextureId doorTextureId;
     
     // 夜のタイマー機能（TownStateと共有）
     bool nightTimerActive;
@@ -9,6 +9,7 @@
 #include "../ui/CommonUI.h"
 #include "../core/utils/ui_config_manager.h"
 #include "../core/AudioManager.h"
+#include <algorithm>
 #include <iostream>
 #include <nlohmann/json.hpp>
 
@@ -211,14 +212,17 @@ void TownState::render(Graphics& graphics) {
     }
     
     // ホットリロード対応
-    static bool lastReloadState = false;
     auto& config = UIConfig::UIConfigManager::getInstance();
-    bool currentReloadState = config.checkAndReloadConfig();
+    // このStateが使うセクションが変わった時だけUIを作り直す
+    uint64_t configGeneration = std::max(config.getGeneration(UIConfig::UIConfigSection::TOWN),
+                                         config.getGeneration(UIConfig::UIConfigSection::MESSAGE_BOARD));
+    static uint64_t lastConfigGeneration = configGeneration;
+    bool configReloaded = configGeneration != lastConfigGeneration;
     
     bool uiJustInitialized = false;
     // フォントが読み込まれている場合のみUIをセットアップ
     if (graphics.getFont("default")) {
-        if (!messageBoard || (!lastReloadState && currentReloadState)) {
+        if (!messageBoard || configReloaded) {
             setupUI(graphics);
             uiJustInitialized = true;
         }
@@ -230,7 +234,7 @@ void TownState::render(Graphics& graphics) {
             fontWarningShown = true;
         }
     }
-    lastReloadState = currentReloadState;
+    lastConfigGeneration = configGeneration;
     
     if (uiJustInitialized) {
         if (!pendingMessage.empty()) {
@@ -314,10 +318,10 @@ void TownState::render(Graphics& graphics) {
             
             // テキストを中央揃えにするため、テキストの幅を取得して調整
             SDL_Color textColor = {255, 255, 255, 255};
-            SDL_Texture* enterTexture = graphics.createTextTexture("ENTER", "default", textColor);
-            if (enterTexture) {
-                int textWidth, textHeight;
-                SDL_QueryTexture(enterTexture, nullptr, nullptr, &textWidth, &textHeight);
+            TextTexture enterTexture = graphics.getTextTexture("ENTER", "default", textColor);
+            if (enterTexture.texture) {
+                int textWidth = enterTexture.width;
+                int textHeight = enterTexture.height;
                 
                 // テキストサイズを小さくする（80%に縮小）
                 const float SCALE = 0.8f;
@@ -344,8 +348,7 @@ void TownState::render(Graphics& graphics) {
                 // テキストを小さく描画（中央揃え）
                 int drawX = textX - scaledWidth / 2;
                 int drawY = textY + PADDING;
-                graphics.drawTexture(enterTexture, drawX, drawY, scaledWidth, scaledHeight);
-                SDL_DestroyTexture(enterTexture);
+                graphics.drawTexture(enterTexture.texture, drawX, drawY, scaledWidth, scaledHeight);
             } else {
                 // フォールバック: drawTextを使用
                 graphics.drawText("ENTER", textX, textY, "default", textColor);
@@ -355,10 +358,11 @@ void TownState::render(Graphics& graphics) {
     
     if (messageBoard && !messageBoard->getText().empty()) {
         auto& config = UIConfig::UIConfigManager::getInstance();
-        auto mbConfig = config.getMessageBoardConfig();
+        const auto& mbConfig = config.getMessageBoardConfig();
         
-        int bgX, bgY;
-        config.calculatePosition(bgX, bgY, mbConfig.background.position, graphics.getScreenWidth(), graphics.getScreenHeight());
+        const UIConfig::UIResolvedRect& bgLayout = config.getLayout(UIConfig::UILayoutId::MESSAGE_BOARD_BACKGROUND, graphics.getScreenWidth(), graphics.getScreenHeight());
+        int bgX = bgLayout.x;
+        int bgY = bgLayout.y;
         
         graphics.setDrawColor(mbConfig.backgroundColor.r, mbConfig.backgroundColor.g, mbConfig.backgroundColor.b, mbConfig.backgroundColor.a);
         graphics.drawRect(bgX, bgY, mbConfig.background.width, mbConfig.background.height, true); // メッセージボード背景
@@ -475,7 +479,7 @@ void TownState::setupUI(Graphics& graphics) {
     
     auto& config = UIConfig::UIConfigManager::getInstance();
     
-    auto townConfig = config.getTownConfig();
+    const auto& townConfig = config.getTownConfig();
     int playerInfoX, playerInfoY;
     config.calculatePosition(playerInfoX, playerInfoY, townConfig.playerInfo.position, graphics.getScreenWidth(), graphics.getScreenHeight());
     auto playerInfoLabel = std::make_unique<Label>(playerInfoX, playerInfoY, "", "default");
@@ -501,10 +505,11 @@ void TownState::setupUI(Graphics& graphics) {
     controlsLabel->setColor(townConfig.controls.color);
     ui.addElement(std::move(controlsLabel));
     
-    auto mbConfig = config.getMessageBoardConfig();
+    const auto& mbConfig = config.getMessageBoardConfig();
     
-    int textX, textY;
-    config.calculatePosition(textX, textY, mbConfig.text.position, graphics.getScreenWidth(), graphics.getScreenHeight());
+    const UIConfig::UIResolvedRect& textLayout = config.getLayout(UIConfig::UILayoutId::MESSAGE_BOARD_TEXT, graphics.getScreenWidth(), graphics.getScreenHeight());
+    int textX = textLayout.x;
+    int textY = textLayout.y;
     
     auto messageBoardLabel = std::make_unique<Label>(textX, textY, "", "default");
     messageBoardLabel->setColor(mbConfig.text.color);
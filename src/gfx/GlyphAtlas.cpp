@@ -0,0 +1,240 @@
+#include "GlyphAtlas.h"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+    // グリフ間のにじみを防ぐための余白
+    constexpr int GLYPH_PADDING = 1;
+
+    /**
+     * @brief UTF-8文字列から1コードポイントを取り出す
+     * @param text UTF-8文字列（終端文字付き）
+     * @param pos 読み取り位置（読み取った分だけ進む）
+     * @return コードポイント（不正なシーケンスの場合はU+FFFD）
+     */
+    Uint32 decodeUtf8(const char* text, size_t& pos) {
+        const unsigned char lead = static_cast<unsigned char>(text[pos++]);
+        if (lead < 0x80) {
+            return lead;
+        }
+
+        int extra;
+        Uint32 codepoint;
+        if ((lead & 0xE0) == 0xC0) {
+            extra = 1;
+            codepoint = lead & 0x1F;
+        } else if ((lead & 0xF0) == 0xE0) {
+            extra = 2;
+            codepoint = lead & 0x0F;
+        } else if ((lead & 0xF8) == 0xF0) {
+            extra = 3;
+            codepoint = lead & 0x07;
+        } else {
+            return 0xFFFD;
+        }
+
+        for (int i = 0; i < extra; i++) {
+            // 終端文字は継続バイトではないので、途中で途切れたシーケンスもここで止まる
+            const unsigned char next = static_cast<unsigned char>(text[pos]);
+            if ((next & 0xC0) != 0x80) {
+                return 0xFFFD;
+            }
+            codepoint = (codepoint << 6) | (next & 0x3F);
+            pos++;
+        }
+        return codepoint;
+    }
+}
+
+GlyphAtlas::GlyphAtlas() : renderer(nullptr), renderStats(nullptr) {
+}
+
+GlyphAtlas::~GlyphAtlas() {
+    clear();
+}
+
+void GlyphAtlas::setRenderer(SDL_Renderer* newRenderer) {
+    if (renderer != newRenderer) {
+        clear();
+        renderer = newRenderer;
+    }
+}
+
+void GlyphAtlas::clear() {
+    for (auto& page : pages) {
+        if (page.texture) {
+            SDL_DestroyTexture(page.texture);
+            if (renderStats) renderStats->texturesDestroyed++;
+        }
+    }
+    pages.clear();
+    glyphs.clear();
+}
+
+bool GlyphAtlas::layoutText(TTF_Font* font, const char* text, int x, int y, std::vector<Quad>& out) {
+    if (!font || !renderer || !text) {
+        return false;
+    }
+
+    const bool useKerning = TTF_GetFontKerning(font) != 0;
+    const size_t firstQuad = out.size();
+    int penX = x;
+    Uint32 previous = 0;
+    size_t pos = 0;
+    while (text[pos] != '\0') {
+        Uint32 codepoint = decodeUtf8(text, pos);
+
+        // 制御文字は描画しない
+        if (codepoint < 0x20) {
+            previous = 0;
+            continue;
+        }
+
+        // グリフを用意できない文字があれば、欠けたまま描画せず呼び出し側の通常の描画に任せる
+        const Glyph* glyph = getGlyph(font, codepoint);
+        if (!glyph) {
+            out.resize(firstQuad);
+            return false;
+        }
+
+        if (useKerning && previous != 0) {
+            penX += TTF_GetFontKerningSizeGlyphs32(font, previous, codepoint);
+        }
+
+        if (glyph->page >= 0) {
+            Quad quad;
+            quad.texture = pages[glyph->page].texture;
+            quad.src = glyph->src;
+            quad.dst = {penX + glyph->offsetX, y, glyph->src.w, glyph->src.h};
+            out.push_back(quad);
+        }
+
+        penX += glyph->advance;
+        previous = codepoint;
+    }
+    return true;
+}
+
+SDL_Texture* GlyphAtlas::getPageTexture(int page) const {
+    if (page < 0 || page >= static_cast<int>(pages.size())) {
+        return nullptr;
+    }
+    return pages[page].texture;
+}
+
+const GlyphAtlas::Glyph* GlyphAtlas::getGlyph(TTF_Font* font, Uint32 codepoint) {
+    auto& fontGlyphs = glyphs[font];
+    auto it = fontGlyphs.find(codepoint);
+    if (it != fontGlyphs.end()) {
+        return &it->second;
+    }
+
+    Glyph glyph;
+    if (!rasterizeGlyph(font, codepoint, glyph)) {
+        return nullptr;
+    }
+    return &fontGlyphs.emplace(codepoint, glyph).first->second;
+}
+
+bool GlyphAtlas::rasterizeGlyph(TTF_Font* font, Uint32 codepoint, Glyph& glyph) {
+    int minX, maxX, minY, maxY, advance;
+    if (TTF_GlyphMetrics32(font, codepoint, &minX, &maxX, &minY, &maxY, &advance) != 0) {
+        return false;
+    }
+    glyph.advance = advance;
+    // TTF_RenderUTF8と同じく、左にはみ出すグリフはペン位置より左から描画される
+    glyph.offsetX = std::min(0, minX);
+
+    // 白でラスタライズし、描画時に頂点カラーで着色する
+    SDL_Color white = {255, 255, 255, 255};
+    SDL_Surface* surface = TTF_RenderGlyph32_Blended(font, codepoint, white);
+    if (renderStats) renderStats->glyphRasterizations++;
+    if (!surface) {
+        // 空白などの描画不要なグリフ
+        return true;
+    }
+
+    if (surface->format->format != SDL_PIXELFORMAT_ARGB8888) {
+        SDL_Surface* converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+        SDL_FreeSurface(surface);
+        surface = converted;
+        if (!surface) {
+            std::cerr << "警告: GlyphAtlas: グリフサーフェス変換エラー: " << SDL_GetError() << std::endl;
+            return false;
+        }
+    }
+
+    if (surface->w <= 0 || surface->h <= 0) {
+        SDL_FreeSurface(surface);
+        return true;
+    }
+
+    int page;
+    SDL_Rect rect;
+    if (!allocate(surface->w, surface->h, page, rect)) {
+        SDL_FreeSurface(surface);
+        return false;
+    }
+
+    if (SDL_UpdateTexture(pages[page].texture, &rect, surface->pixels, surface->pitch) != 0) {
+        std::cerr << "警告: GlyphAtlas: グリフの転送エラー: " << SDL_GetError() << std::endl;
+        SDL_FreeSurface(surface);
+        return false;
+    }
+    SDL_FreeSurface(surface);
+
+    glyph.page = page;
+    glyph.src = rect;
+    return true;
+}
+
+bool GlyphAtlas::allocate(int width, int height, int& page, SDL_Rect& rect) {
+    const int paddedWidth = width + GLYPH_PADDING;
+    const int paddedHeight = height + GLYPH_PADDING;
+    if (paddedWidth > PAGE_SIZE || paddedHeight > PAGE_SIZE) {
+        std::cerr << "警告: GlyphAtlas: グリフが大きすぎます (" << width << "x" << height << ")" << std::endl;
+        return false;
+    }
+
+    if (pages.empty() && !addPage()) {
+        return false;
+    }
+
+    Page* current = &pages.back();
+    // 現在の行に収まらない場合は次の行へ
+    if (current->shelfX + paddedWidth > PAGE_SIZE) {
+        current->shelfY += current->shelfHeight;
+        current->shelfX = 0;
+        current->shelfHeight = 0;
+    }
+    // ページに収まらない場合は新しいページへ
+    if (current->shelfY + paddedHeight > PAGE_SIZE) {
+        if (!addPage()) {
+            return false;
+        }
+        current = &pages.back();
+    }
+
+    page = static_cast<int>(pages.size()) - 1;
+    rect = {current->shelfX, current->shelfY, width, height};
+    current->shelfX += paddedWidth;
+    current->shelfHeight = std::max(current->shelfHeight, paddedHeight);
+    return true;
+}
+
+bool GlyphAtlas::addPage() {
+    SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, PAGE_SIZE, PAGE_SIZE);
+    if (!texture) {
+        std::cerr << "警告: GlyphAtlas: アトラスページ作成エラー: " << SDL_GetError() << std::endl;
+        return false;
+    }
+    if (renderStats) renderStats->texturesCreated++;
+
+    // 静的テクスチャの初期内容は不定なので透明で埋める
+    std::vector<Uint32> transparent(static_cast<size_t>(PAGE_SIZE) * PAGE_SIZE, 0);
+    SDL_UpdateTexture(texture, nullptr, transparent.data(), PAGE_SIZE * static_cast<int>(sizeof(Uint32)));
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+    pages.push_back({texture, 0, 0, 0});
+    return true;
+}
@@ -0,0 +1,152 @@
+/**
+ * @file GlyphAtlas.h
+ * @brief グリフアトラスを管理するクラス
+ * @details (フォント, コードポイント) ごとにグリフを一度だけラスタライズし、共有アトラステクスチャに配置する。
+ * 文字列はアトラス上の矩形（クワッド）の列としてレイアウトされる。
+ */
+
+#pragma once
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "RenderStats.h"
+
+/**
+ * @brief グリフアトラスを管理するクラス
+ * @details グリフは白色でラスタライズされ、描画時に頂点カラーで着色される。
+ * アトラスページが埋まった場合は新しいページを追加する（シェルフパッキング）。
+ */
+class GlyphAtlas {
+public:
+    /**
+     * @brief アトラス上のグリフ情報
+     */
+    struct Glyph {
+        int page = -1;          /**< @brief ページ番号（-1の場合は描画不要な空グリフ） */
+        SDL_Rect src = {0, 0, 0, 0};  /**< @brief ページ内のソース矩形 */
+        int offsetX = 0;        /**< @brief ペン位置からの描画オフセットX */
+        int advance = 0;        /**< @brief 次のグリフまでの送り幅 */
+    };
+
+    /**
+     * @brief 描画用のクワッド
+     */
+    struct Quad {
+        SDL_Texture* texture;   /**< @brief アトラスページのテクスチャ */
+        SDL_Rect src;           /**< @brief ソース矩形 */
+        SDL_Rect dst;           /**< @brief 描画先矩形 */
+    };
+
+    /**
+     * @brief コンストラクタ
+     */
+    GlyphAtlas();
+
+    /**
+     * @brief デストラクタ
+     */
+    ~GlyphAtlas();
+
+    GlyphAtlas(const GlyphAtlas&) = delete;
+    GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+    /**
+     * @brief レンダラーの設定
+     * @details レンダラーが変わる場合は既存のページを破棄する。
+     * @param newRenderer SDLレンダラーへのポインタ
+     */
+    void setRenderer(SDL_Renderer* newRenderer);
+
+    /**
+     * @brief 描画統計の記録先の設定
+     * @param stats テクスチャの作成・破棄などを加算する統計（nullptrで記録しない）
+     */
+    void setRenderStats(RenderStats* stats) { renderStats = stats; }
+
+    /**
+     * @brief 全ページとグリフキャッシュの破棄
+     * @details フォントを閉じる前、またはレンダラーを破棄する前に呼び出す。
+     */
+    void clear();
+
+    /**
+     * @brief テキストのレイアウト
+     * @details 未登録のグリフはここでラスタライズされアトラスに追加される。
+     * @param font フォントへのポインタ
+     * @param text UTF-8テキスト（終端文字付き）
+     * @param x 描画開始X座標
+     * @param y 描画開始Y座標
+     * @param out クワッドの出力先（末尾に追加される。失敗した場合は追加しない）
+     * @return レイアウトが成功したか（グリフを用意できない文字が1つでもあればfalse）
+     */
+    bool layoutText(TTF_Font* font, const char* text, int x, int y, std::vector<Quad>& out);
+
+    /**
+     * @brief ページテクスチャの取得
+     * @param page ページ番号
+     * @return ページテクスチャへのポインタ
+     */
+    SDL_Texture* getPageTexture(int page) const;
+
+    /**
+     * @brief ページ数の取得
+     * @return ページ数
+     */
+    int getPageCount() const { return static_cast<int>(pages.size()); }
+
+    /**
+     * @brief ページの一辺のサイズ（ピクセル）
+     */
+    static constexpr int PAGE_SIZE = 1024;
+
+private:
+    /**
+     * @brief アトラスページ
+     */
+    struct Page {
+        SDL_Texture* texture;
+        int shelfX;
+        int shelfY;
+        int shelfHeight;
+    };
+
+    /**
+     * @brief グリフの取得（未登録ならラスタライズ）
+     * @param font フォントへのポインタ
+     * @param codepoint Unicodeコードポイント
+     * @return グリフ情報へのポインタ（失敗時はnullptr）
+     */
+    const Glyph* getGlyph(TTF_Font* font, Uint32 codepoint);
+
+    /**
+     * @brief グリフのラスタライズとアトラスへの登録
+     * @param font フォントへのポインタ
+     * @param codepoint Unicodeコードポイント
+     * @param glyph 登録先のグリフ情報
+     * @return 登録が成功したか
+     */
+    bool rasterizeGlyph(TTF_Font* font, Uint32 codepoint, Glyph& glyph);
+
+    /**
+     * @brief アトラス上の領域の確保
+     * @param width 幅
+     * @param height 高さ
+     * @param page 確保したページ番号（出力）
+     * @param rect 確保した矩形（出力）
+     * @return 確保が成功したか
+     */
+    bool allocate(int width, int height, int& page, SDL_Rect& rect);
+
+    /**
+     * @brief 新しいページの作成
+     * @return 作成が成功したか
+     */
+    bool addPage();
+
+    SDL_Renderer* renderer;
+    RenderStats* renderStats;
+    std::vector<Page> pages;
+    std::unordered_map<TTF_Font*, std::unordered_map<Uint32, Glyph>> glyphs;
+};
@@ -1,7 +1,83 @@
 #include "Graphics.h"
+#include "SurfaceScaler.h"
+#include "../core/Trace.h"
+#include <algorithm>
+#include <chrono>
+#include <iterator>
 #include <iostream>
+#include <string_view>
+#include <cstdlib>
+#include <fstream>
 
-Graphics::Graphics() : window(nullptr), renderer(nullptr), screenWidth(800), screenHeight(600) {
+namespace {
+    // テキストテクスチャキャッシュのデフォルトのメモリ予算（16MB）
+    constexpr size_t DEFAULT_TEXT_CACHE_BUDGET = 16 * 1024 * 1024;
+    
+    // バッチ化の際に合流先を探す、直近のバッチ数
+    constexpr int BATCH_LOOKBACK = 8;
+    
+    // 事前縮小テクスチャのデフォルトのメモリ予算（32MB）
+    constexpr size_t DEFAULT_PRESCALE_BUDGET = 32 * 1024 * 1024;
+    // 事前縮小テクスチャを作成するまでに必要な、同じサイズでの描画回数
+    constexpr int PRESCALE_MIN_REQUESTS = 3;
+    // 1フレームあたりに作成する事前縮小テクスチャの上限（読み込みによるカクつきを分散する）
+    constexpr int PRESCALE_CREATIONS_PER_FRAME = 2;
+    // 未作成サイズの要求回数を記録する上限（アニメーションで毎フレーム変わるサイズで肥大化しないように）
+    constexpr size_t PRESCALE_MAX_PENDING_REQUESTS = 4096;
+    
+    /**
+     * @brief サーフェスの全ピクセルが不透明かどうかの判定
+     * @param surface 判定するサーフェス
+     * @return 完全に不透明か
+     */
+    bool isSurfaceOpaque(SDL_Surface* surface) {
+        // アルファチャンネルもカラーキーもない直接色のフォーマットは常に不透明
+        if (surface->format->Amask == 0 && surface->format->BytesPerPixel > 1 && !SDL_HasColorKey(surface)) {
+            return true;
+        }
+        
+        // パレットやカラーキーを含む場合も、ARGB8888に変換すれば透明度がアルファに反映される
+        SDL_Surface* argb = surface;
+        if (surface->format->format != SDL_PIXELFORMAT_ARGB8888) {
+            argb = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+            if (!argb) return false;
+        }
+        
+        bool opaque = true;
+        if (SDL_MUSTLOCK(argb)) SDL_LockSurface(argb);
+        for (int y = 0; y < argb->h && opaque; y++) {
+            const Uint32* row = reinterpret_cast<const Uint32*>(static_cast<const Uint8*>(argb->pixels) + y * argb->pitch);
+            for (int x = 0; x < argb->w; x++) {
+                if ((row[x] >> 24) != 0xFF) {
+                    opaque = false;
+                    break;
+                }
+            }
+        }
+        if (SDL_MUSTLOCK(argb)) SDL_UnlockSurface(argb);
+        
+        if (argb != surface) {
+            SDL_FreeSurface(argb);
+        }
+        return opaque;
+    }
+    
+    size_t hashTextKey(const char* text, TTF_Font* font, Uint32 color) {
+        size_t hash = std::hash<std::string_view>()(std::string_view(text));
+        hash ^= std::hash<const void*>()(font) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<Uint32>()(color) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+        return hash;
+    }
+}
+
+Graphics::Graphics() : window(nullptr), renderer(nullptr), headless(false), headlessSurface(nullptr), screenWidth(800), screenHeight(600), geometrySupported(true),
+                       textureAtlasBatching(false),
+                       prescaleEnabled(false), prescaledBytes(0), prescaledBudget(DEFAULT_PRESCALE_BUDGET), prescaledCreatedThisFrame(0),
+                       drawColor({0, 0, 0, 255}), drawLayer(0), drawLayersUsed(false), frameCounter(0),
+                       lastDrawTexture(nullptr) {
+    textCacheStats.budget = DEFAULT_TEXT_CACHE_BUDGET;
+    glyphAtlas.setRenderStats(&frameStats);
+    textureAtlas.setRenderStats(&frameStats);
 }
 
 Graphics::~Graphics() {
@@ -16,6 +92,12 @@ bool Graphics::initialize(const std::string& title, int width, int height) {
     // これはレンダラー作成前に設定する必要がある
     SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "best");
     
+    if (headless) {
+        // ディスプレイやサウンドデバイスのない環境でも初期化できるよう、ダミードライバーを使う
+        SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+        SDL_setenv("SDL_AUDIODRIVER", "dummy", 1);
+    }
+    
     // SDL初期化
     if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO | SDL_INIT_GAMECONTROLLER) < 0) {
         std::cerr << "SDL初期化エラー: " << SDL_GetError() << std::endl;
@@ -35,27 +117,48 @@ bool Graphics::initialize(const std::string& title, int width, int height) {
         return false;
     }
     
-    window = SDL_CreateWindow(title.c_str(), 
-                              SDL_WINDOWPOS_CENTERED, 
-                              SDL_WINDOWPOS_CENTERED,
-                              0, 0, 
-                              SDL_WINDOW_SHOWN | SDL_WINDOW_FULLSCREEN_DESKTOP);
-    
-    if (!window) {
-        std::cerr << "ウィンドウ作成エラー: " << SDL_GetError() << std::endl;
-        return false;
-    }
-    
-    // レンダラー作成（最高品質設定）
-    renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
-    if (!renderer) {
-        std::cerr << "レンダラー作成エラー: " << SDL_GetError() << std::endl;
-        return false;
+    if (headless) {
+        // ウィンドウを作らず、画面と同じサイズのサーフェスにソフトウェアレンダラーで描画する（垂直同期なし）
+        headlessSurface = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_ARGB8888);
+        if (!headlessSurface) {
+            std::cerr << "オフスクリーンサーフェス作成エラー: " << SDL_GetError() << std::endl;
+            return false;
+        }
+        
+        renderer = SDL_CreateSoftwareRenderer(headlessSurface);
+        if (!renderer) {
+            std::cerr << "ソフトウェアレンダラー作成エラー: " << SDL_GetError() << std::endl;
+            return false;
+        }
+    } else {
+        window = SDL_CreateWindow(title.c_str(), 
+                                  SDL_WINDOWPOS_CENTERED, 
+                                  SDL_WINDOWPOS_CENTERED,
+                                  0, 0, 
+                                  SDL_WINDOW_SHOWN | SDL_WINDOW_FULLSCREEN_DESKTOP);
+        
+        if (!window) {
+            std::cerr << "ウィンドウ作成エラー: " << SDL_GetError() << std::endl;
+            return false;
+        }
+        
+        // レンダラー作成（最高品質設定）
+        renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+        if (!renderer) {
+            std::cerr << "レンダラー作成エラー: " << SDL_GetError() << std::endl;
+            return false;
+        }
     }
     
     // 論理サイズ設定
     SDL_RenderSetLogicalSize(renderer, width, height);
     
+    // ソフトウェアレンダラーでは拡大縮小のコストが大きいため、事前縮小テクスチャを使う
+    SDL_RendererInfo rendererInfo;
+    if (SDL_GetRendererInfo(renderer, &rendererInfo) == 0 && (rendererInfo.flags & SDL_RENDERER_SOFTWARE)) {
+        prescaleEnabled = true;
+    }
+    
     // レンダリング品質を最高に設定（アンチエイリアシング有効）
     SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "best");
     
@@ -63,26 +166,52 @@ bool Graphics::initialize(const std::string& title, int width, int height) {
     screenHeight = height;
     
     // デフォルト描画色設定
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    setDrawColor(0, 0, 0, 255);
     
     // アルファブレンディングを有効化（フェードエフェクト用）
     SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
     
+    glyphAtlas.setRenderer(renderer);
+    textureAtlas.setRenderer(renderer);
+    
     return true;
 }
 
 void Graphics::cleanup() {
-    // テクスチャ解放
-    for (auto& pair : textures) {
-        SDL_DestroyTexture(pair.second);
+    // 未描画のコマンドは破棄するテクスチャを参照しているため捨てる
+    drawCommands.clear();
+    drawBatches.clear();
+    
+    // グリフアトラス解放（フォントとレンダラーより先に解放する）
+    glyphAtlas.clear();
+    textureAtlas.clear();
+    clearTextCache();
+    clearPrescaledVariants();
+    texturePaths.clear();
+    
+    // レンダーターゲット解放
+    for (auto& pair : renderTargets) {
+        destroyTexture(pair.second.texture);
     }
-    textures.clear();
+    renderTargets.clear();
+    
+    // テクスチャ解放（同じテクスチャが複数の名前で登録されている場合があるため、ファイルごとに解放する）
+    for (auto& pair : texturesByPath) {
+        destroyTexture(pair.second);
+    }
+    texturesByPath.clear();
+    // 名前とハンドルの対応は残し、状態が保持しているハンドルが別の名前を指さないようにする
+    std::fill(textureSlots.begin(), textureSlots.end(), nullptr);
+    opaqueTextures.clear();
+    ownedTextures.clear();
     
     // フォント解放
-    for (auto& pair : fonts) {
-        TTF_CloseFont(pair.second);
+    for (TTF_Font*& font : fontSlots) {
+        if (font) {
+            TTF_CloseFont(font);
+            font = nullptr;
+        }
     }
-    fonts.clear();
     
     // SDL解放
     if (renderer) {
@@ -95,18 +224,51 @@ void Graphics::cleanup() {
         window = nullptr;
     }
     
+    // ソフトウェアレンダラーの描画先はレンダラーより後に解放する
+    if (headlessSurface) {
+        SDL_FreeSurface(headlessSurface);
+        headlessSurface = nullptr;
+    }
+    
     TTF_Quit();
     IMG_Quit();
     SDL_Quit();
 }
 
 void Graphics::clear() {
+    // クリアより前に記録されたコマンドは上書きされるため描画せずに捨てる
+    drawCommands.clear();
+    drawLayersUsed = false;
     if (renderer) {
         SDL_RenderClear(renderer);
+        countDrawCall(nullptr, static_cast<Uint64>(screenWidth) * screenHeight);
     }
 }
 
 void Graphics::present() {
+    flush();
+    if (presentOverlay) {
+        presentOverlay(*this);
+        flush();
+    }
+    
+    // 描画統計を確定して次のフレームのために0に戻す
+    frameStats.frame = frameCounter;
+    lastFrameStats = frameStats;
+    frameStats = RenderStats();
+    lastDrawTexture = nullptr;
+    if (renderStatsCsv) {
+        *renderStatsCsv << lastFrameStats.frame << ',' << lastFrameStats.drawCalls << ',' << lastFrameStats.fillRects << ','
+                        << lastFrameStats.textureSwitches << ',' << lastFrameStats.textRasterizations << ','
+                        << lastFrameStats.glyphRasterizations << ',' << lastFrameStats.texturesCreated << ','
+                        << lastFrameStats.texturesDestroyed << ',' << lastFrameStats.pixelsFilled << '\n';
+    }
+    
+    frameCounter++;
+    prescaledCreatedThisFrame = 0;
+    if (prescaleRequests.size() > PRESCALE_MAX_PENDING_REQUESTS) {
+        prescaleRequests.clear();
+    }
     if (renderer) {
         SDL_RenderPresent(renderer);
     } else {
@@ -114,37 +276,215 @@ void Graphics::present() {
     }
 }
 
+void Graphics::setHeadless(bool enabled) {
+    if (renderer) {
+        std::cerr << "警告: Graphics::setHeadless: 初期化後は変更できません" << std::endl;
+        return;
+    }
+    headless = enabled;
+}
+
+bool Graphics::setRenderStatsCsv(const std::string& filepath) {
+    renderStatsCsv.reset();
+    if (filepath.empty()) {
+        return true;
+    }
+    auto file = std::make_unique<std::ofstream>(filepath);
+    if (!file->is_open()) {
+        std::cerr << "警告: Graphics::setRenderStatsCsv: ファイルを開けません: " << filepath << std::endl;
+        return false;
+    }
+    *file << "frame,draw_calls,fill_rects,texture_switches,text_rasterizations,glyph_rasterizations,"
+          << "textures_created,textures_destroyed,pixels_filled\n";
+    renderStatsCsv = std::move(file);
+    return true;
+}
+
+bool Graphics::saveScreenshot(const std::string& filepath) {
+    if (!renderer) {
+        std::cerr << "警告: Graphics::saveScreenshot: rendererがnullptrです" << std::endl;
+        return false;
+    }
+    flush();
+    
+    int outputWidth, outputHeight;
+    if (SDL_GetRendererOutputSize(renderer, &outputWidth, &outputHeight) != 0) {
+        std::cerr << "警告: Graphics::saveScreenshot: 出力サイズの取得に失敗: " << SDL_GetError() << std::endl;
+        return false;
+    }
+    
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, outputWidth, outputHeight, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!surface) {
+        std::cerr << "警告: Graphics::saveScreenshot: サーフェス作成エラー: " << SDL_GetError() << std::endl;
+        return false;
+    }
+    
+    bool success = SDL_RenderReadPixels(renderer, nullptr, SDL_PIXELFORMAT_ARGB8888, surface->pixels, surface->pitch) == 0;
+    if (!success) {
+        std::cerr << "警告: Graphics::saveScreenshot: ピクセルの読み取りに失敗: " << SDL_GetError() << std::endl;
+    } else if (IMG_SavePNG(surface, filepath.c_str()) != 0) {
+        std::cerr << "警告: Graphics::saveScreenshot: 画像の保存に失敗 " << filepath << ": " << IMG_GetError() << std::endl;
+        success = false;
+    }
+    SDL_FreeSurface(surface);
+    return success;
+}
+
 void Graphics::setDrawColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+    drawColor = {r, g, b, a};
     if (renderer) {
         SDL_SetRenderDrawColor(renderer, r, g, b, a);
     }
 }
 
 SDL_Texture* Graphics::loadTexture(const std::string& filepath, const std::string& name) {
-    SDL_Surface* surface = IMG_Load(filepath.c_str());
-    if (!surface) {
-        std::cerr << "画像読み込みエラー " << filepath << ": " << IMG_GetError() << std::endl;
+    auto loaded = texturesByPath.find(filepath);
+    if (loaded != texturesByPath.end()) {
+        textureSlots[getTextureId(name).index] = loaded->second;
+        return loaded->second;
+    }
+    
+    DecodedImage image;
+    if (!decodeImage(filepath, image)) {
+        std::cerr << image.error << std::endl;
         return nullptr;
     }
+    return loadTexture(filepath, name, image);
+}
+
+bool Graphics::decodeImage(const std::string& filepath, DecodedImage& image) {
+    image.surface = IMG_Load(filepath.c_str());
+    if (!image.surface) {
+        image.error = std::string("画像読み込みエラー ") + filepath + ": " + IMG_GetError();
+        return false;
+    }
     
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-    SDL_FreeSurface(surface);
+    // 不透明な画像（地面のタイルや背景）はブレンドを省略する
+    image.opaque = isSurfaceOpaque(image.surface);
+    
+    // 小さく描画するとき用の縮小コピー（アトラスに登録する）
+    int atlasWidth, atlasHeight;
+    SurfaceScaler::fitWithin(image.surface->w, image.surface->h, TextureAtlas::MAX_ENTRY_SIZE, atlasWidth, atlasHeight);
+    image.fullResolution = atlasWidth == image.surface->w && atlasHeight == image.surface->h;
+    image.atlasSurface = SurfaceScaler::downscale(image.surface, atlasWidth, atlasHeight);
+    return true;
+}
+
+void Graphics::freeDecodedImage(DecodedImage& image) {
+    if (image.surface) {
+        SDL_FreeSurface(image.surface);
+        image.surface = nullptr;
+    }
+    if (image.atlasSurface) {
+        SDL_FreeSurface(image.atlasSurface);
+        image.atlasSurface = nullptr;
+    }
+}
+
+SDL_Texture* Graphics::loadTexture(const std::string& filepath, const std::string& name, DecodedImage& image) {
+    auto loaded = texturesByPath.find(filepath);
+    if (loaded != texturesByPath.end()) {
+        freeDecodedImage(image);
+        textureSlots[getTextureId(name).index] = loaded->second;
+        return loaded->second;
+    }
+    if (!image.surface) {
+        freeDecodedImage(image);
+        return nullptr;
+    }
     
+    SDL_Texture* texture = createTextureFromSurface(image.surface);
     if (!texture) {
         std::cerr << "テクスチャ作成エラー " << filepath << ": " << SDL_GetError() << std::endl;
+        freeDecodedImage(image);
         return nullptr;
     }
+    SDL_FreeSurface(image.surface);
+    image.surface = nullptr;
     
     // 線形フィルタリングを有効にして、スケーリング時の画質を向上
     SDL_SetTextureScaleMode(texture, SDL_ScaleModeLinear);
     
-    textures[name] = texture;
+    if (image.opaque) {
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+        opaqueTextures.insert(texture);
+    }
+    
+    if (image.atlasSurface) {
+        // アトラスがサーフェスの所有権を受け取る
+        textureAtlas.add(texture, image.atlasSurface, image.fullResolution);
+        image.atlasSurface = nullptr;
+        if (!textureAtlasBatching) {
+            textureAtlas.build();
+        }
+    }
+    
+    textureSlots[getTextureId(name).index] = texture;
+    texturesByPath[filepath] = texture;
+    texturePaths[texture] = filepath;
+    ownedTextures.insert(texture);
     return texture;
 }
 
+void Graphics::beginTextureAtlas() {
+    textureAtlasBatching = true;
+}
+
+void Graphics::endTextureAtlas() {
+    textureAtlasBatching = false;
+    if (!textureAtlas.build()) {
+        std::cerr << "警告: Graphics::endTextureAtlas: アトラスに配置できなかったテクスチャがあります" << std::endl;
+    }
+}
+
+TextureRegion Graphics::getTextureRegion(const std::string& name) {
+    auto it = textureIndices.find(name);
+    if (it == textureIndices.end()) {
+        return {};
+    }
+    return getTextureRegion(TextureId{it->second});
+}
+
+TextureRegion Graphics::getTextureRegion(TextureId id) {
+    TextureRegion region;
+    SDL_Texture* texture = getTexture(id);
+    if (!texture) {
+        return region;
+    }
+    
+    const TextureAtlas::Region* atlasRegion = textureAtlas.find(texture);
+    if (atlasRegion) {
+        region.texture = atlasRegion->page;
+        region.rect = atlasRegion->rect;
+        return region;
+    }
+    
+    region.texture = texture;
+    SDL_QueryTexture(texture, nullptr, nullptr, &region.rect.w, &region.rect.h);
+    return region;
+}
+
 SDL_Texture* Graphics::getTexture(const std::string& name) {
-    auto it = textures.find(name);
-    return (it != textures.end()) ? it->second : nullptr;
+    auto it = textureIndices.find(name);
+    return (it != textureIndices.end()) ? textureSlots[it->second] : nullptr;
+}
+
+TextureId Graphics::getTextureId(const std::string& name) {
+    auto it = textureIndices.find(name);
+    if (it != textureIndices.end()) {
+        return TextureId{it->second};
+    }
+    const int index = static_cast<int>(textureSlots.size());
+    textureSlots.push_back(nullptr);
+    textureIndices.emplace(name, index);
+    return TextureId{index};
+}
+
+void Graphics::drawTexture(TextureId id, int x, int y, int width, int height) {
+    SDL_Texture* texture = getTexture(id);
+    if (texture) {
+        drawTexture(texture, x, y, width, height);
+    }
 }
 
 void Graphics::drawTexture(const std::string& name, int x, int y, int width, int height) {
@@ -170,7 +510,7 @@ void Graphics::drawTexture(SDL_Texture* texture, int x, int y, int width, int he
         }
     }
     
-    SDL_RenderCopy(renderer, texture, nullptr, &dstRect);
+    submitTexture(texture, nullptr, dstRect);
 }
 
 void Graphics::drawTextureClip(const std::string& name, int x, int y, SDL_Rect* srcRect, SDL_Rect* dstRect) {
@@ -188,7 +528,399 @@ void Graphics::drawTextureClip(const std::string& name, int x, int y, SDL_Rect*
         dstRect = &defaultDst;
     }
     
-    SDL_RenderCopy(renderer, texture, srcRect, dstRect);
+    submitTexture(texture, srcRect, *dstRect);
+}
+
+void Graphics::submitTexture(SDL_Texture* texture, const SDL_Rect* srcRect, const SDL_Rect& dstRect) {
+    if (!renderer || dstRect.w <= 0 || dstRect.h <= 0) return;
+    
+    if (ownedTextures.find(texture) == ownedTextures.end()) {
+        flush();
+        SDL_RenderCopy(renderer, texture, srcRect, &dstRect);
+        countDrawCall(texture, static_cast<Uint64>(dstRect.w) * dstRect.h);
+        return;
+    }
+    
+    int textureWidth, textureHeight;
+    if (SDL_QueryTexture(texture, nullptr, nullptr, &textureWidth, &textureHeight) != 0) {
+        std::cerr << "警告: Graphics::submitTexture: SDL_QueryTexture失敗: " << SDL_GetError() << std::endl;
+        return;
+    }
+    SDL_Rect src = srcRect ? *srcRect : SDL_Rect{0, 0, textureWidth, textureHeight};
+    
+    // 変調とブレンドモードは記録時の値を使う（描画までの間に呼び出し側が変更しても影響しない）
+    SDL_Color color;
+    SDL_BlendMode blendMode;
+    SDL_GetTextureColorMod(texture, &color.r, &color.g, &color.b);
+    SDL_GetTextureAlphaMod(texture, &color.a);
+    SDL_GetTextureBlendMode(texture, &blendMode);
+    // 不透明な画像でも、アルファ変調でフェードさせる場合はブレンドが必要
+    if (blendMode == SDL_BLENDMODE_NONE && color.a < 255 && isTextureOpaque(texture)) {
+        blendMode = SDL_BLENDMODE_BLEND;
+    }
+    
+    if (prescaleEnabled && !srcRect) {
+        const PrescaledVariant* variant = findPrescaledVariant(texture, textureWidth, textureHeight, dstRect);
+        if (variant) {
+            const SDL_Rect variantRect = {0, 0, variant->key.width, variant->key.height};
+            pushDrawCommand(variant->texture, variantRect, dstRect, variant->key.width, variant->key.height, color, blendMode);
+            return;
+        }
+    }
+    
+    const TextureAtlas::Region* region = textureAtlas.find(texture);
+    if (region) {
+        if (region->fullResolution) {
+            // 元画像と同じ解像度なので、ソース矩形をページ上にずらすだけでよい
+            src.x += region->rect.x;
+            src.y += region->rect.y;
+            pushDrawCommand(region->page, src, dstRect, TextureAtlas::PAGE_SIZE, TextureAtlas::PAGE_SIZE, color, blendMode);
+            return;
+        }
+        
+        // 縮小コピーは画像全体を、その解像度以下で描画する場合だけ使う（出力ピクセル単位で比較）
+        float scaleX, scaleY;
+        SDL_RenderGetScale(renderer, &scaleX, &scaleY);
+        if (!srcRect && dstRect.w * scaleX <= region->rect.w && dstRect.h * scaleY <= region->rect.h) {
+            pushDrawCommand(region->page, region->rect, dstRect, TextureAtlas::PAGE_SIZE, TextureAtlas::PAGE_SIZE, color, blendMode);
+            return;
+        }
+    }
+    
+    pushDrawCommand(texture, src, dstRect, textureWidth, textureHeight, color, blendMode);
+}
+
+const Graphics::PrescaledVariant* Graphics::findPrescaledVariant(SDL_Texture* texture, int textureWidth, int textureHeight, const SDL_Rect& dstRect) {
+    // 縮小元を用意できるのは読み込んだ画像だけ
+    if (texturePaths.find(texture) == texturePaths.end()) return nullptr;
+    
+    float scaleX, scaleY;
+    SDL_RenderGetScale(renderer, &scaleX, &scaleY);
+    PrescaledKey key = {texture, static_cast<int>(dstRect.w * scaleX + 0.5f), static_cast<int>(dstRect.h * scaleY + 0.5f)};
+    // 拡大は元のテクスチャで描画する
+    if (key.width <= 0 || key.height <= 0 || key.width >= textureWidth || key.height >= textureHeight) return nullptr;
+    
+    auto it = prescaledIndex.find(key);
+    if (it != prescaledIndex.end()) {
+        auto variant = it->second;
+        prescaledVariants.splice(prescaledVariants.begin(), prescaledVariants, variant);
+        variant->lastUsedFrame = frameCounter;
+        return &*variant;
+    }
+    
+    // 一時的なサイズ（拡大縮小アニメーションの途中など）では作成しない
+    int& requests = prescaleRequests[key];
+    if (++requests < PRESCALE_MIN_REQUESTS || prescaledCreatedThisFrame >= PRESCALE_CREATIONS_PER_FRAME) {
+        return nullptr;
+    }
+    SDL_Surface* source = getPrescaleSource(texture);
+    if (!source) return nullptr;  // デコードが終わるまでは元のテクスチャで描画する
+    prescaleRequests.erase(key);
+    
+    SDL_Texture* created = createPrescaledVariant(key, source);
+    if (!created) return nullptr;
+    prescaledCreatedThisFrame++;
+    
+    const size_t bytes = static_cast<size_t>(key.width) * static_cast<size_t>(key.height) * 4;
+    prescaledVariants.push_front({key, created, bytes, frameCounter});
+    prescaledIndex.emplace(key, prescaledVariants.begin());
+    prescaledBytes += bytes;
+    ownedTextures.insert(created);
+    
+    evictPrescaledVariants();
+    return &prescaledVariants.front();
+}
+
+SDL_Surface* Graphics::getPrescaleSource(SDL_Texture* texture) {
+    auto held = prescaleSourceIndex.find(texture);
+    if (held != prescaleSourceIndex.end()) {
+        auto source = held->second;
+        prescaleSources.splice(prescaleSources.begin(), prescaleSources, source);
+        source->lastUsedFrame = frameCounter;
+        return source->surface;
+    }
+    
+    auto pending = pendingPrescaleSources.find(texture);
+    if (pending == pendingPrescaleSources.end()) {
+        auto path = texturePaths.find(texture);
+        if (path == texturePaths.end()) return nullptr;
+        const std::string filepath = path->second;
+        pendingPrescaleSources.emplace(texture, std::async(std::launch::async, [filepath]() {
+            return IMG_Load(filepath.c_str());
+        }));
+        return nullptr;
+    }
+    if (pending->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        return nullptr;
+    }
+    SDL_Surface* surface = pending->second.get();
+    pendingPrescaleSources.erase(pending);
+    if (!surface) {
+        auto path = texturePaths.find(texture);
+        std::cerr << "警告: Graphics::getPrescaleSource: 画像読み込みエラー " << path->second << ": " << IMG_GetError() << std::endl;
+        // 読み直しを繰り返さないよう、このテクスチャは事前縮小の対象から外す
+        texturePaths.erase(path);
+        return nullptr;
+    }
+    
+    const size_t bytes = static_cast<size_t>(surface->pitch) * static_cast<size_t>(surface->h);
+    prescaleSources.push_front({texture, surface, bytes, frameCounter});
+    prescaleSourceIndex.emplace(texture, prescaleSources.begin());
+    prescaledBytes += bytes;
+    return surface;
+}
+
+SDL_Texture* Graphics::createPrescaledVariant(const PrescaledKey& key, SDL_Surface* source) {
+    SDL_Surface* scaled = SurfaceScaler::downscale(source, key.width, key.height);
+    if (!scaled) return nullptr;
+    
+    SDL_Texture* variant = createTextureFromSurface(scaled);
+    SDL_FreeSurface(scaled);
+    if (!variant) {
+        std::cerr << "警告: Graphics::createPrescaledVariant: テクスチャ作成エラー: " << SDL_GetError() << std::endl;
+        return nullptr;
+    }
+    // 等倍で描画するため補間は不要
+    SDL_SetTextureScaleMode(variant, SDL_ScaleModeNearest);
+    return variant;
+}
+
+void Graphics::evictPrescaledVariants() {
+    while (prescaledBytes > prescaledBudget && (!prescaledVariants.empty() || !prescaleSources.empty())) {
+        // 事前縮小テクスチャと縮小元の画像のうち、最も長く使われていないものを追い出す
+        const bool evictSource = !prescaleSources.empty() &&
+            (prescaledVariants.empty() || prescaleSources.back().lastUsedFrame < prescaledVariants.back().lastUsedFrame);
+        if (evictSource) {
+            auto last = std::prev(prescaleSources.end());
+            // 現在のフレームで事前縮小テクスチャの作成に使った可能性があるため残す
+            if (last->lastUsedFrame >= frameCounter) {
+                break;
+            }
+            prescaleSourceIndex.erase(last->texture);
+            SDL_FreeSurface(last->surface);
+            prescaledBytes -= last->bytes;
+            prescaleSources.erase(last);
+            continue;
+        }
+        
+        auto last = std::prev(prescaledVariants.end());
+        // 現在のフレームで記録済みの描画コマンドが参照している可能性があるため残す
+        if (last->lastUsedFrame >= frameCounter) {
+            break;
+        }
+        prescaledIndex.erase(last->key);
+        ownedTextures.erase(last->texture);
+        destroyTexture(last->texture);
+        prescaledBytes -= last->bytes;
+        prescaledVariants.erase(last);
+    }
+}
+
+void Graphics::clearPrescaledVariants() {
+    for (auto& variant : prescaledVariants) {
+        ownedTextures.erase(variant.texture);
+        destroyTexture(variant.texture);
+    }
+    prescaledVariants.clear();
+    prescaledIndex.clear();
+    prescaleRequests.clear();
+    
+    for (auto& source : prescaleSources) {
+        SDL_FreeSurface(source.surface);
+    }
+    prescaleSources.clear();
+    prescaleSourceIndex.clear();
+    // デコード中のものは完了を待って破棄する
+    for (auto& pending : pendingPrescaleSources) {
+        SDL_Surface* surface = pending.second.get();
+        if (surface) {
+            SDL_FreeSurface(surface);
+        }
+    }
+    pendingPrescaleSources.clear();
+    prescaledBytes = 0;
+}
+
+void Graphics::setPrescaleEnabled(bool enabled) {
+    if (prescaleEnabled == enabled) return;
+    if (!enabled) {
+        // 記録済みのコマンドが事前縮小テクスチャを参照している可能性があるため先に描画する
+        flush();
+        clearPrescaledVariants();
+    }
+    prescaleEnabled = enabled;
+}
+
+void Graphics::setPrescaleBudget(size_t bytes) {
+    prescaledBudget = bytes;
+    evictPrescaledVariants();
+}
+
+void Graphics::pushDrawCommand(SDL_Texture* texture, const SDL_Rect& src, const SDL_Rect& dst,
+                               int textureWidth, int textureHeight, SDL_Color color, SDL_BlendMode blendMode) {
+    DrawCommand command;
+    command.texture = texture;
+    command.src = src;
+    command.dst = dst;
+    const float invWidth = 1.0f / static_cast<float>(textureWidth);
+    const float invHeight = 1.0f / static_cast<float>(textureHeight);
+    command.u0 = src.x * invWidth;
+    command.v0 = src.y * invHeight;
+    command.u1 = (src.x + src.w) * invWidth;
+    command.v1 = (src.y + src.h) * invHeight;
+    command.color = color;
+    command.blendMode = blendMode;
+    command.layer = drawLayer;
+    command.next = -1;
+    drawCommands.push_back(command);
+    if (drawLayer != 0) {
+        drawLayersUsed = true;
+    }
+}
+
+void Graphics::flush() {
+    if (drawCommands.empty()) return;
+    if (!renderer) {
+        drawCommands.clear();
+        return;
+    }
+    
+    if (drawLayersUsed) {
+        std::stable_sort(drawCommands.begin(), drawCommands.end(),
+                         [](const DrawCommand& a, const DrawCommand& b) { return a.layer < b.layer; });
+    }
+    
+    buildDrawBatches();
+    for (const DrawBatch& batch : drawBatches) {
+        renderDrawBatch(batch);
+    }
+    
+    drawCommands.clear();
+    drawBatches.clear();
+    drawLayersUsed = false;
+}
+
+void Graphics::buildDrawBatches() {
+    drawBatches.clear();
+    const int commandCount = static_cast<int>(drawCommands.size());
+    for (int i = 0; i < commandCount; i++) {
+        DrawCommand& command = drawCommands[i];
+        
+        // 直近のバッチから遡り、途中のバッチと重ならずに到達できる同じ描画状態のバッチを探す
+        int target = -1;
+        const int batchCount = static_cast<int>(drawBatches.size());
+        const int limit = std::max(0, batchCount - BATCH_LOOKBACK);
+        for (int b = batchCount - 1; b >= limit; b--) {
+            const DrawBatch& batch = drawBatches[b];
+            if (batch.texture == command.texture && batch.blendMode == command.blendMode) {
+                target = b;
+                break;
+            }
+            if (SDL_HasIntersection(&batch.bounds, &command.dst)) {
+                break;
+            }
+        }
+        
+        if (target < 0) {
+            drawBatches.push_back({command.texture, command.blendMode, command.dst, i, i});
+            continue;
+        }
+        
+        DrawBatch& batch = drawBatches[target];
+        drawCommands[batch.last].next = i;
+        batch.last = i;
+        SDL_UnionRect(&batch.bounds, &command.dst, &batch.bounds);
+    }
+}
+
+void Graphics::renderDrawBatch(const DrawBatch& batch) {
+    if (geometrySupported) {
+        batchVertices.clear();
+        batchIndices.clear();
+        Uint64 batchPixels = 0;
+        for (int i = batch.first; i != -1; i = drawCommands[i].next) {
+            const DrawCommand& command = drawCommands[i];
+            batchPixels += static_cast<Uint64>(command.dst.w) * command.dst.h;
+            const float left = static_cast<float>(command.dst.x);
+            const float top = static_cast<float>(command.dst.y);
+            const float right = static_cast<float>(command.dst.x + command.dst.w);
+            const float bottom = static_cast<float>(command.dst.y + command.dst.h);
+            
+            const int base = static_cast<int>(batchVertices.size());
+            batchVertices.push_back({{left, top}, command.color, {command.u0, command.v0}});
+            batchVertices.push_back({{right, top}, command.color, {command.u1, command.v0}});
+            batchVertices.push_back({{right, bottom}, command.color, {command.u1, command.v1}});
+            batchVertices.push_back({{left, bottom}, command.color, {command.u0, command.v1}});
+            batchIndices.insert(batchIndices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+        }
+        
+        // 変調は頂点カラーに含めているので、描画中はテクスチャ側の変調を無効にする
+        Uint8 modR = 255, modG = 255, modB = 255, modA = 255;
+        SDL_BlendMode previousBlendMode;
+        if (batch.texture) {
+            SDL_GetTextureColorMod(batch.texture, &modR, &modG, &modB);
+            SDL_GetTextureAlphaMod(batch.texture, &modA);
+            SDL_GetTextureBlendMode(batch.texture, &previousBlendMode);
+            SDL_SetTextureColorMod(batch.texture, 255, 255, 255);
+            SDL_SetTextureAlphaMod(batch.texture, 255);
+            SDL_SetTextureBlendMode(batch.texture, batch.blendMode);
+        } else {
+            SDL_GetRenderDrawBlendMode(renderer, &previousBlendMode);
+            SDL_SetRenderDrawBlendMode(renderer, batch.blendMode);
+        }
+        
+        const int result = SDL_RenderGeometry(renderer, batch.texture, batchVertices.data(), static_cast<int>(batchVertices.size()),
+                                              batchIndices.data(), static_cast<int>(batchIndices.size()));
+        
+        if (batch.texture) {
+            SDL_SetTextureColorMod(batch.texture, modR, modG, modB);
+            SDL_SetTextureAlphaMod(batch.texture, modA);
+            SDL_SetTextureBlendMode(batch.texture, previousBlendMode);
+        } else {
+            SDL_SetRenderDrawBlendMode(renderer, previousBlendMode);
+        }
+        
+        if (result == 0) {
+            countDrawCall(batch.texture, batchPixels);
+            return;
+        }
+        
+        // SDL_RenderGeometry非対応のレンダラーではコマンドごとの描画に切り替える
+        std::cerr << "警告: Graphics::flush: SDL_RenderGeometry失敗: " << SDL_GetError() << std::endl;
+        geometrySupported = false;
+    }
+    
+    for (int i = batch.first; i != -1; i = drawCommands[i].next) {
+        renderDrawCommandDirect(drawCommands[i]);
+    }
+}
+
+void Graphics::renderDrawCommandDirect(const DrawCommand& command) {
+    if (!command.texture) {
+        SDL_BlendMode previousBlendMode;
+        SDL_GetRenderDrawBlendMode(renderer, &previousBlendMode);
+        SDL_SetRenderDrawBlendMode(renderer, command.blendMode);
+        SDL_SetRenderDrawColor(renderer, command.color.r, command.color.g, command.color.b, command.color.a);
+        SDL_RenderFillRect(renderer, &command.dst);
+        countDrawCall(nullptr, static_cast<Uint64>(command.dst.w) * command.dst.h);
+        SDL_SetRenderDrawColor(renderer, drawColor.r, drawColor.g, drawColor.b, drawColor.a);
+        SDL_SetRenderDrawBlendMode(renderer, previousBlendMode);
+        return;
+    }
+    
+    Uint8 modR, modG, modB, modA;
+    SDL_BlendMode previousBlendMode;
+    SDL_GetTextureColorMod(command.texture, &modR, &modG, &modB);
+    SDL_GetTextureAlphaMod(command.texture, &modA);
+    SDL_GetTextureBlendMode(command.texture, &previousBlendMode);
+    SDL_SetTextureColorMod(command.texture, command.color.r, command.color.g, command.color.b);
+    SDL_SetTextureAlphaMod(command.texture, command.color.a);
+    SDL_SetTextureBlendMode(command.texture, command.blendMode);
+    SDL_RenderCopy(renderer, command.texture, &command.src, &command.dst);
+    countDrawCall(command.texture, static_cast<Uint64>(command.dst.w) * command.dst.h);
+    SDL_SetTextureColorMod(command.texture, modR, modG, modB);
+    SDL_SetTextureAlphaMod(command.texture, modA);
+    SDL_SetTextureBlendMode(command.texture, previousBlendMode);
 }
 
 TTF_Font* Graphics::loadFont(const std::string& filepath, int size, const std::string& name) {
@@ -198,29 +930,85 @@ TTF_Font* Graphics::loadFont(const std::string& filepath, int size, const std::s
         return nullptr;
     }
     
-    fonts[name] = font;
+    fontSlots[getFontId(name).index] = font;
     return font;
 }
 
 TTF_Font* Graphics::getFont(const std::string& name) {
-    auto it = fonts.find(name);
-    return (it != fonts.end()) ? it->second : nullptr;
+    auto it = fontIndices.find(name);
+    return (it != fontIndices.end()) ? fontSlots[it->second] : nullptr;
+}
+
+FontId Graphics::getFontId(const std::string& name) {
+    auto it = fontIndices.find(name);
+    if (it != fontIndices.end()) {
+        return FontId{it->second};
+    }
+    const int index = static_cast<int>(fontSlots.size());
+    fontSlots.push_back(nullptr);
+    fontIndices.emplace(name, index);
+    return FontId{index};
 }
 
 void Graphics::drawText(const std::string& text, int x, int y, const std::string& fontName, SDL_Color color) {
+    drawText(text.c_str(), x, y, fontName, color);
+}
+
+void Graphics::drawText(const std::string& text, int x, int y, FontId fontId, SDL_Color color) {
+    drawText(text.c_str(), x, y, fontId, color);
+}
+
+void Graphics::drawText(const char* text, int x, int y, const std::string& fontName, SDL_Color color) {
+    TRACE_SCOPE("Graphics::drawText");
     TTF_Font* font = getFont(fontName);
     if (!font) {
         std::cerr << "フォントが見つかりません: " << fontName << std::endl;
         return;
     }
+    drawTextWithFont(text, x, y, font, color);
+}
+
+void Graphics::drawText(const char* text, int x, int y, FontId fontId, SDL_Color color) {
+    TRACE_SCOPE("Graphics::drawText");
+    TTF_Font* font = getFont(fontId);
+    if (!font) {
+        std::cerr << "フォントが見つかりません: ハンドル " << fontId.index << std::endl;
+        return;
+    }
+    drawTextWithFont(text, x, y, font, color);
+}
+
+void Graphics::drawTextWithFont(const char* text, int x, int y, TTF_Font* font, SDL_Color color) {
+    if (!text) return;
+    if (!renderer) {
+        std::cerr << "警告: Graphics::drawText: rendererがnullptrです" << std::endl;
+        return;
+    }
     
-    SDL_Surface* textSurface = TTF_RenderUTF8_Blended(font, text.c_str(), color);
+    glyphQuads.clear();
+    if (!glyphAtlas.layoutText(font, text, x, y, glyphQuads)) {
+        drawTextDirect(text, x, y, font, color);
+        return;
+    }
+    
+    // グリフはアトラスページのテクスチャとして他の描画と同じリストに積む
+    for (const GlyphAtlas::Quad& quad : glyphQuads) {
+        pushDrawCommand(quad.texture, quad.src, quad.dst, GlyphAtlas::PAGE_SIZE, GlyphAtlas::PAGE_SIZE, color, SDL_BLENDMODE_BLEND);
+    }
+}
+
+void Graphics::drawTextDirect(const char* text, int x, int y, TTF_Font* font, SDL_Color color) {
+    // 一時テクスチャはこの関数内で破棄するので、記録済みのコマンドを先に描画して即座に描画する
+    flush();
+    
+    SDL_Surface* textSurface = TTF_RenderUTF8_Blended(font, text, color);
+    frameStats.textRasterizations++;
     if (!textSurface) {
         std::cerr << "テキストサーフェス作成エラー: " << TTF_GetError() << std::endl;
         return;
     }
     
-    SDL_Texture* textTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
+    SDL_Texture* textTexture = createTextureFromSurface(textSurface);
     SDL_FreeSurface(textSurface);
     
     if (!textTexture) {
@@ -231,25 +1019,26 @@ void Graphics::drawText(const std::string& text, int x, int y, const std::string
     int textWidth, textHeight;
     if (SDL_QueryTexture(textTexture, nullptr, nullptr, &textWidth, &textHeight) != 0) {
         std::cerr << "警告: Graphics::drawText: SDL_QueryTexture失敗: " << SDL_GetError() << std::endl;
-        SDL_DestroyTexture(textTexture);
+        destroyTexture(textTexture);
         return;
     }
     
     // 無効なサイズの場合はスキップ
     if (textWidth <= 0 || textHeight <= 0) {
         std::cerr << "警告: Graphics::drawText: 無効なテクスチャサイズ" << std::endl;
-        SDL_DestroyTexture(textTexture);
+        destroyTexture(textTexture);
         return;
     }
     
     SDL_Rect dstRect = {x, y, textWidth, textHeight};
     if (renderer) {
         SDL_RenderCopy(renderer, textTexture, nullptr, &dstRect);
+        countDrawCall(textTexture, static_cast<Uint64>(textWidth) * textHeight);
     } else {
         std::cerr << "警告: Graphics::drawText: rendererがnullptrです" << std::endl;
     }
     
-    SDL_DestroyTexture(textTexture);
+    destroyTexture(textTexture);
 }
 
 SDL_Texture* Graphics::createTextTexture(const std::string& text, const std::string& fontName, SDL_Color color) {
@@ -263,14 +1052,18 @@ SDL_Texture* Graphics::createTextTexture(const std::string& text, const std::str
         std::cerr << "警告: Graphics::createTextTexture: フォントが見つかりません: " << fontName << std::endl;
         return nullptr;
     }
-    
+    return createTextTextureWithFont(text, font, color);
+}
+
+SDL_Texture* Graphics::createTextTextureWithFont(const std::string& text, TTF_Font* font, SDL_Color color) {
     SDL_Surface* textSurface = TTF_RenderUTF8_Blended(font, text.c_str(), color);
+    frameStats.textRasterizations++;
     if (!textSurface) {
         std::cerr << "警告: Graphics::createTextTexture: テキストサーフェス作成エラー: " << TTF_GetError() << std::endl;
         return nullptr;
     }
     
-    SDL_Texture* textTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
+    SDL_Texture* textTexture = createTextureFromSurface(textSurface);
     SDL_FreeSurface(textSurface);
     
     if (textTexture) {
@@ -281,6 +1074,144 @@ SDL_Texture* Graphics::createTextTexture(const std::string& text, const std::str
     return textTexture;
 }
 
+TextTexture Graphics::getTextTexture(const std::string& text, const std::string& fontName, SDL_Color color) {
+    return getTextTexture(text.c_str(), fontName, color);
+}
+
+TextTexture Graphics::getTextTexture(const std::string& text, FontId fontId, SDL_Color color) {
+    return getTextTexture(text.c_str(), fontId, color);
+}
+
+TextTexture Graphics::getTextTexture(const char* text, const std::string& fontName, SDL_Color color) {
+    if (!renderer) {
+        std::cerr << "警告: Graphics::getTextTexture: rendererがnullptrです" << std::endl;
+        return {};
+    }
+    
+    TTF_Font* font = getFont(fontName);
+    if (!font) {
+        std::cerr << "警告: Graphics::getTextTexture: フォントが見つかりません: " << fontName << std::endl;
+        return {};
+    }
+    return getTextTextureWithFont(text, font, color);
+}
+
+TextTexture Graphics::getTextTexture(const char* text, FontId fontId, SDL_Color color) {
+    if (!renderer) {
+        std::cerr << "警告: Graphics::getTextTexture: rendererがnullptrです" << std::endl;
+        return {};
+    }
+    
+    TTF_Font* font = getFont(fontId);
+    if (!font) {
+        std::cerr << "警告: Graphics::getTextTexture: フォントが見つかりません: ハンドル " << fontId.index << std::endl;
+        return {};
+    }
+    return getTextTextureWithFont(text, font, color);
+}
+
+bool Graphics::measureText(const char* text, FontId fontId, int& width, int& height) {
+    // 空の文字列はgetTextTexture()と同じく失敗として扱う（背景だけが描画されないように）
+    if (!text || text[0] == '\0') return false;
+    TTF_Font* font = getFont(fontId);
+    if (!font) {
+        std::cerr << "警告: Graphics::measureText: フォントが見つかりません: ハンドル " << fontId.index << std::endl;
+        return false;
+    }
+    // getTextTexture()と同じサイズになるよう、SDL_ttfのレイアウトで計算する
+    int measuredWidth = 0;
+    int measuredHeight = 0;
+    if (TTF_SizeUTF8(font, text, &measuredWidth, &measuredHeight) != 0) {
+        std::cerr << "警告: Graphics::measureText: TTF_SizeUTF8失敗: " << TTF_GetError() << std::endl;
+        return false;
+    }
+    width = measuredWidth;
+    height = measuredHeight;
+    return true;
+}
+
+TextTexture Graphics::getTextTextureWithFont(const char* text, TTF_Font* font, SDL_Color color) {
+    if (!text) return {};
+    const Uint32 packedColor = (static_cast<Uint32>(color.r) << 24) | (static_cast<Uint32>(color.g) << 16) |
+                               (static_cast<Uint32>(color.b) << 8) | static_cast<Uint32>(color.a);
+    const size_t hash = hashTextKey(text, font, packedColor);
+    
+    auto range = textCacheIndex.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        auto entry = it->second;
+        if (entry->font == font && entry->color == packedColor && entry->text == text) {
+            // 最近使用したエントリとして先頭に移動
+            textCacheEntries.splice(textCacheEntries.begin(), textCacheEntries, entry);
+            entry->lastUsedFrame = frameCounter;
+            textCacheStats.hits++;
+            return entry->value;
+        }
+    }
+    
+    textCacheStats.misses++;
+    TextTexture value;
+    value.texture = createTextTextureWithFont(text, font, color);
+    if (!value.texture) {
+        return value;
+    }
+    if (SDL_QueryTexture(value.texture, nullptr, nullptr, &value.width, &value.height) != 0) {
+        std::cerr << "警告: Graphics::getTextTexture: SDL_QueryTexture失敗: " << SDL_GetError() << std::endl;
+        destroyTexture(value.texture);
+        return {};
+    }
+    
+    const size_t bytes = static_cast<size_t>(value.width) * static_cast<size_t>(value.height) * 4;
+    ownedTextures.insert(value.texture);
+    textCacheEntries.push_front({text, font, packedColor, hash, value, bytes, frameCounter});
+    textCacheIndex.emplace(hash, textCacheEntries.begin());
+    textCacheStats.bytes += bytes;
+    textCacheStats.entries = textCacheEntries.size();
+    
+    evictTextCache();
+    return value;
+}
+
+void Graphics::setTextCacheBudget(size_t bytes) {
+    textCacheStats.budget = bytes;
+    evictTextCache();
+}
+
+void Graphics::clearTextCache() {
+    for (auto& entry : textCacheEntries) {
+        ownedTextures.erase(entry.value.texture);
+        destroyTexture(entry.value.texture);
+    }
+    textCacheEntries.clear();
+    textCacheIndex.clear();
+    textCacheStats.bytes = 0;
+    textCacheStats.entries = 0;
+}
+
+void Graphics::evictTextCache() {
+    while (textCacheStats.bytes > textCacheStats.budget && !textCacheEntries.empty()) {
+        auto last = std::prev(textCacheEntries.end());
+        // 現在のフレームで貸し出したテクスチャはまだ描画前の可能性があるため残す
+        if (last->lastUsedFrame >= frameCounter) {
+            break;
+        }
+        
+        auto range = textCacheIndex.equal_range(last->hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == last) {
+                textCacheIndex.erase(it);
+                break;
+            }
+        }
+        
+        ownedTextures.erase(last->value.texture);
+        destroyTexture(last->value.texture);
+        textCacheStats.bytes -= last->bytes;
+        textCacheStats.evictions++;
+        textCacheEntries.erase(last);
+    }
+    textCacheStats.entries = textCacheEntries.size();
+}
+
 void Graphics::drawTextureAspectRatio(SDL_Texture* texture, int x, int y, int baseSize, bool centerX, bool centerY) {
     if (!texture) return;
     
@@ -307,18 +1238,145 @@ void Graphics::drawTextureAspectRatio(SDL_Texture* texture, int x, int y, int ba
     drawTexture(texture, drawX, drawY, displayWidth, displayHeight);
 }
 
-void Graphics::drawRect(int x, int y, int width, int height, bool filled) {
+SDL_Texture* Graphics::getRenderTarget(const std::string& name, int width, int height, bool& needsRedraw) {
+    needsRedraw = false;
+    if (!renderer || width <= 0 || height <= 0) return nullptr;
+    
+    // 論理座標で描画したときに画面と同じ解像度になるよう、出力の倍率に合わせる
+    float scaleX, scaleY;
+    SDL_RenderGetScale(renderer, &scaleX, &scaleY);
+    const int pixelWidth = std::max(1, static_cast<int>(width * scaleX + 0.5f));
+    const int pixelHeight = std::max(1, static_cast<int>(height * scaleY + 0.5f));
+    
+    auto it = renderTargets.find(name);
+    if (it != renderTargets.end()) {
+        RenderTarget& target = it->second;
+        int currentWidth, currentHeight;
+        SDL_QueryTexture(target.texture, nullptr, nullptr, &currentWidth, &currentHeight);
+        if (currentWidth == pixelWidth && currentHeight == pixelHeight) {
+            needsRedraw = target.contentLost;
+            target.contentLost = false;
+            return target.texture;
+        }
+        
+        // 記録済みのコマンドが古いターゲットを参照している可能性があるため先に描画する
+        flush();
+        ownedTextures.erase(target.texture);
+        destroyTexture(target.texture);
+        renderTargets.erase(it);
+    }
+    
+    SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, pixelWidth, pixelHeight);
+    if (!texture) {
+        std::cerr << "警告: Graphics::getRenderTarget: レンダーターゲット作成エラー: " << SDL_GetError() << std::endl;
+        return nullptr;
+    }
+    frameStats.texturesCreated++;
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(texture, SDL_ScaleModeLinear);
+    
+    renderTargets[name] = {texture, static_cast<float>(pixelWidth) / width, static_cast<float>(pixelHeight) / height, false};
+    ownedTextures.insert(texture);
+    needsRedraw = true;
+    return texture;
+}
+
+bool Graphics::beginRenderTarget(SDL_Texture* target) {
+    if (!renderer || !target) return false;
+    
+    const RenderTarget* info = nullptr;
+    for (const auto& pair : renderTargets) {
+        if (pair.second.texture == target) {
+            info = &pair.second;
+            break;
+        }
+    }
+    if (!info) {
+        std::cerr << "警告: Graphics::beginRenderTarget: getRenderTarget()で作成されたターゲットではありません" << std::endl;
+        return false;
+    }
+    
+    flush();
+    if (SDL_SetRenderTarget(renderer, target) != 0) {
+        std::cerr << "警告: Graphics::beginRenderTarget: SDL_SetRenderTarget失敗: " << SDL_GetError() << std::endl;
+        return false;
+    }
+    // ターゲット設定時は倍率が1にリセットされるため、論理座標用の倍率を設定し直す
+    SDL_RenderSetScale(renderer, info->scaleX, info->scaleY);
+    
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    int targetWidth, targetHeight;
+    SDL_QueryTexture(target, nullptr, nullptr, &targetWidth, &targetHeight);
+    countDrawCall(nullptr, static_cast<Uint64>(targetWidth / info->scaleX) * static_cast<Uint64>(targetHeight / info->scaleY));
+    SDL_SetRenderDrawColor(renderer, drawColor.r, drawColor.g, drawColor.b, drawColor.a);
+    return true;
+}
+
+void Graphics::endRenderTarget() {
     if (!renderer) return;
+    flush();
+    // 画面に戻すと論理サイズ用のビューポートと倍率も復元される
+    SDL_SetRenderTarget(renderer, nullptr);
+}
+
+void Graphics::invalidateRenderTargets() {
+    for (auto& pair : renderTargets) {
+        pair.second.contentLost = true;
+    }
+}
+
+void Graphics::drawRect(int x, int y, int width, int height, bool filled) {
+    if (!renderer || width <= 0 || height <= 0) return;
     
-    SDL_Rect rect = {x, y, width, height};
+    SDL_BlendMode blendMode;
+    SDL_GetRenderDrawBlendMode(renderer, &blendMode);
+    const SDL_Rect noSource = {0, 0, 0, 0};
     
     if (filled) {
-        SDL_RenderFillRect(renderer, &rect);
-    } else {
-        SDL_RenderDrawRect(renderer, &rect);
+        frameStats.fillRects++;
+        pushDrawCommand(nullptr, noSource, {x, y, width, height}, 1, 1, drawColor, blendMode);
+        return;
+    }
+    
+    // 枠線は上下左右の1ピクセル幅の矩形として積む（SDL_RenderDrawRectと同じピクセルを塗る）
+    pushDrawCommand(nullptr, noSource, {x, y, width, 1}, 1, 1, drawColor, blendMode);
+    if (height > 1) {
+        pushDrawCommand(nullptr, noSource, {x, y + height - 1, width, 1}, 1, 1, drawColor, blendMode);
+    }
+    if (height > 2) {
+        pushDrawCommand(nullptr, noSource, {x, y + 1, 1, height - 2}, 1, 1, drawColor, blendMode);
+        if (width > 1) {
+            pushDrawCommand(nullptr, noSource, {x + width - 1, y + 1, 1, height - 2}, 1, 1, drawColor, blendMode);
+        }
     }
 }
 
 void Graphics::drawLine(int x1, int y1, int x2, int y2) {
+    if (!renderer) return;
+    flush();
     SDL_RenderDrawLine(renderer, x1, y1, x2, y2);
+    countDrawCall(nullptr, static_cast<Uint64>(std::max(std::abs(x2 - x1), std::abs(y2 - y1)) + 1));
+}
+
+void Graphics::countDrawCall(SDL_Texture* texture, Uint64 pixels) {
+    if (frameStats.drawCalls > 0 && texture != lastDrawTexture) {
+        frameStats.textureSwitches++;
+    }
+    lastDrawTexture = texture;
+    frameStats.drawCalls++;
+    frameStats.pixelsFilled += pixels;
+}
+
+SDL_Texture* Graphics::createTextureFromSurface(SDL_Surface* surface) {
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    if (texture) {
+        frameStats.texturesCreated++;
+    }
+    return texture;
+}
+
+void Graphics::destroyTexture(SDL_Texture* texture) {
+    SDL_DestroyTexture(texture);
+    frameStats.texturesDestroyed++;
 } 
\ No newline at end of file
@@ -10,7 +10,91 @@
 #include <SDL_ttf.h>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <memory>
+#include <vector>
+#include <list>
+#include <functional>
+#include <future>
+#include <iosfwd>
+#include "GlyphAtlas.h"
+#include "TextureAtlas.h"
+#include "RenderStats.h"
+
+/**
+ * @brief キャッシュされたテキストテクスチャ
+ * @details テクスチャはGraphicsが所有する借用ポインタであり、呼び出し側で破棄してはならない。
+ * 次のフレーム以降はキャッシュから追い出される可能性があるため、フレームをまたいで保持しないこと。
+ */
+struct TextTexture {
+    SDL_Texture* texture = nullptr;  /**< @brief テクスチャへの借用ポインタ */
+    int width = 0;                   /**< @brief テクスチャの幅 */
+    int height = 0;                  /**< @brief テクスチャの高さ */
+};
+
+/**
+ * @brief テクスチャ上の描画領域
+ * @details アトラスに配置されたテクスチャの場合はページテクスチャとページ内の矩形を表す。
+ */
+struct TextureRegion {
+    SDL_Texture* texture = nullptr;  /**< @brief テクスチャ（アトラスページまたは元のテクスチャ） */
+    SDL_Rect rect = {0, 0, 0, 0};    /**< @brief テクスチャ内のソース矩形 */
+};
+
+/**
+ * @brief デコード済みの画像
+ * @details Graphics::decodeImage()で作成し、Graphics::loadTexture()でテクスチャに転送する。
+ * デコードはレンダラーを使用しないため、ワーカースレッドで行える。
+ */
+struct DecodedImage {
+    SDL_Surface* surface = nullptr;       /**< @brief 元画像 */
+    SDL_Surface* atlasSurface = nullptr;  /**< @brief テクスチャアトラス用の縮小画像（ARGB8888） */
+    bool opaque = false;                  /**< @brief 全ピクセルが不透明か */
+    bool fullResolution = false;          /**< @brief atlasSurfaceが元画像と同じ解像度か */
+    std::string error;                    /**< @brief デコードに失敗した場合のエラーメッセージ */
+};
+
+/**
+ * @brief テクスチャのハンドル
+ * @details Graphics::getTextureId()で名前から一度だけ解決し、状態クラスに保持して使う。
+ * 描画時の参照は配列の添字になるため、文字列のハッシュ計算や一時文字列の生成が発生しない。
+ * 読み込み前に解決したハンドルも、同じ名前で読み込まれた時点から有効なテクスチャを指す。
+ */
+struct TextureId {
+    int index = -1;  /**< @brief Graphics内のテクスチャ配列の添字（-1は無効） */
+    
+    /**
+     * @brief 名前が解決済みかどうかの判定
+     * @return 解決済みか（テクスチャが読み込まれているかどうかはgetTexture()で判定する）
+     */
+    bool isValid() const { return index >= 0; }
+};
+
+/**
+ * @brief フォントのハンドル
+ * @details Graphics::getFontId()で名前から一度だけ解決する。扱いはTextureIdと同じ。
+ */
+struct FontId {
+    int index = -1;  /**< @brief Graphics内のフォント配列の添字（-1は無効） */
+    
+    /**
+     * @brief 名前が解決済みかどうかの判定
+     * @return 解決済みか（フォントが読み込まれているかどうかはgetFont()で判定する）
+     */
+    bool isValid() const { return index >= 0; }
+};
+
+/**
+ * @brief テキストテクスチャキャッシュの統計情報
+ */
+struct TextCacheStats {
+    Uint64 hits = 0;        /**< @brief ヒット数 */
+    Uint64 misses = 0;      /**< @brief ミス数（ラスタライズ回数） */
+    Uint64 evictions = 0;   /**< @brief 追い出し数 */
+    size_t bytes = 0;       /**< @brief 使用中のメモリ量（バイト） */
+    size_t budget = 0;      /**< @brief メモリ予算（バイト） */
+    size_t entries = 0;     /**< @brief エントリ数 */
+};
 
 /**
  * @brief グラフィックス描画を担当するクラス
@@ -20,10 +104,122 @@ class Graphics {
 private:
     SDL_Window* window;
     SDL_Renderer* renderer;
-    std::unordered_map<std::string, SDL_Texture*> textures;
-    std::unordered_map<std::string, TTF_Font*> fonts;
+    bool headless;                  // ウィンドウを持たないオフスクリーン描画か
+    SDL_Surface* headlessSurface;   // ヘッドレス時の描画先
+    std::function<void(Graphics&)> presentOverlay;  // present()で最前面に描画するオーバーレイ（デバッグ表示用）
+    std::vector<SDL_Texture*> textureSlots;                        // TextureIdの添字で引くテクスチャ（未読み込みはnullptr）
+    std::unordered_map<std::string, int> textureIndices;           // テクスチャ名からtextureSlotsの添字への対応
+    std::unordered_map<std::string, SDL_Texture*> texturesByPath;  // 同じファイルを二重に読み込まないためのキャッシュ
+    std::unordered_set<SDL_Texture*> opaqueTextures;               // 全ピクセルが不透明なテクスチャ（ブレンド不要）
+    std::vector<TTF_Font*> fontSlots;                              // FontIdの添字で引くフォント（未読み込みはnullptr）
+    std::unordered_map<std::string, int> fontIndices;              // フォント名からfontSlotsの添字への対応
     int screenWidth;
     int screenHeight;
+    
+    // テキスト描画用のグリフアトラス
+    GlyphAtlas glyphAtlas;
+    std::vector<GlyphAtlas::Quad> glyphQuads;
+    bool geometrySupported;  // SDL_RenderGeometryが使用可能か
+    
+    // 画像アセットの縮小コピーをまとめたテクスチャアトラス
+    TextureAtlas textureAtlas;
+    bool textureAtlasBatching;  // beginTextureAtlas()〜endTextureAtlas()の間か
+    
+    // 名前付きレンダーターゲット（静的なレイヤーの焼き込み用）
+    struct RenderTarget {
+        SDL_Texture* texture;
+        float scaleX;             // 論理座標からターゲットのピクセルへの倍率
+        float scaleY;
+        bool contentLost;         // デバイスリセットなどで内容が失われたか
+    };
+    std::unordered_map<std::string, RenderTarget> renderTargets;
+    
+    // 事前縮小テクスチャ（ソフトウェアレンダラーで毎フレームの拡大縮小を避けるため、出力サイズに縮小したコピー）
+    struct PrescaledKey {
+        SDL_Texture* texture;
+        int width;                // 出力ピクセル単位の幅
+        int height;               // 出力ピクセル単位の高さ
+        bool operator==(const PrescaledKey& other) const {
+            return texture == other.texture && width == other.width && height == other.height;
+        }
+    };
+    struct PrescaledKeyHash {
+        size_t operator()(const PrescaledKey& key) const {
+            return std::hash<const void*>()(key.texture) ^ (static_cast<size_t>(key.width) << 16) ^ static_cast<size_t>(key.height);
+        }
+    };
+    struct PrescaledVariant {
+        PrescaledKey key;
+        SDL_Texture* texture;
+        size_t bytes;
+        Uint64 lastUsedFrame;
+    };
+    bool prescaleEnabled;
+    std::list<PrescaledVariant> prescaledVariants;  // 先頭が最近使用したもの
+    std::unordered_map<PrescaledKey, std::list<PrescaledVariant>::iterator, PrescaledKeyHash> prescaledIndex;
+    std::unordered_map<PrescaledKey, int, PrescaledKeyHash> prescaleRequests;  // まだ作成していないサイズの要求回数
+    size_t prescaledBytes;
+    size_t prescaledBudget;
+    int prescaledCreatedThisFrame;
+    // 縮小元の画像（初めて事前縮小が必要になった時にファイルから読み直し、事前縮小テクスチャと同じ予算で管理する）
+    struct PrescaleSource {
+        SDL_Texture* texture;
+        SDL_Surface* surface;
+        size_t bytes;
+        Uint64 lastUsedFrame;
+    };
+    std::list<PrescaleSource> prescaleSources;  // 先頭が最近使用したもの
+    std::unordered_map<SDL_Texture*, std::list<PrescaleSource>::iterator> prescaleSourceIndex;
+    std::unordered_map<SDL_Texture*, std::future<SDL_Surface*>> pendingPrescaleSources;  // 別スレッドでデコード中のもの
+    std::unordered_map<SDL_Texture*, std::string> texturePaths;  // 縮小元を読み直すためのファイルパス
+    
+    // 遅延描画リスト（present()またはflush()でまとめて描画する）
+    struct DrawCommand {
+        SDL_Texture* texture;     // nullptrの場合は塗りつぶし矩形
+        SDL_Rect src;
+        SDL_Rect dst;
+        float u0, v0, u1, v1;
+        SDL_Color color;          // 頂点カラー（記録時のテクスチャのカラー/アルファ変調）
+        SDL_BlendMode blendMode;
+        int layer;
+        int next;                 // 同じバッチ内の次のコマンド（-1で終端）
+    };
+    struct DrawBatch {
+        SDL_Texture* texture;
+        SDL_BlendMode blendMode;
+        SDL_Rect bounds;          // バッチ内の全コマンドを囲む矩形
+        int first;
+        int last;
+    };
+    std::vector<DrawCommand> drawCommands;
+    std::vector<DrawBatch> drawBatches;
+    std::vector<SDL_Vertex> batchVertices;
+    std::vector<int> batchIndices;
+    std::unordered_set<SDL_Texture*> ownedTextures;  // 遅延描画してよい（Graphicsが所有する）テクスチャ
+    SDL_Color drawColor;
+    int drawLayer;
+    bool drawLayersUsed;
+    
+    // テキストテクスチャキャッシュ（(文字列, フォント, 色) をキーとするLRU）
+    struct TextCacheEntry {
+        std::string text;
+        TTF_Font* font;
+        Uint32 color;
+        size_t hash;
+        TextTexture value;
+        size_t bytes;
+        Uint64 lastUsedFrame;
+    };
+    std::list<TextCacheEntry> textCacheEntries;  // 先頭が最近使用したエントリ
+    std::unordered_multimap<size_t, std::list<TextCacheEntry>::iterator> textCacheIndex;
+    TextCacheStats textCacheStats;
+    Uint64 frameCounter;
+    
+    // 描画統計（present()で確定する）
+    RenderStats frameStats;                         // 描画中のフレームの統計
+    RenderStats lastFrameStats;                     // 直前に確定したフレームの統計
+    SDL_Texture* lastDrawTexture;                   // テクスチャ切り替えの判定用（直前の描画呼び出しのテクスチャ）
+    std::unique_ptr<std::ofstream> renderStatsCsv;  // フレームごとの統計の出力先（nullptrの場合は出力しない）
 
 public:
     /**
@@ -50,6 +246,28 @@ public:
      */
     void cleanup();
     
+    /**
+     * @brief ヘッドレスモードの設定
+     * @details initialize()の前に呼び出す。ヘッドレスモードではウィンドウを作らず、
+     * オフスクリーンのサーフェスにソフトウェアレンダラーで描画する（垂直同期なし）。
+     * ディスプレイのないCI環境などで、描画処理をそのまま実行・計測するために使う。
+     * @param enabled ヘッドレスモードにするか
+     */
+    void setHeadless(bool enabled);
+    
+    /**
+     * @brief ヘッドレスモードかどうかの取得
+     * @return ヘッドレスモードか
+     */
+    bool isHeadless() const { return headless; }
+    
+    /**
+     * @brief 現在の描画内容をPNGとして保存
+     * @param filepath 保存先のファイルパス
+     * @return 保存が成功したか
+     */
+    bool saveScreenshot(const std::string& filepath);
+    
     /**
      * @brief 画面クリア
      */
@@ -57,9 +275,39 @@ public:
     
     /**
      * @brief 画面更新
+     * @details 遅延描画リストを描画してから画面を更新する。
      */
     void present();
     
+    /**
+     * @brief オーバーレイの設定
+     * @details 設定した関数はpresent()で他の全ての描画の後に呼ばれる。
+     * 各Stateが自身でpresent()を呼ぶため、State外からの描画はここで行う。
+     * @param overlay 描画する関数（nullptrで解除）
+     */
+    void setPresentOverlay(std::function<void(Graphics&)> overlay) { presentOverlay = std::move(overlay); }
+    
+    /**
+     * @brief 遅延描画リストの描画
+     * @details 記録済みの描画コマンドをレイヤー順に並べ、同じテクスチャ・ブレンドモードのコマンドを
+     * SDL_RenderGeometryでまとめて描画する。レンダラーを直接操作する前に呼び出す。
+     */
+    void flush();
+    
+    /**
+     * @brief 描画レイヤーの設定
+     * @details 同じflush()内では、レイヤー番号の小さいコマンドから順に描画される。
+     * 同じレイヤー内では呼び出し順が保たれる。
+     * @param layer レイヤー番号（デフォルト: 0）
+     */
+    void setDrawLayer(int layer) { drawLayer = layer; }
+    
+    /**
+     * @brief 描画レイヤーの取得
+     * @return 現在のレイヤー番号
+     */
+    int getDrawLayer() const { return drawLayer; }
+    
     /**
      * @brief 描画色の設定
      * @param r 赤成分
@@ -71,12 +319,78 @@ public:
     
     /**
      * @brief テクスチャの読み込み
+     * @details 同じファイルが読み込み済みの場合は、デコードせずに既存のテクスチャを名前に登録して返す。
+     * 読み込んだ画像の縮小コピーはテクスチャアトラスにも配置される。
+     * 全ピクセルが不透明な画像はブレンドなし（SDL_BLENDMODE_NONE）に設定される。
      * @param filepath ファイルパス
      * @param name テクスチャ名
      * @return テクスチャへのポインタ
      */
     SDL_Texture* loadTexture(const std::string& filepath, const std::string& name);
     
+    /**
+     * @brief デコード済みの画像からテクスチャを作成
+     * @details 描画スレッドで呼び出す。既に同じファイルが読み込まれている場合は画像を破棄して既存のテクスチャを返す。
+     * @param filepath ファイルパス（同じファイルの二重読み込みの判定に使用）
+     * @param name テクスチャ名
+     * @param image デコード済みの画像（サーフェスの所有権を受け取り、呼び出し後は空になる）
+     * @return テクスチャへのポインタ
+     */
+    SDL_Texture* loadTexture(const std::string& filepath, const std::string& name, DecodedImage& image);
+    
+    /**
+     * @brief 画像ファイルのデコード
+     * @details 読み込み、不透明判定、アトラス用の縮小までのCPU側の処理を行う。
+     * レンダラーを使用しないため、任意のスレッドから呼び出せる。
+     * @param filepath ファイルパス
+     * @param image デコード結果（出力）
+     * @return デコードが成功したか
+     */
+    static bool decodeImage(const std::string& filepath, DecodedImage& image);
+    
+    /**
+     * @brief デコード済みの画像の破棄
+     * @param image 破棄する画像
+     */
+    static void freeDecodedImage(DecodedImage& image);
+    
+    /**
+     * @brief テクスチャが完全に不透明かどうかの判定
+     * @details loadTexture()時にアルファチャンネルを走査し、全ピクセルが不透明なテクスチャは
+     * SDL_BLENDMODE_NONEで描画される（アルファ変調をかけた場合はブレンドされる）。
+     * @param texture テクスチャへのポインタ
+     * @return 完全に不透明か
+     */
+    bool isTextureOpaque(SDL_Texture* texture) const { return opaqueTextures.count(texture) != 0; }
+    
+    /**
+     * @brief テクスチャアトラスへの一括登録の開始
+     * @details endTextureAtlas()までに読み込んだテクスチャは、まとめて大きい順に配置される。
+     */
+    void beginTextureAtlas();
+    
+    /**
+     * @brief テクスチャアトラスへの一括登録の終了
+     * @details 登録済みのテクスチャをアトラスページに配置して転送する。
+     */
+    void endTextureAtlas();
+    
+    /**
+     * @brief テクスチャの描画領域の取得
+     * @details アトラスに配置されている場合はページテクスチャと縮小コピーの矩形を返す。
+     * 配置されていない場合は元のテクスチャ全体を返す。
+     * @param name テクスチャ名
+     * @return 描画領域（テクスチャがない場合はtextureがnullptr）
+     */
+    TextureRegion getTextureRegion(const std::string& name);
+    
+    /**
+     * @brief テクスチャの描画領域の取得（ハンドル指定）
+     * @param id テクスチャのハンドル
+     * @return 描画領域（テクスチャがない場合はtextureがnullptr）
+     */
+    TextureRegion getTextureRegion(TextureId id);
+    
     /**
      * @brief テクスチャの取得
      * @param name テクスチャ名
@@ -84,6 +398,24 @@ public:
      */
     SDL_Texture* getTexture(const std::string& name);
     
+    /**
+     * @brief テクスチャ名のハンドルへの解決
+     * @details 初めての名前の場合は空のスロットを確保する。状態の初期化時などに一度だけ呼び出し、
+     * 結果を保持して毎フレームの描画に使う。
+     * @param name テクスチャ名
+     * @return テクスチャのハンドル
+     */
+    TextureId getTextureId(const std::string& name);
+    
+    /**
+     * @brief テクスチャの取得（ハンドル指定）
+     * @param id テクスチャのハンドル
+     * @return テクスチャへのポインタ（未読み込みの場合はnullptr）
+     */
+    SDL_Texture* getTexture(TextureId id) const {
+        return (id.index >= 0 && id.index < static_cast<int>(textureSlots.size())) ? textureSlots[id.index] : nullptr;
+    }
+    
     /**
      * @brief テクスチャの描画（名前指定）
      * @param name テクスチャ名
@@ -104,6 +436,16 @@ public:
      */
     void drawTexture(SDL_Texture* texture, int x, int y, int width = -1, int height = -1);
     
+    /**
+     * @brief テクスチャの描画（ハンドル指定）
+     * @param id テクスチャのハンドル
+     * @param x X座標
+     * @param y Y座標
+     * @param width 幅（-1の場合は元のサイズ）
+     * @param height 高さ（-1の場合は元のサイズ）
+     */
+    void drawTexture(TextureId id, int x, int y, int width = -1, int height = -1);
+    
     /**
      * @brief アスペクト比を保持したテクスチャの描画
      * @details テクスチャの元のアスペクト比を保持しながら、基準サイズに合わせて描画する。
@@ -144,8 +486,26 @@ public:
      */
     TTF_Font* getFont(const std::string& name);
     
+    /**
+     * @brief フォント名のハンドルへの解決
+     * @details 初めての名前の場合は空のスロットを確保する。
+     * @param name フォント名
+     * @return フォントのハンドル
+     */
+    FontId getFontId(const std::string& name);
+    
+    /**
+     * @brief フォントの取得（ハンドル指定）
+     * @param id フォントのハンドル
+     * @return フォントへのポインタ（未読み込みの場合はnullptr）
+     */
+    TTF_Font* getFont(FontId id) const {
+        return (id.index >= 0 && id.index < static_cast<int>(fontSlots.size())) ? fontSlots[id.index] : nullptr;
+    }
+    
     /**
      * @brief テキストの描画
+     * @details グリフアトラスにキャッシュされたグリフをクワッドとしてまとめて描画する。
      * @param text テキスト
      * @param x X座標
      * @param y Y座標
@@ -154,6 +514,37 @@ public:
      */
     void drawText(const std::string& text, int x, int y, const std::string& fontName, SDL_Color color = {255, 255, 255, 255});
     
+    /**
+     * @brief テキストの描画（フォントのハンドル指定）
+     * @param text テキスト
+     * @param x X座標
+     * @param y Y座標
+     * @param fontId フォントのハンドル
+     * @param color 色（デフォルト: 白）
+     */
+    void drawText(const std::string& text, int x, int y, FontId fontId, SDL_Color color = {255, 255, 255, 255});
+    
+    /**
+     * @brief テキストの描画（終端文字付きの文字列）
+     * @details 文字列リテラルやFrameArenaで整形した文字列を、std::stringを作らずに描画する。
+     * @param text テキスト
+     * @param x X座標
+     * @param y Y座標
+     * @param fontName フォント名
+     * @param color 色（デフォルト: 白）
+     */
+    void drawText(const char* text, int x, int y, const std::string& fontName, SDL_Color color = {255, 255, 255, 255});
+    
+    /**
+     * @brief テキストの描画（終端文字付きの文字列、フォントのハンドル指定）
+     * @param text テキスト
+     * @param x X座標
+     * @param y Y座標
+     * @param fontId フォントのハンドル
+     * @param color 色（デフォルト: 白）
+     */
+    void drawText(const char* text, int x, int y, FontId fontId, SDL_Color color = {255, 255, 255, 255});
+    
     /**
      * @brief テキストテクスチャの作成
      * @param text テキスト
@@ -163,6 +554,148 @@ public:
      */
     SDL_Texture* createTextTexture(const std::string& text, const std::string& fontName, SDL_Color color = {255, 255, 255, 255});
     
+    /**
+     * @brief キャッシュされたテキストテクスチャの取得
+     * @details 同じ (文字列, フォント, 色) のテキストは一度だけラスタライズされ、以降はキャッシュから返される。
+     * 返されるテクスチャはGraphicsが所有しているため、呼び出し側で破棄してはならない。
+     * @param text テキスト
+     * @param fontName フォント名
+     * @param color 色（デフォルト: 白）
+     * @return テキストテクスチャとそのサイズ（失敗時はtextureがnullptr）
+     */
+    TextTexture getTextTexture(const std::string& text, const std::string& fontName, SDL_Color color = {255, 255, 255, 255});
+    
+    /**
+     * @brief キャッシュされたテキストテクスチャの取得（フォントのハンドル指定）
+     * @param text テキスト
+     * @param fontId フォントのハンドル
+     * @param color 色（デフォルト: 白）
+     * @return テキストテクスチャとそのサイズ（失敗時はtextureがnullptr）
+     */
+    TextTexture getTextTexture(const std::string& text, FontId fontId, SDL_Color color = {255, 255, 255, 255});
+    
+    /**
+     * @brief キャッシュされたテキストテクスチャの取得（終端文字付きの文字列）
+     * @details キャッシュにヒットした場合はstd::stringを作らない。
+     * @param text テキスト
+     * @param fontName フォント名
+     * @param color 色（デフォルト: 白）
+     * @return テキストテクスチャとそのサイズ（失敗時はtextureがnullptr）
+     */
+    TextTexture getTextTexture(const char* text, const std::string& fontName, SDL_Color color = {255, 255, 255, 255});
+    
+    /**
+     * @brief キャッシュされたテキストテクスチャの取得（終端文字付きの文字列、フォントのハンドル指定）
+     * @param text テキスト
+     * @param fontId フォントのハンドル
+     * @param color 色（デフォルト: 白）
+     * @return テキストテクスチャとそのサイズ（失敗時はtextureがnullptr）
+     */
+    TextTexture getTextTexture(const char* text, FontId fontId, SDL_Color color = {255, 255, 255, 255});
+    
+    /**
+     * @brief テキストの描画サイズの取得
+     * @details テクスチャを作らずにサイズだけを計算する。背景の大きさや配置を決めてからdrawText()で描画する場合に使う。
+     * @param text テキスト（終端文字付き）
+     * @param fontId フォントのハンドル
+     * @param width 幅の格納先
+     * @param height 高さの格納先
+     * @return 成功したか（失敗時はwidthとheightを変更しない）
+     */
+    bool measureText(const char* text, FontId fontId, int& width, int& height);
+    
+    /**
+     * @brief テキストの描画サイズの取得（std::string）
+     * @param text テキスト
+     * @param fontId フォントのハンドル
+     * @param width 幅の格納先
+     * @param height 高さの格納先
+     * @return 成功したか
+     */
+    bool measureText(const std::string& text, FontId fontId, int& width, int& height) {
+        return measureText(text.c_str(), fontId, width, height);
+    }
+    
+    /**
+     * @brief テキストテクスチャキャッシュのメモリ予算の設定
+     * @param bytes メモリ予算（バイト）
+     */
+    void setTextCacheBudget(size_t bytes);
+    
+    /**
+     * @brief テキストテクスチャキャッシュの統計情報の取得
+     * @return 統計情報への参照
+     */
+    const TextCacheStats& getTextCacheStats() const { return textCacheStats; }
+    
+    /**
+     * @brief 描画統計の取得
+     * @return 直前にpresent()したフレームの描画統計
+     */
+    const RenderStats& getRenderStats() const { return lastFrameStats; }
+    
+    /**
+     * @brief 描画統計のCSV出力の設定
+     * @details present()のたびに、そのフレームの描画統計を1行ずつ書き出す。
+     * @param filepath 出力先のファイルパス（空文字列で出力を停止）
+     * @return ファイルを開けたか
+     */
+    bool setRenderStatsCsv(const std::string& filepath);
+    
+    /**
+     * @brief テキストテクスチャキャッシュのクリア
+     */
+    void clearTextCache();
+    
+    /**
+     * @brief 名前付きレンダーターゲットの取得
+     * @details 論理サイズを出力解像度に合わせた大きさのターゲットを作成する。同じ名前のターゲットがあれば再利用し、
+     * 出力解像度が変わった場合は作り直す。作り直した場合や内容が失われた場合はneedsRedrawがtrueになる。
+     * 返されるテクスチャはGraphicsが所有する。
+     * @param name ターゲット名
+     * @param width 論理幅
+     * @param height 論理高さ
+     * @param needsRedraw 内容を描き直す必要があるか（出力）
+     * @return ターゲットテクスチャへのポインタ（失敗時はnullptr）
+     */
+    SDL_Texture* getRenderTarget(const std::string& name, int width, int height, bool& needsRedraw);
+    
+    /**
+     * @brief レンダーターゲットへの描画の開始
+     * @details ターゲットを透明でクリアし、以降の描画をターゲットへ向ける。座標は論理座標のまま使える。
+     * @param target getRenderTarget()で取得したテクスチャ
+     * @return 開始が成功したか
+     */
+    bool beginRenderTarget(SDL_Texture* target);
+    
+    /**
+     * @brief レンダーターゲットへの描画の終了
+     * @details 記録済みの描画をターゲットに描画し、描画先を画面に戻す。
+     */
+    void endRenderTarget();
+    
+    /**
+     * @brief 全レンダーターゲットの内容を無効化
+     * @details SDL_RENDER_TARGETS_RESETなどでターゲットの内容が失われたときに呼び出す。
+     */
+    void invalidateRenderTargets();
+    
+    /**
+     * @brief 事前縮小テクスチャの有効化
+     * @details 有効な場合、読み込んだテクスチャが同じ出力サイズで繰り返し描画されると、
+     * そのサイズに高品質に縮小したコピーを作成し、以降は等倍で描画する。
+     * ソフトウェアレンダラーでは初期化時に自動で有効になる。
+     * 縮小元の画像は必要になった時にファイルから読み直すため、無効の間に読み込んだテクスチャも対象になる。
+     * @param enabled 有効にするか
+     */
+    void setPrescaleEnabled(bool enabled);
+    
+    /**
+     * @brief 事前縮小テクスチャのメモリ予算の設定
+     * @param bytes メモリ予算（バイト）
+     */
+    void setPrescaleBudget(size_t bytes);
+    
     /**
      * @brief 矩形の描画
      * @param x X座標
@@ -184,9 +717,13 @@ public:
     
     /**
      * @brief レンダラーの取得
+     * @details 呼び出し側がレンダラーを直接操作できるよう、遅延描画リストを先に描画する。
      * @return SDLレンダラーへのポインタ
      */
-    SDL_Renderer* getRenderer() { return renderer; }
+    SDL_Renderer* getRenderer() {
+        flush();
+        return renderer;
+    }
     
     /**
      * @brief 画面幅の取得
@@ -199,4 +736,150 @@ public:
      * @return 画面高さ
      */
     int getScreenHeight() const { return screenHeight; }
+    
+private:
+    /**
+     * @brief テクスチャ描画コマンドの記録
+     * @details Graphicsが所有していないテクスチャは、呼び出し側がflush()前に破棄する可能性があるため即座に描画する。
+     * アトラスの縮小コピーで足りる大きさで描画される場合は、アトラスページから描画する。
+     * @param texture テクスチャへのポインタ
+     * @param srcRect ソース矩形（nullptrの場合は全体）
+     * @param dstRect 描画先矩形
+     */
+    void submitTexture(SDL_Texture* texture, const SDL_Rect* srcRect, const SDL_Rect& dstRect);
+    
+    /**
+     * @brief 事前縮小テクスチャの検索（条件を満たせば作成）
+     * @details 同じサイズの要求が一定回数続いた場合に、1フレームあたりの作成数の上限内で作成する。
+     * @param texture 元のテクスチャ
+     * @param textureWidth 元のテクスチャの幅
+     * @param textureHeight 元のテクスチャの高さ
+     * @param dstRect 描画先矩形（論理座標）
+     * @return 事前縮小テクスチャ（使用できない場合はnullptr）
+     */
+    const PrescaledVariant* findPrescaledVariant(SDL_Texture* texture, int textureWidth, int textureHeight, const SDL_Rect& dstRect);
+    
+    /**
+     * @brief 縮小元の画像の取得
+     * @details 保持していない場合は別スレッドでのデコードを開始し、完了するまではnullptrを返す
+     * （描画の途中でファイルの読み込みとデコードを待たないため）。
+     * @param texture 元のテクスチャ
+     * @return 縮小元の画像（デコード中または失敗した場合はnullptr）
+     */
+    SDL_Surface* getPrescaleSource(SDL_Texture* texture);
+    
+    /**
+     * @brief 事前縮小テクスチャの作成
+     * @param key 元のテクスチャと出力サイズ
+     * @param source 縮小元の画像
+     * @return 作成したテクスチャ（失敗時はnullptr）
+     */
+    SDL_Texture* createPrescaledVariant(const PrescaledKey& key, SDL_Surface* source);
+    
+    /**
+     * @brief メモリ予算を超えた事前縮小テクスチャと縮小元の画像の追い出し
+     * @details 両方のうち最も長く使われていないものから追い出す。現在のフレームで使用されたものは追い出さない。
+     */
+    void evictPrescaledVariants();
+    
+    /**
+     * @brief 事前縮小テクスチャと縮小元の画像の破棄
+     * @details 縮小元の画像はファイルから読み直せるため、再び必要になった時に改めてデコードする。
+     */
+    void clearPrescaledVariants();
+    
+    /**
+     * @brief 描画コマンドの追加
+     * @param texture テクスチャへのポインタ（nullptrの場合は塗りつぶし矩形）
+     * @param src ソース矩形
+     * @param dst 描画先矩形
+     * @param textureWidth テクスチャの幅
+     * @param textureHeight テクスチャの高さ
+     * @param color 頂点カラー
+     * @param blendMode ブレンドモード
+     */
+    void pushDrawCommand(SDL_Texture* texture, const SDL_Rect& src, const SDL_Rect& dst,
+                         int textureWidth, int textureHeight, SDL_Color color, SDL_BlendMode blendMode);
+    
+    /**
+     * @brief 描画コマンドのバッチ化
+     * @details コマンドは、間にあるバッチと重ならない場合に限り、直近の同じ描画状態のバッチへ合流させる。
+     */
+    void buildDrawBatches();
+    
+    /**
+     * @brief バッチの描画
+     * @param batch 描画するバッチ
+     */
+    void renderDrawBatch(const DrawBatch& batch);
+    
+    /**
+     * @brief 描画コマンドの個別描画（SDL_RenderGeometry非対応時のフォールバック）
+     * @param command 描画コマンド
+     */
+    void renderDrawCommandDirect(const DrawCommand& command);
+    
+    /**
+     * @brief 描画呼び出しの統計への加算
+     * @param texture 描画に使用したテクスチャ（塗りつぶしの場合はnullptr）
+     * @param pixels 描画先の面積（論理座標のピクセル数）
+     */
+    void countDrawCall(SDL_Texture* texture, Uint64 pixels);
+    
+    /**
+     * @brief サーフェスからのテクスチャの作成（統計に記録する）
+     * @param surface 元のサーフェス
+     * @return 作成したテクスチャ（失敗時はnullptr）
+     */
+    SDL_Texture* createTextureFromSurface(SDL_Surface* surface);
+    
+    /**
+     * @brief テクスチャの破棄（統計に記録する）
+     * @param texture 破棄するテクスチャ
+     */
+    void destroyTexture(SDL_Texture* texture);
+    
+    /**
+     * @brief テキストの直接描画（アトラスが使用できない場合のフォールバック）
+     * @param text テキスト
+     * @param x X座標
+     * @param y Y座標
+     * @param font フォントへのポインタ
+     * @param color 色
+     */
+    void drawTextDirect(const char* text, int x, int y, TTF_Font* font, SDL_Color color);
+    
+    /**
+     * @brief 解決済みのフォントによるテキストの描画
+     * @param text テキスト
+     * @param x X座標
+     * @param y Y座標
+     * @param font フォントへのポインタ
+     * @param color 色
+     */
+    void drawTextWithFont(const char* text, int x, int y, TTF_Font* font, SDL_Color color);
+    
+    /**
+     * @brief 解決済みのフォントによるテキストテクスチャの作成
+     * @param text テキスト
+     * @param font フォントへのポインタ
+     * @param color 色
+     * @return テキストテクスチャへのポインタ
+     */
+    SDL_Texture* createTextTextureWithFont(const std::string& text, TTF_Font* font, SDL_Color color);
+    
+    /**
+     * @brief 解決済みのフォントによるキャッシュされたテキストテクスチャの取得
+     * @param text テキスト
+     * @param font フォントへのポインタ
+     * @param color 色
+     * @return テキストテクスチャとそのサイズ（失敗時はtextureがnullptr）
+     */
+    TextTexture getTextTextureWithFont(const char* text, TTF_Font* font, SDL_Color color);
+    
+    /**
+     * @brief メモリ予算を超えたテキストテクスチャの追い出し
+     * @details 現在のフレームで使用されたエントリは追い出さない。
+     */
+    void evictTextCache();
 }; 
\ No newline at end of file
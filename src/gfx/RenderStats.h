@@ -0,0 +1,24 @@
+/**
+ * @file RenderStats.h
+ * @brief 描画統計のカウンター
+ * @details Graphicsと各アトラスが1フレーム分の描画処理の回数を記録する。
+ */
+
+#pragma once
+#include <SDL.h>
+
+/**
+ * @brief 1フレーム分の描画統計
+ * @details Graphics::present()で確定し、次のフレームのために0に戻される。
+ */
+struct RenderStats {
+    Uint64 frame = 0;                 /**< @brief フレーム番号 */
+    int drawCalls = 0;                /**< @brief レンダラーへの描画呼び出し数（RenderCopy、RenderGeometry、RenderFillRect、RenderDrawLine、RenderClear） */
+    int fillRects = 0;                /**< @brief 塗りつぶし矩形の描画要求数（drawRect(filled)） */
+    int textureSwitches = 0;          /**< @brief 直前の描画呼び出しとテクスチャが異なった回数 */
+    int textRasterizations = 0;       /**< @brief 文字列のラスタライズ数（TTF_RenderUTF8_Blended） */
+    int glyphRasterizations = 0;      /**< @brief グリフアトラスへのグリフのラスタライズ数 */
+    int texturesCreated = 0;          /**< @brief 作成したテクスチャ数 */
+    int texturesDestroyed = 0;        /**< @brief 破棄したテクスチャ数 */
+    Uint64 pixelsFilled = 0;          /**< @brief 描画呼び出しの描画先の面積の合計（論理座標のピクセル数） */
+};
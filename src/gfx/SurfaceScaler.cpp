@@ -0,0 +1,96 @@
+#include "SurfaceScaler.h"
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+void SurfaceScaler::fitWithin(int width, int height, int maxEdge, int& outWidth, int& outHeight) {
+    if (width <= maxEdge && height <= maxEdge) {
+        outWidth = width;
+        outHeight = height;
+        return;
+    }
+    if (width >= height) {
+        outWidth = maxEdge;
+        outHeight = std::max(1, static_cast<int>(static_cast<long long>(height) * maxEdge / width));
+    } else {
+        outHeight = maxEdge;
+        outWidth = std::max(1, static_cast<int>(static_cast<long long>(width) * maxEdge / height));
+    }
+}
+
+SDL_Surface* SurfaceScaler::downscale(SDL_Surface* source, int width, int height) {
+    if (!source || width <= 0 || height <= 0) {
+        return nullptr;
+    }
+
+    // 入力はARGB8888に揃える（同じフォーマットでもコピーが返る）
+    SDL_Surface* input = SDL_ConvertSurfaceFormat(source, SDL_PIXELFORMAT_ARGB8888, 0);
+    if (!input) {
+        std::cerr << "警告: SurfaceScaler::downscale: サーフェス変換エラー: " << SDL_GetError() << std::endl;
+        return nullptr;
+    }
+    if (width >= input->w && height >= input->h) {
+        return input;
+    }
+    width = std::min(width, input->w);
+    height = std::min(height, input->h);
+
+    SDL_Surface* output = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!output) {
+        std::cerr << "警告: SurfaceScaler::downscale: サーフェス作成エラー: " << SDL_GetError() << std::endl;
+        SDL_FreeSurface(input);
+        return nullptr;
+    }
+
+    if (SDL_MUSTLOCK(input)) SDL_LockSurface(input);
+    if (SDL_MUSTLOCK(output)) SDL_LockSurface(output);
+
+    // 縮小先の各列・各行に対応する元画像の範囲 [begin, end)
+    std::vector<int> columnBegin(width + 1);
+    for (int x = 0; x <= width; x++) {
+        columnBegin[x] = static_cast<int>(static_cast<long long>(x) * input->w / width);
+    }
+    std::vector<int> rowBegin(height + 1);
+    for (int y = 0; y <= height; y++) {
+        rowBegin[y] = static_cast<int>(static_cast<long long>(y) * input->h / height);
+    }
+
+    for (int y = 0; y < height; y++) {
+        Uint32* outRow = reinterpret_cast<Uint32*>(static_cast<Uint8*>(output->pixels) + y * output->pitch);
+        const int sy0 = rowBegin[y];
+        const int sy1 = std::max(rowBegin[y + 1], sy0 + 1);
+        for (int x = 0; x < width; x++) {
+            const int sx0 = columnBegin[x];
+            const int sx1 = std::max(columnBegin[x + 1], sx0 + 1);
+
+            Uint64 sumA = 0, sumR = 0, sumG = 0, sumB = 0;
+            for (int sy = sy0; sy < sy1; sy++) {
+                const Uint32* inRow = reinterpret_cast<const Uint32*>(static_cast<const Uint8*>(input->pixels) + sy * input->pitch);
+                for (int sx = sx0; sx < sx1; sx++) {
+                    const Uint32 pixel = inRow[sx];
+                    const Uint32 a = pixel >> 24;
+                    sumA += a;
+                    sumR += ((pixel >> 16) & 0xFF) * a;
+                    sumG += ((pixel >> 8) & 0xFF) * a;
+                    sumB += (pixel & 0xFF) * a;
+                }
+            }
+
+            const Uint64 count = static_cast<Uint64>(sx1 - sx0) * (sy1 - sy0);
+            Uint32 a = static_cast<Uint32>((sumA + count / 2) / count);
+            Uint32 r = 0, g = 0, b = 0;
+            if (sumA > 0) {
+                // 乗算済みアルファの平均をアルファの合計で割り戻す
+                r = static_cast<Uint32>((sumR + sumA / 2) / sumA);
+                g = static_cast<Uint32>((sumG + sumA / 2) / sumA);
+                b = static_cast<Uint32>((sumB + sumA / 2) / sumA);
+            }
+            outRow[x] = (a << 24) | (r << 16) | (g << 8) | b;
+        }
+    }
+
+    if (SDL_MUSTLOCK(output)) SDL_UnlockSurface(output);
+    if (SDL_MUSTLOCK(input)) SDL_UnlockSurface(input);
+    SDL_FreeSurface(input);
+    return output;
+}
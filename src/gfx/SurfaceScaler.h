@@ -0,0 +1,36 @@
+/**
+ * @file SurfaceScaler.h
+ * @brief サーフェスの縮小処理
+ * @details テクスチャアトラスや縮小済みテクスチャの作成に使用する、CPU側の高品質な縮小処理を提供する。
+ */
+
+#pragma once
+#include <SDL.h>
+
+/**
+ * @brief サーフェスの縮小処理の名前空間
+ */
+namespace SurfaceScaler {
+    /**
+     * @brief 最大辺に収まるサイズの計算
+     * @details アスペクト比を保持したまま、幅と高さがmaxEdge以下になるサイズを求める。
+     * 元のサイズが収まっている場合はそのまま返す。
+     * @param width 元の幅
+     * @param height 元の高さ
+     * @param maxEdge 最大辺の長さ
+     * @param outWidth 計算後の幅（出力）
+     * @param outHeight 計算後の高さ（出力）
+     */
+    void fitWithin(int width, int height, int maxEdge, int& outWidth, int& outHeight);
+
+    /**
+     * @brief 面積平均によるサーフェスの縮小
+     * @details 縮小先の1ピクセルに対応する元画像の範囲を、乗算済みアルファで平均する。
+     * 透明部分の色が縁ににじまないため、スプライトの輪郭がきれいに残る。
+     * @param source 元のサーフェス（任意のピクセルフォーマット）
+     * @param width 縮小後の幅
+     * @param height 縮小後の高さ
+     * @return ARGB8888の新しいサーフェス（呼び出し側でSDL_FreeSurfaceする。失敗時はnullptr）
+     */
+    SDL_Surface* downscale(SDL_Surface* source, int width, int height);
+}
@@ -0,0 +1,230 @@
+#include "TextureAtlas.h"
+#include <algorithm>
+#include <climits>
+#include <iostream>
+
+namespace {
+    // 線形補間で隣の画像がにじまないよう、各領域の周囲に縁の色を複製する幅
+    constexpr int EXTRUDE = 1;
+
+    bool contains(const SDL_Rect& outer, const SDL_Rect& inner) {
+        return inner.x >= outer.x && inner.y >= outer.y &&
+               inner.x + inner.w <= outer.x + outer.w &&
+               inner.y + inner.h <= outer.y + outer.h;
+    }
+}
+
+TextureAtlas::TextureAtlas() : renderer(nullptr), renderStats(nullptr) {
+}
+
+TextureAtlas::~TextureAtlas() {
+    clear();
+}
+
+void TextureAtlas::setRenderer(SDL_Renderer* newRenderer) {
+    if (renderer != newRenderer) {
+        clear();
+        renderer = newRenderer;
+    }
+}
+
+void TextureAtlas::clear() {
+    for (auto& page : pages) {
+        if (page.texture) {
+            SDL_DestroyTexture(page.texture);
+            if (renderStats) renderStats->texturesDestroyed++;
+        }
+    }
+    pages.clear();
+    for (auto& entry : pending) {
+        SDL_FreeSurface(entry.surface);
+    }
+    pending.clear();
+    regions.clear();
+}
+
+void TextureAtlas::add(SDL_Texture* key, SDL_Surface* surface, bool fullResolution) {
+    if (!key || !surface) {
+        if (surface) {
+            SDL_FreeSurface(surface);
+        }
+        return;
+    }
+    pending.push_back({key, surface, fullResolution});
+}
+
+bool TextureAtlas::build() {
+    if (pending.empty()) {
+        return true;
+    }
+    if (!renderer) {
+        std::cerr << "警告: TextureAtlas::build: rendererがnullptrです" << std::endl;
+        return false;
+    }
+
+    // 大きい画像から配置すると空き領域の断片化が少ない
+    std::stable_sort(pending.begin(), pending.end(), [](const Pending& a, const Pending& b) {
+        const int aLong = std::max(a.surface->w, a.surface->h);
+        const int bLong = std::max(b.surface->w, b.surface->h);
+        if (aLong != bLong) return aLong > bLong;
+        return a.surface->w * a.surface->h > b.surface->w * b.surface->h;
+    });
+
+    bool success = true;
+    for (auto& entry : pending) {
+        int page;
+        SDL_Rect rect;
+        if (!allocate(entry.surface->w + EXTRUDE * 2, entry.surface->h + EXTRUDE * 2, page, rect)) {
+            success = false;
+            SDL_FreeSurface(entry.surface);
+            continue;
+        }
+
+        SDL_Rect inner = {rect.x + EXTRUDE, rect.y + EXTRUDE, entry.surface->w, entry.surface->h};
+        if (upload(page, inner, entry.surface)) {
+            Region region;
+            region.page = pages[page].texture;
+            region.rect = inner;
+            region.fullResolution = entry.fullResolution;
+            regions[entry.key] = region;
+        } else {
+            success = false;
+        }
+        SDL_FreeSurface(entry.surface);
+    }
+    pending.clear();
+    return success;
+}
+
+bool TextureAtlas::allocate(int width, int height, int& page, SDL_Rect& rect) {
+    if (width > PAGE_SIZE || height > PAGE_SIZE) {
+        std::cerr << "警告: TextureAtlas: 画像が大きすぎます (" << width << "x" << height << ")" << std::endl;
+        return false;
+    }
+
+    for (int attempt = 0; attempt < 2; attempt++) {
+        // Best Short Side Fit: 余りの短い辺が最小になる空き矩形を選ぶ
+        int bestPage = -1;
+        SDL_Rect best = {0, 0, 0, 0};
+        int bestShort = INT_MAX;
+        int bestLong = INT_MAX;
+        for (int p = 0; p < static_cast<int>(pages.size()); p++) {
+            for (const SDL_Rect& free : pages[p].freeRects) {
+                if (width > free.w || height > free.h) continue;
+                const int leftoverW = free.w - width;
+                const int leftoverH = free.h - height;
+                const int shortSide = std::min(leftoverW, leftoverH);
+                const int longSide = std::max(leftoverW, leftoverH);
+                if (shortSide < bestShort || (shortSide == bestShort && longSide < bestLong)) {
+                    bestPage = p;
+                    best = {free.x, free.y, width, height};
+                    bestShort = shortSide;
+                    bestLong = longSide;
+                }
+            }
+        }
+
+        if (bestPage >= 0) {
+            splitFreeRects(pages[bestPage], best);
+            pruneFreeRects(pages[bestPage]);
+            page = bestPage;
+            rect = best;
+            return true;
+        }
+
+        // どのページにも収まらない場合は新しいページを追加して再試行
+        if (!addPage()) {
+            return false;
+        }
+    }
+    return false;
+}
+
+void TextureAtlas::splitFreeRects(Page& page, const SDL_Rect& used) {
+    std::vector<SDL_Rect> result;
+    result.reserve(page.freeRects.size() + 4);
+    for (const SDL_Rect& free : page.freeRects) {
+        if (!SDL_HasIntersection(&free, &used)) {
+            result.push_back(free);
+            continue;
+        }
+        // 使用矩形の上下左右に残る極大矩形を空き矩形として残す
+        if (used.x > free.x) {
+            result.push_back({free.x, free.y, used.x - free.x, free.h});
+        }
+        if (used.x + used.w < free.x + free.w) {
+            result.push_back({used.x + used.w, free.y, free.x + free.w - (used.x + used.w), free.h});
+        }
+        if (used.y > free.y) {
+            result.push_back({free.x, free.y, free.w, used.y - free.y});
+        }
+        if (used.y + used.h < free.y + free.h) {
+            result.push_back({free.x, used.y + used.h, free.w, free.y + free.h - (used.y + used.h)});
+        }
+    }
+    page.freeRects.swap(result);
+}
+
+void TextureAtlas::pruneFreeRects(Page& page) {
+    auto& rects = page.freeRects;
+    for (size_t i = 0; i < rects.size(); i++) {
+        for (size_t j = i + 1; j < rects.size();) {
+            if (contains(rects[j], rects[i])) {
+                rects.erase(rects.begin() + i);
+                i--;
+                break;
+            }
+            if (contains(rects[i], rects[j])) {
+                rects.erase(rects.begin() + j);
+            } else {
+                j++;
+            }
+        }
+    }
+}
+
+bool TextureAtlas::addPage() {
+    SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, PAGE_SIZE, PAGE_SIZE);
+    if (!texture) {
+        std::cerr << "警告: TextureAtlas: アトラスページ作成エラー: " << SDL_GetError() << std::endl;
+        return false;
+    }
+    if (renderStats) renderStats->texturesCreated++;
+
+    // 静的テクスチャの初期内容は不定なので透明で埋める
+    std::vector<Uint32> transparent(static_cast<size_t>(PAGE_SIZE) * PAGE_SIZE, 0);
+    SDL_UpdateTexture(texture, nullptr, transparent.data(), PAGE_SIZE * static_cast<int>(sizeof(Uint32)));
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(texture, SDL_ScaleModeLinear);
+
+    Page page;
+    page.texture = texture;
+    page.freeRects.push_back({0, 0, PAGE_SIZE, PAGE_SIZE});
+    pages.push_back(page);
+    return true;
+}
+
+bool TextureAtlas::upload(int page, const SDL_Rect& inner, SDL_Surface* surface) {
+    const int width = inner.w + EXTRUDE * 2;
+    const int height = inner.h + EXTRUDE * 2;
+    std::vector<Uint32> pixels(static_cast<size_t>(width) * height);
+
+    if (SDL_MUSTLOCK(surface)) SDL_LockSurface(surface);
+    for (int y = 0; y < height; y++) {
+        // 縁の行・列は最も近い画像内のピクセルを複製する
+        const int sy = std::min(std::max(y - EXTRUDE, 0), inner.h - 1);
+        const Uint32* row = reinterpret_cast<const Uint32*>(static_cast<const Uint8*>(surface->pixels) + sy * surface->pitch);
+        for (int x = 0; x < width; x++) {
+            const int sx = std::min(std::max(x - EXTRUDE, 0), inner.w - 1);
+            pixels[static_cast<size_t>(y) * width + x] = row[sx];
+        }
+    }
+    if (SDL_MUSTLOCK(surface)) SDL_UnlockSurface(surface);
+
+    SDL_Rect outer = {inner.x - EXTRUDE, inner.y - EXTRUDE, width, height};
+    if (SDL_UpdateTexture(pages[page].texture, &outer, pixels.data(), width * static_cast<int>(sizeof(Uint32))) != 0) {
+        std::cerr << "警告: TextureAtlas: 画像の転送エラー: " << SDL_GetError() << std::endl;
+        return false;
+    }
+    return true;
+}
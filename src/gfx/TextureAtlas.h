@@ -0,0 +1,166 @@
+/**
+ * @file TextureAtlas.h
+ * @brief 画像アセット用のテクスチャアトラスを管理するクラス
+ * @details 読み込んだ画像の縮小コピーを大きなページテクスチャにまとめ、
+ * 小さく描画される画像同士が同じテクスチャを共有してバッチ描画されるようにする。
+ */
+
+#pragma once
+#include <SDL.h>
+#include <unordered_map>
+#include <vector>
+#include "RenderStats.h"
+
+/**
+ * @brief 画像アセット用のテクスチャアトラスを管理するクラス
+ * @details 配置にはMaxRects法（Best Short Side Fit）を使用する。
+ * add()で登録した画像はbuild()でまとめて面積の大きい順に配置されるため、
+ * 読み込み時にまとめて登録するほど詰め込み効率が良くなる。
+ * 各領域の周囲1ピクセルには縁の色を複製し、線形補間時に隣の画像がにじまないようにする。
+ */
+class TextureAtlas {
+public:
+    /**
+     * @brief アトラス上の領域
+     */
+    struct Region {
+        SDL_Texture* page = nullptr;    /**< @brief ページテクスチャ */
+        SDL_Rect rect = {0, 0, 0, 0};   /**< @brief ページ内のソース矩形 */
+        bool fullResolution = false;    /**< @brief 元画像と同じ解像度か（縮小されていないか） */
+    };
+
+    /**
+     * @brief コンストラクタ
+     */
+    TextureAtlas();
+
+    /**
+     * @brief デストラクタ
+     */
+    ~TextureAtlas();
+
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    /**
+     * @brief レンダラーの設定
+     * @details レンダラーが変わる場合は既存のページを破棄する。
+     * @param newRenderer SDLレンダラーへのポインタ
+     */
+    void setRenderer(SDL_Renderer* newRenderer);
+
+    /**
+     * @brief 描画統計の記録先の設定
+     * @param stats テクスチャの作成・破棄などを加算する統計（nullptrで記録しない）
+     */
+    void setRenderStats(RenderStats* stats) { renderStats = stats; }
+
+    /**
+     * @brief 全ページと登録済み領域の破棄
+     */
+    void clear();
+
+    /**
+     * @brief 画像の登録
+     * @details 実際の配置はbuild()で行われる。
+     * @param key 領域を引くためのキー（元のテクスチャ）
+     * @param surface アトラスに配置する画像（所有権を受け取る）
+     * @param fullResolution surfaceが元画像と同じ解像度か
+     */
+    void add(SDL_Texture* key, SDL_Surface* surface, bool fullResolution);
+
+    /**
+     * @brief 登録済みの画像の配置とページへの転送
+     * @details 既存のページの空き領域に配置し、収まらない場合はページを追加する。
+     * @return 全ての画像を配置できたか
+     */
+    bool build();
+
+    /**
+     * @brief 領域の検索
+     * @param key 元のテクスチャ
+     * @return 領域へのポインタ（アトラスにない場合はnullptr）
+     */
+    const Region* find(SDL_Texture* key) const {
+        auto it = regions.find(key);
+        return (it != regions.end()) ? &it->second : nullptr;
+    }
+
+    /**
+     * @brief ページ数の取得
+     * @return ページ数
+     */
+    int getPageCount() const { return static_cast<int>(pages.size()); }
+
+    /**
+     * @brief ページの一辺のサイズ（ピクセル）
+     */
+    static constexpr int PAGE_SIZE = 2048;
+
+    /**
+     * @brief アトラスに配置する画像の最大辺（ピクセル）
+     */
+    static constexpr int MAX_ENTRY_SIZE = 256;
+
+private:
+    /**
+     * @brief アトラスページ
+     */
+    struct Page {
+        SDL_Texture* texture;
+        std::vector<SDL_Rect> freeRects;  // 互いに重なりうる極大の空き矩形
+    };
+
+    /**
+     * @brief 配置待ちの画像
+     */
+    struct Pending {
+        SDL_Texture* key;
+        SDL_Surface* surface;
+        bool fullResolution;
+    };
+
+    /**
+     * @brief 空き領域の確保
+     * @param width 幅（縁を含む）
+     * @param height 高さ（縁を含む）
+     * @param page 確保したページ番号（出力）
+     * @param rect 確保した矩形（出力）
+     * @return 確保が成功したか
+     */
+    bool allocate(int width, int height, int& page, SDL_Rect& rect);
+
+    /**
+     * @brief 使用した矩形による空き矩形の分割
+     * @param page 対象のページ
+     * @param used 使用した矩形
+     */
+    void splitFreeRects(Page& page, const SDL_Rect& used);
+
+    /**
+     * @brief 他の空き矩形に含まれる空き矩形の削除
+     * @param page 対象のページ
+     */
+    void pruneFreeRects(Page& page);
+
+    /**
+     * @brief 新しいページの作成
+     * @return 作成が成功したか
+     */
+    bool addPage();
+
+    /**
+     * @brief 画像をページへ転送（周囲1ピクセルに縁の色を複製する）
+     * @param page ページ番号
+     * @param inner 画像を配置する矩形（縁を含まない）
+     * @param surface ARGB8888の画像
+     * @return 転送が成功したか
+     */
+    bool upload(int page, const SDL_Rect& inner, SDL_Surface* surface);
+
+    SDL_Renderer* renderer;
+    RenderStats* renderStats;
+    std::vector<Page> pages;
+    std::vector<Pending> pending;
+    std::unordered_map<SDL_Texture*, Region> regions;
+};
@@ -1,9 +1,44 @@
 #include "InputManager.h"
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 
-InputManager::InputManager() {
+namespace {
+    // 記録ファイルの形式: ヘッダー（識別子、バージョン、乱数シード、開始状態）の後に16バイトの入力が続く
+    const char RECORD_MAGIC[4] = {'F', 'H', 'I', 'R'};
+    const uint32_t RECORD_VERSION = 1;
+    // SDLイベントの種類（0x100以上）と重ならない記録ファイル独自の種類
+    const uint32_t RECORD_UPDATE_COUNT = 1;  // aに固定間隔の更新回数（1回以外のフレームのみ記録）
+    const uint32_t RECORD_END = 2;           // 記録した最後のフレーム
+
+    void writeUint32(std::ostream& out, uint32_t value) {
+        const char bytes[4] = {
+            static_cast<char>(value & 0xFF),
+            static_cast<char>((value >> 8) & 0xFF),
+            static_cast<char>((value >> 16) & 0xFF),
+            static_cast<char>((value >> 24) & 0xFF)
+        };
+        out.write(bytes, sizeof(bytes));
+    }
+
+    bool readUint32(const std::vector<char>& data, size_t& position, uint32_t& value) {
+        if (position + 4 > data.size()) {
+            return false;
+        }
+        value = 0;
+        for (int i = 0; i < 4; i++) {
+            value |= static_cast<uint32_t>(static_cast<unsigned char>(data[position + i])) << (8 * i);
+        }
+        position += 4;
+        return true;
+    }
+}
+
+InputManager::InputManager()
+    : frameIndex(-1), replayPosition(0), replaying(false), replayEndFrame(0), replayUpdateCount(1), seed(0) {
     mouse = {0, 0, false, false, false, false};
     previousMouse = mouse;
+    replayAxes.fill(0.0f);
     
     // ゲームパッド初期化
     gameController = nullptr;
@@ -32,6 +67,7 @@ InputManager::InputManager() {
 }
 
 InputManager::~InputManager() {
+    stopRecording();
     if (gameController) {
         SDL_GameControllerClose(gameController);
     }
@@ -43,9 +79,18 @@ void InputManager::update() {
     
     mouse.leftClicked = false;
     mouse.rightClicked = false;
+    
+    frameIndex++;
+    if (replaying) {
+        replayFrame();
+    }
 }
 
 void InputManager::handleEvent(const SDL_Event& event) {
+    if (recordFile.is_open()) {
+        recordEvent(event);
+    }
+    
     switch (event.type) {
         case SDL_KEYDOWN:
             {
@@ -131,6 +176,9 @@ void InputManager::handleEvent(const SDL_Event& event) {
             break;
             
         case SDL_CONTROLLERAXISMOTION:
+            if (replaying && event.caxis.axis < replayAxes.size()) {
+                replayAxes[event.caxis.axis] = event.caxis.value / 32767.0f;
+            }
             if (event.caxis.axis == SDL_CONTROLLER_AXIS_LEFTX || event.caxis.axis == SDL_CONTROLLER_AXIS_LEFTY) {
                 float value = event.caxis.value / 32767.0f;
                 if (abs(value) > 0.1f) { // デッドゾーンより大きい時のみ表示
@@ -167,6 +215,10 @@ InputKey InputManager::sdlKeyToInputKey(SDL_Keycode key) {
             return InputKey::R;
         case SDLK_n:
             return InputKey::N;
+        case SDLK_F3:
+            return InputKey::F3;
+        case SDLK_F4:
+            return InputKey::F4;
         default:
             return static_cast<InputKey>(-1);
     }
@@ -213,6 +265,9 @@ bool InputManager::isKeyJustReleased(InputKey key) const {
 } 
 
 float InputManager::getLeftStickX() const {
+    if (replaying) {
+        return replayAxes[SDL_CONTROLLER_AXIS_LEFTX];
+    }
     if (gameControllerConnected && gameController) {
         return SDL_GameControllerGetAxis(gameController, SDL_CONTROLLER_AXIS_LEFTX) / 32767.0f;
     }
@@ -220,6 +275,9 @@ float InputManager::getLeftStickX() const {
 }
 
 float InputManager::getLeftStickY() const {
+    if (replaying) {
+        return replayAxes[SDL_CONTROLLER_AXIS_LEFTY];
+    }
     if (gameControllerConnected && gameController) {
         return SDL_GameControllerGetAxis(gameController, SDL_CONTROLLER_AXIS_LEFTY) / 32767.0f;
     }
@@ -227,6 +285,9 @@ float InputManager::getLeftStickY() const {
 }
 
 float InputManager::getRightStickX() const {
+    if (replaying) {
+        return replayAxes[SDL_CONTROLLER_AXIS_RIGHTX];
+    }
     if (gameControllerConnected && gameController) {
         return SDL_GameControllerGetAxis(gameController, SDL_CONTROLLER_AXIS_RIGHTX) / 32767.0f;
     }
@@ -234,8 +295,169 @@ float InputManager::getRightStickX() const {
 }
 
 float InputManager::getRightStickY() const {
+    if (replaying) {
+        return replayAxes[SDL_CONTROLLER_AXIS_RIGHTY];
+    }
     if (gameControllerConnected && gameController) {
         return SDL_GameControllerGetAxis(gameController, SDL_CONTROLLER_AXIS_RIGHTY) / 32767.0f;
     }
     return 0.0f;
-} 
\ No newline at end of file
+}
+
+bool InputManager::startRecording(const std::string& path, uint32_t seed, const std::string& startState) {
+    if (replaying) {
+        std::cerr << "警告: InputManager::startRecording: 再生中は記録できません" << std::endl;
+        return false;
+    }
+    stopRecording();
+    recordFile.open(path, std::ios::binary | std::ios::trunc);
+    if (!recordFile.is_open()) {
+        std::cerr << "警告: InputManager::startRecording: " << path << " を開けませんでした" << std::endl;
+        return false;
+    }
+    this->seed = seed;
+    recordedStartState = startState;
+    recordFile.write(RECORD_MAGIC, sizeof(RECORD_MAGIC));
+    writeUint32(recordFile, RECORD_VERSION);
+    writeUint32(recordFile, seed);
+    writeUint32(recordFile, static_cast<uint32_t>(startState.size()));
+    recordFile.write(startState.data(), startState.size());
+    return true;
+}
+
+void InputManager::stopRecording() {
+    if (!recordFile.is_open()) {
+        return;
+    }
+    writeRecord(RECORD_END, 0, 0);
+    recordFile.close();
+}
+
+bool InputManager::startReplay(const std::string& path) {
+    if (recordFile.is_open()) {
+        std::cerr << "警告: InputManager::startReplay: 記録中は再生できません" << std::endl;
+        return false;
+    }
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "警告: InputManager::startReplay: " << path << " を開けませんでした" << std::endl;
+        return false;
+    }
+    const std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    
+    size_t position = sizeof(RECORD_MAGIC);
+    uint32_t version = 0;
+    uint32_t startStateLength = 0;
+    if (data.size() < sizeof(RECORD_MAGIC) || !std::equal(RECORD_MAGIC, RECORD_MAGIC + sizeof(RECORD_MAGIC), data.begin())
+        || !readUint32(data, position, version) || version != RECORD_VERSION
+        || !readUint32(data, position, seed) || !readUint32(data, position, startStateLength)
+        || position + startStateLength > data.size()) {
+        std::cerr << "警告: InputManager::startReplay: " << path << " は入力の記録ファイルではありません" << std::endl;
+        return false;
+    }
+    recordedStartState.assign(data.begin() + position, data.begin() + position + startStateLength);
+    position += startStateLength;
+    
+    replayEvents.clear();
+    replayEndFrame = 0;
+    RecordedEvent record;
+    uint32_t a = 0;
+    uint32_t b = 0;
+    while (readUint32(data, position, record.frame) && readUint32(data, position, record.type)
+           && readUint32(data, position, a) && readUint32(data, position, b)) {
+        record.a = static_cast<int32_t>(a);
+        record.b = static_cast<int32_t>(b);
+        replayEndFrame = record.frame;
+        if (record.type == RECORD_END) {
+            break;
+        }
+        replayEvents.push_back(record);
+    }
+    
+    replayPosition = 0;
+    replayUpdateCount = 1;
+    replayAxes.fill(0.0f);
+    replaying = true;
+    return true;
+}
+
+void InputManager::recordUpdateCount(int updates) {
+    if (recordFile.is_open() && updates != 1) {
+        writeRecord(RECORD_UPDATE_COUNT, updates, 0);
+    }
+}
+
+void InputManager::recordEvent(const SDL_Event& event) {
+    // ゲームパッドの接続と切断は再生環境の機器に依存するため記録しない
+    switch (event.type) {
+        case SDL_KEYDOWN:
+            if (!event.key.repeat) {
+                writeRecord(event.type, event.key.keysym.sym, 0);
+            }
+            break;
+        case SDL_KEYUP:
+            writeRecord(event.type, event.key.keysym.sym, 0);
+            break;
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP:
+            writeRecord(event.type, event.button.button, 0);
+            break;
+        case SDL_MOUSEMOTION:
+            writeRecord(event.type, event.motion.x, event.motion.y);
+            break;
+        case SDL_CONTROLLERBUTTONDOWN:
+        case SDL_CONTROLLERBUTTONUP:
+            writeRecord(event.type, event.cbutton.button, 0);
+            break;
+        case SDL_CONTROLLERAXISMOTION:
+            writeRecord(event.type, event.caxis.axis, event.caxis.value);
+            break;
+    }
+}
+
+void InputManager::writeRecord(uint32_t type, int32_t a, int32_t b) {
+    writeUint32(recordFile, static_cast<uint32_t>(frameIndex < 0 ? 0 : frameIndex));
+    writeUint32(recordFile, type);
+    writeUint32(recordFile, static_cast<uint32_t>(a));
+    writeUint32(recordFile, static_cast<uint32_t>(b));
+}
+
+void InputManager::replayFrame() {
+    replayUpdateCount = 1;
+    while (replayPosition < replayEvents.size() && static_cast<int>(replayEvents[replayPosition].frame) <= frameIndex) {
+        const RecordedEvent& record = replayEvents[replayPosition++];
+        if (record.type == RECORD_UPDATE_COUNT) {
+            replayUpdateCount = record.a;
+            continue;
+        }
+        
+        SDL_Event event;
+        SDL_zero(event);
+        event.type = record.type;
+        switch (record.type) {
+            case SDL_KEYDOWN:
+            case SDL_KEYUP:
+                event.key.keysym.sym = record.a;
+                break;
+            case SDL_MOUSEBUTTONDOWN:
+            case SDL_MOUSEBUTTONUP:
+                event.button.button = static_cast<Uint8>(record.a);
+                break;
+            case SDL_MOUSEMOTION:
+                event.motion.x = record.a;
+                event.motion.y = record.b;
+                break;
+            case SDL_CONTROLLERBUTTONDOWN:
+            case SDL_CONTROLLERBUTTONUP:
+                event.cbutton.button = static_cast<Uint8>(record.a);
+                break;
+            case SDL_CONTROLLERAXISMOTION:
+                event.caxis.axis = static_cast<Uint8>(record.a);
+                event.caxis.value = static_cast<Sint16>(record.b);
+                break;
+            default:
+                continue;
+        }
+        handleEvent(event);
+    }
+}
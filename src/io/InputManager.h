@@ -2,11 +2,17 @@
  * @file InputManager.h
  * @brief 入力管理を担当するクラス
  * @details キーボード、マウス、ゲームパッドの入力を統一的に管理する。
+ * 処理した入力をフレーム番号付きでファイルに記録し、後から同じ順序で再生することもできる。
  */
 
 #pragma once
 #include <SDL.h>
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 /**
  * @brief 入力キーの種類
@@ -16,7 +22,8 @@ enum class InputKey {
     W, A, S, D,
     SPACE, ESCAPE, ENTER, Q, R,
     GAMEPAD_A, GAMEPAD_B, GAMEPAD_X, GAMEPAD_Y,
-    N
+    N,
+    F3, F4
 };
 
 struct MouseState {
@@ -38,8 +45,45 @@ private:
     SDL_GameController* gameController;
     bool gameControllerConnected;
     
+    // 入力の記録と再生
+    /**
+     * @brief 記録した1件の入力（ファイル上は16バイトのリトルエンディアン）
+     */
+    struct RecordedEvent {
+        uint32_t frame;  // フレーム番号
+        uint32_t type;   // SDLイベントの種類、または記録ファイル独自の種類
+        int32_t a;       // キーコード、ボタン、軸、マウスのX座標など
+        int32_t b;       // 軸の値、マウスのY座標など
+    };
+    int frameIndex;                              // update()の呼び出し回数から数えた現在のフレーム番号
+    std::ofstream recordFile;                    // 記録先（開いていない場合は記録しない）
+    std::vector<RecordedEvent> replayEvents;     // 再生する入力（フレーム番号順）
+    size_t replayPosition;                       // 次に再生する入力の添字
+    bool replaying;
+    uint32_t replayEndFrame;                     // 再生する最後のフレーム番号
+    int replayUpdateCount;                       // 再生中のフレームで実行する固定間隔の更新回数
+    uint32_t seed;                               // 記録時の乱数シード
+    std::string recordedStartState;              // 記録時のデバッグ開始状態
+    std::array<float, 4> replayAxes;             // 再生中のスティックの値（LEFTX, LEFTY, RIGHTX, RIGHTY）
+    
     InputKey sdlKeyToInputKey(SDL_Keycode key);
     InputKey sdlGameControllerButtonToInputKey(SDL_GameControllerButton button);
+    
+    /**
+     * @brief 入力の記録（再生に必要な種類のイベントのみ）
+     * @param event SDLイベント
+     */
+    void recordEvent(const SDL_Event& event);
+    
+    /**
+     * @brief 記録ファイルへの1件の書き込み
+     */
+    void writeRecord(uint32_t type, int32_t a, int32_t b);
+    
+    /**
+     * @brief 現在のフレームに記録された入力の再生
+     */
+    void replayFrame();
 
 public:
     /**
@@ -131,4 +175,71 @@ public:
      * @return Y軸の値（-1.0～1.0）
      */
     float getRightStickY() const;
+    
+    /**
+     * @brief 入力の記録開始
+     * @details 以降にhandleEvent()で処理した入力を、フレーム番号とともにファイルへ書き込む。
+     * @param path 記録先のファイルパス
+     * @param seed 乱数シード（再生時に同じ値で初期化する）
+     * @param startState デバッグ開始状態（再生時に同じ状態から開始する。空の場合はセーブデータから開始）
+     * @return 記録を開始できたか
+     */
+    bool startRecording(const std::string& path, uint32_t seed, const std::string& startState);
+    
+    /**
+     * @brief 入力の記録終了（最後のフレーム番号を書き込んでファイルを閉じる）
+     */
+    void stopRecording();
+    
+    /**
+     * @brief 記録した入力の再生開始
+     * @details 以降のupdate()で、記録時と同じフレームに同じ入力をhandleEvent()へ渡す。
+     * 再生中は実際の入力を渡さないこと。
+     * @param path 記録ファイルのパス
+     * @return ファイルを読み込めたか
+     */
+    bool startReplay(const std::string& path);
+    
+    /**
+     * @brief 固定間隔の更新回数の記録
+     * @details 記録時のフレームごとの更新回数は実行速度で変わるため、再生で同じ回数を実行できるように記録する。
+     * @param updates このフレームで実行した更新回数
+     */
+    void recordUpdateCount(int updates);
+    
+    /**
+     * @brief 入力を記録中か
+     * @return 記録中か
+     */
+    bool isRecording() const { return recordFile.is_open(); }
+    
+    /**
+     * @brief 入力を再生中か
+     * @return 再生中か
+     */
+    bool isReplaying() const { return replaying; }
+    
+    /**
+     * @brief 記録した最後のフレームまで再生したか
+     * @return 再生が終わったか
+     */
+    bool isReplayFinished() const { return replaying && frameIndex >= static_cast<int>(replayEndFrame); }
+    
+    /**
+     * @brief 再生中のフレームで実行する固定間隔の更新回数
+     * @return 記録時の更新回数
+     */
+    int getReplayUpdateCount() const { return replayUpdateCount; }
+    
+    /**
+     * @brief 記録または再生している乱数シードの取得
+     * @return 乱数シード
+     */
+    uint32_t getSeed() const { return seed; }
+    
+    /**
+     * @brief 記録時のデバッグ開始状態の取得
+     * @return デバッグ開始状態（空の場合はセーブデータから開始）
+     */
+    const std::string& getRecordedStartState() const { return recordedStartState; }
 }; 
\ No newline at end of file
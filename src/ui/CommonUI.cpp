@@ -1,16 +1,20 @@
 #include "CommonUI.h"
 #include "../core/utils/ui_config_manager.h"
+#include "../core/FrameProfiler.h"
+#include "../core/FrameArena.h"
 
 void CommonUI::drawNightTimer(Graphics& graphics, float nightTimer, bool nightTimerActive, bool showGameExplanation) {
+    FrameProfiler::Scope profile(FrameProfiler::Section::COMMON_UI);
     if (nightTimerActive && !showGameExplanation) {
         auto& config = UIConfig::UIConfigManager::getInstance();
-        auto commonUIConfig = config.getCommonUIConfig();
+        const auto& commonUIConfig = config.getCommonUIConfig();
         
         int remainingMinutes = static_cast<int>(nightTimer) / 60;
         int remainingSeconds = static_cast<int>(nightTimer) % 60;
         
-        int bgX, bgY;
-        config.calculatePosition(bgX, bgY, commonUIConfig.nightTimer.position, graphics.getScreenWidth(), graphics.getScreenHeight());
+        const UIConfig::UIResolvedRect& bgLayout = config.getLayout(UIConfig::UILayoutId::NIGHT_TIMER, graphics.getScreenWidth(), graphics.getScreenHeight());
+        int bgX = bgLayout.x;
+        int bgY = bgLayout.y;
         SDL_Color bgColor = commonUIConfig.backgroundColor;
         bgColor.a = commonUIConfig.backgroundAlpha;
         graphics.setDrawColor(bgColor.r, bgColor.g, bgColor.b, bgColor.a);
@@ -18,20 +22,22 @@ void CommonUI::drawNightTimer(Graphics& graphics, float nightTimer, bool nightTi
         graphics.setDrawColor(commonUIConfig.borderColor.r, commonUIConfig.borderColor.g, commonUIConfig.borderColor.b, commonUIConfig.borderColor.a);
         graphics.drawRect(bgX, bgY, commonUIConfig.nightTimer.width, commonUIConfig.nightTimer.height, false);
         
-        int textX, textY;
-        config.calculatePosition(textX, textY, commonUIConfig.nightTimerText.position, graphics.getScreenWidth(), graphics.getScreenHeight());
-        std::string timerText = "夜の街まで: " + std::to_string(remainingMinutes) + ":" + 
-                               (remainingSeconds < 10 ? "0" : "") + std::to_string(remainingSeconds);
+        const UIConfig::UIResolvedRect& textLayout = config.getLayout(UIConfig::UILayoutId::NIGHT_TIMER_TEXT, graphics.getScreenWidth(), graphics.getScreenHeight());
+        int textX = textLayout.x;
+        int textY = textLayout.y;
+        const char* timerText = FrameArena::getInstance().format("夜の街まで: %d:%02d", remainingMinutes, remainingSeconds);
         graphics.drawText(timerText, textX, textY, "default", commonUIConfig.nightTimerText.color);
     }
 }
 
 void CommonUI::drawTargetLevel(Graphics& graphics, int targetLevel, bool levelGoalAchieved, int currentLevel) {
+    FrameProfiler::Scope profile(FrameProfiler::Section::COMMON_UI);
     auto& config = UIConfig::UIConfigManager::getInstance();
-    auto commonUIConfig = config.getCommonUIConfig();
+    const auto& commonUIConfig = config.getCommonUIConfig();
     
-    int bgX, bgY;
-    config.calculatePosition(bgX, bgY, commonUIConfig.targetLevel.position, graphics.getScreenWidth(), graphics.getScreenHeight());
+    const UIConfig::UIResolvedRect& bgLayout = config.getLayout(UIConfig::UILayoutId::TARGET_LEVEL, graphics.getScreenWidth(), graphics.getScreenHeight());
+    int bgX = bgLayout.x;
+    int bgY = bgLayout.y;
     SDL_Color bgColor = commonUIConfig.backgroundColor;
     bgColor.a = commonUIConfig.backgroundAlpha;
     graphics.setDrawColor(bgColor.r, bgColor.g, bgColor.b, bgColor.a);
@@ -40,31 +46,34 @@ void CommonUI::drawTargetLevel(Graphics& graphics, int targetLevel, bool levelGo
     graphics.drawRect(bgX, bgY, commonUIConfig.targetLevel.width, commonUIConfig.targetLevel.height, false);
     
     if (targetLevel > 0) { // 目標レベルが設定されている場合のみ表示
-        int textX, textY;
-        config.calculatePosition(textX, textY, commonUIConfig.targetLevelText.position, graphics.getScreenWidth(), graphics.getScreenHeight());
+        const UIConfig::UIResolvedRect& textLayout = config.getLayout(UIConfig::UILayoutId::TARGET_LEVEL_TEXT, graphics.getScreenWidth(), graphics.getScreenHeight());
+        int textX = textLayout.x;
+        int textY = textLayout.y;
         
         if (levelGoalAchieved && currentLevel >= targetLevel) {
             // 目標達成済み（levelGoalAchievedフラグがtrueの場合のみ「進出可能」と表示）
-            std::string goalText = "必要レベル: " + std::to_string(targetLevel);
+            const char* goalText = FrameArena::getInstance().format("必要レベル: %d", targetLevel);
             graphics.drawText(goalText, textX, textY, "default", commonUIConfig.targetLevelAchievedColor);
             graphics.drawText("夜の街に進出可能", textX, textY + commonUIConfig.targetLevelLineSpacing, "default", commonUIConfig.targetLevelAchievedColor);
         } else {
             // 目標未達成
-            std::string goalText = "必要レベル: " + std::to_string(targetLevel);
+            const char* goalText = FrameArena::getInstance().format("必要レベル: %d", targetLevel);
             graphics.drawText(goalText, textX, textY, "default", commonUIConfig.targetLevelText.color);
-            std::string remainingText = "残りレベル: " + std::to_string(targetLevel - currentLevel);
+            const char* remainingText = FrameArena::getInstance().format("残りレベル: %d", targetLevel - currentLevel);
             graphics.drawText(remainingText, textX, textY + commonUIConfig.targetLevelLineSpacing, "default", commonUIConfig.targetLevelRemainingColor);
         }
     }
 }
 
 void CommonUI::drawTrustLevels(Graphics& graphics, std::shared_ptr<Player> player, bool nightTimerActive, bool showGameExplanation) {
+    FrameProfiler::Scope profile(FrameProfiler::Section::COMMON_UI);
     if (nightTimerActive && !showGameExplanation) {
         auto& config = UIConfig::UIConfigManager::getInstance();
-        auto commonUIConfig = config.getCommonUIConfig();
+        const auto& commonUIConfig = config.getCommonUIConfig();
         
-        int bgX, bgY;
-        config.calculatePosition(bgX, bgY, commonUIConfig.trustLevels.position, graphics.getScreenWidth(), graphics.getScreenHeight());
+        const UIConfig::UIResolvedRect& bgLayout = config.getLayout(UIConfig::UILayoutId::TRUST_LEVELS, graphics.getScreenWidth(), graphics.getScreenHeight());
+        int bgX = bgLayout.x;
+        int bgY = bgLayout.y;
         SDL_Color bgColor = commonUIConfig.backgroundColor;
         bgColor.a = commonUIConfig.backgroundAlpha;
         graphics.setDrawColor(bgColor.r, bgColor.g, bgColor.b, bgColor.a);
@@ -72,11 +81,13 @@ void CommonUI::drawTrustLevels(Graphics& graphics, std::shared_ptr<Player> playe
         graphics.setDrawColor(commonUIConfig.borderColor.r, commonUIConfig.borderColor.g, commonUIConfig.borderColor.b, commonUIConfig.borderColor.a);
         graphics.drawRect(bgX, bgY, commonUIConfig.trustLevels.width, commonUIConfig.trustLevels.height, false);
         
-        int textX, textY;
-        config.calculatePosition(textX, textY, commonUIConfig.trustLevelsText.position, graphics.getScreenWidth(), graphics.getScreenHeight());
-        std::string mentalText = "メンタル: " + std::to_string(player->getMental());
-        std::string demonTrustText = "魔王からの信頼: " + std::to_string(player->getDemonTrust());
-        std::string kingTrustText = "王様からの信頼: " + std::to_string(player->getKingTrust());
+        const UIConfig::UIResolvedRect& textLayout = config.getLayout(UIConfig::UILayoutId::TRUST_LEVELS_TEXT, graphics.getScreenWidth(), graphics.getScreenHeight());
+        int textX = textLayout.x;
+        int textY = textLayout.y;
+        FrameArena& arena = FrameArena::getInstance();
+        const char* mentalText = arena.format("メンタル: %d", player->getMental());
+        const char* demonTrustText = arena.format("魔王からの信頼: %d", player->getDemonTrust());
+        const char* kingTrustText = arena.format("王様からの信頼: %d", player->getKingTrust());
         
         graphics.drawText(mentalText, textX, textY, "default", commonUIConfig.trustLevelsText.color);
         graphics.drawText(demonTrustText, textX, textY + commonUIConfig.trustLevelsLineSpacing1, "default", commonUIConfig.trustLevelsText.color);
@@ -85,12 +96,14 @@ void CommonUI::drawTrustLevels(Graphics& graphics, std::shared_ptr<Player> playe
 }
 
 void CommonUI::drawGameControllerStatus(Graphics& graphics, bool gameControllerConnected) {
+    FrameProfiler::Scope profile(FrameProfiler::Section::COMMON_UI);
     if (gameControllerConnected) {
         auto& config = UIConfig::UIConfigManager::getInstance();
-        auto commonUIConfig = config.getCommonUIConfig();
+        const auto& commonUIConfig = config.getCommonUIConfig();
         
-        int x, y;
-        config.calculatePosition(x, y, commonUIConfig.gameControllerStatus.position, graphics.getScreenWidth(), graphics.getScreenHeight());
+        const UIConfig::UIResolvedRect& layout = config.getLayout(UIConfig::UILayoutId::GAME_CONTROLLER_STATUS, graphics.getScreenWidth(), graphics.getScreenHeight());
+        int x = layout.x;
+        int y = layout.y;
         graphics.setDrawColor(commonUIConfig.gameControllerStatusColor.r, commonUIConfig.gameControllerStatusColor.g, commonUIConfig.gameControllerStatusColor.b, commonUIConfig.gameControllerStatusColor.a);
         graphics.drawRect(x, y, commonUIConfig.gameControllerStatus.width, commonUIConfig.gameControllerStatus.height, true);
         graphics.setDrawColor(commonUIConfig.borderColor.r, commonUIConfig.borderColor.g, commonUIConfig.borderColor.b, commonUIConfig.borderColor.a);
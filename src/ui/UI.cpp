@@ -41,11 +41,14 @@ void Button::render(Graphics& graphics) {
     
     if (!text.empty()) {
         // フォントが読み込まれているか確認（Windows特有の問題：フォントが読み込まれていない場合にクラッシュする可能性がある）
-        if (graphics.getFont(fontName)) {
+        if (!fontId.isValid()) {
+            fontId = graphics.getFontId(fontName);
+        }
+        if (graphics.getFont(fontId)) {
             int textX = x + width / 2 - (text.length() * 6); // 簡易的な中央寄せ
             int textY = y + height / 2 - 8;
             try {
-                graphics.drawText(text, textX, textY, fontName, textColor);
+                graphics.drawText(text, textX, textY, fontId, textColor);
             } catch (const std::exception& e) {
                 std::cerr << "Button::render drawTextエラー: " << e.what() << std::endl;
             } catch (...) {
@@ -104,7 +107,10 @@ void Label::render(Graphics& graphics) {
     if (!visible || text.empty()) return;
     
     // フォントが読み込まれているか確認（Windows特有の問題：フォントが読み込まれていない場合にクラッシュする可能性がある）
-    if (!graphics.getFont(fontName)) {
+    if (!fontId.isValid()) {
+        fontId = graphics.getFontId(fontName);
+    }
+    if (!graphics.getFont(fontId)) {
         return; // フォントが読み込まれていない場合は描画をスキップ
     }
     
@@ -114,7 +120,7 @@ void Label::render(Graphics& graphics) {
     for (const auto& line : lines) {
         if (!line.empty()) {
             try {
-                graphics.drawText(line, x, currentY, fontName, textColor);
+                graphics.drawText(line, x, currentY, fontId, textColor);
             } catch (const std::exception& e) {
                 std::cerr << "Label::render drawTextエラー: " << e.what() << std::endl;
             } catch (...) {
@@ -200,6 +206,15 @@ void UIManager::handleInput(const InputManager& input) {
     }
 }
 
+bool UIManager::isAnimating() const {
+    for (const auto& element : elements) {
+        if (element->isAnimating()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 // StoryMessageBox
 StoryMessageBox::StoryMessageBox(int x, int y, int width, int height, const std::string& fontName)
     : UIElement(x, y, width, height), fontName(fontName), graphics(nullptr), 
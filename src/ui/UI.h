@@ -56,6 +56,12 @@ public:
      */
     virtual bool handleInput(const InputManager& /*input*/) { return false; }
     
+    /**
+     * @brief 時間経過で表示が変化中か
+     * @return 入力がなくても表示が変化するか（デフォルト: false）
+     */
+    virtual bool isAnimating() const { return false; }
+    
     /**
      * @brief 位置の設定
      * @param newX 新しいX座標
@@ -111,6 +117,7 @@ class Button : public UIElement {
 private:
     std::string text;
     std::string fontName;
+    FontId fontId;  // 初回の描画時にfontNameから解決する
     SDL_Color textColor;
     SDL_Color normalColor;
     SDL_Color hoverColor;
@@ -171,6 +178,7 @@ class Label : public UIElement {
 private:
     std::string text;
     std::string fontName;
+    FontId fontId;  // 初回の描画時にfontNameから解決する
     SDL_Color textColor;
     std::vector<std::string> lines; // 改行で分割された行
 
@@ -297,6 +305,12 @@ public:
      */
     bool isExpired() const { return displayTimer <= 0 && visible; }
     
+    /**
+     * @brief 時間経過で表示が変化中か
+     * @return 表示時間の経過で非表示になる予定か
+     */
+    bool isAnimating() const override { return visible && displayTimer > 0; }
+    
 private:
     /**
      * @brief テクスチャの更新
@@ -345,6 +359,12 @@ public:
      */
     void handleInput(const InputManager& input);
     
+    /**
+     * @brief 時間経過で表示が変化中の要素があるか
+     * @return いずれかの要素が変化中か
+     */
+    bool isAnimating() const;
+    
     /**
      * @brief 要素の取得
      * @return 要素のベクターへの参照
@@ -1,5 +1,5 @@
 #include "MapTerrain.h"
-#include <random>
+#include "../core/Random.h"
 #include <algorithm>
 #include <cmath>
 
@@ -32,8 +32,7 @@ std::vector<std::vector<MapTile>> MapGenerator::generateRealisticMap(int width,
 }
 
 void MapGenerator::addRiver(std::vector<std::vector<MapTile>>& map, int width, int height) {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
+    RandomGenerator& gen = Random::get(RandomStream::MAP);
     
     int riverY = height / 3;
     for (int x = 0; x < width; x++) {
@@ -50,9 +49,8 @@ void MapGenerator::addRiver(std::vector<std::vector<MapTile>>& map, int width, i
         }
     }
     
-    std::uniform_int_distribution<> bridgeDist(5, width - 5);
     for (int i = 0; i < 2; i++) {
-        int bridgeX = bridgeDist(gen);
+        int bridgeX = gen.nextInt(5, width - 5);
         for (int y = 0; y < height; y++) {
             if (map[bridgeX][y].terrain == TerrainType::WATER) {
                 map[bridgeX][y].terrain = TerrainType::BRIDGE;
@@ -62,28 +60,21 @@ void MapGenerator::addRiver(std::vector<std::vector<MapTile>>& map, int width, i
 }
 
 void MapGenerator::addForest(std::vector<std::vector<MapTile>>& map, int width, int height) {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
+    RandomGenerator& gen = Random::get(RandomStream::MAP);
     
-    std::uniform_int_distribution<> forestCount(2, 4);
-    int numForests = forestCount(gen);
+    int numForests = gen.nextInt(2, 4);
     
     for (int f = 0; f < numForests; f++) {
-        std::uniform_int_distribution<> xDist(2, width - 8);
-        std::uniform_int_distribution<> yDist(2, height - 8);
-        std::uniform_int_distribution<> sizeDist(3, 6);
-        
-        int centerX = xDist(gen);
-        int centerY = yDist(gen);
-        int forestSize = sizeDist(gen);
+        int centerX = gen.nextInt(2, width - 8);
+        int centerY = gen.nextInt(2, height - 8);
+        int forestSize = gen.nextInt(3, 6);
         
         for (int y = centerY - forestSize; y <= centerY + forestSize; y++) {
             for (int x = centerX - forestSize; x <= centerX + forestSize; x++) {
                 if (x >= 0 && x < width && y >= 0 && y < height) {
                     double distance = sqrt((x - centerX) * (x - centerX) + (y - centerY) * (y - centerY));
                     if (distance <= forestSize && map[x][y].terrain == TerrainType::GRASS) {
-                        std::uniform_int_distribution<> forestChance(1, 100);
-                        if (forestChance(gen) < 80) {  // 80%の確率で森にする
+                        if (gen.nextInt(1, 100) < 80) {  // 80%の確率で森にする
                             map[x][y].terrain = TerrainType::FOREST;
                         }
                     }
@@ -94,29 +85,22 @@ void MapGenerator::addForest(std::vector<std::vector<MapTile>>& map, int width,
 }
 
 void MapGenerator::addMountains(std::vector<std::vector<MapTile>>& map, int width, int height) {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    
-    std::uniform_int_distribution<> mountainChance(1, 100);
+    RandomGenerator& gen = Random::get(RandomStream::MAP);
     
     for (int y = 0; y < height / 4; y++) {
         for (int x = 0; x < width; x++) {
-            if (map[x][y].terrain == TerrainType::GRASS && mountainChance(gen) < 30) {
+            if (map[x][y].terrain == TerrainType::GRASS && gen.nextInt(1, 100) < 30) {
                 map[x][y].terrain = TerrainType::MOUNTAIN;
             }
         }
     }
     
     // 孤立した山も配置
-    std::uniform_int_distribution<> isolatedCount(1, 3);
-    int numMountains = isolatedCount(gen);
+    int numMountains = gen.nextInt(1, 3);
     
     for (int m = 0; m < numMountains; m++) {
-        std::uniform_int_distribution<> xDist(0, width - 1);
-        std::uniform_int_distribution<> yDist(height / 2, height - 1);
-        
-        int x = xDist(gen);
-        int y = yDist(gen);
+        int x = gen.nextInt(0, width - 1);
+        int y = gen.nextInt(height / 2, height - 1);
         
         if (map[x][y].terrain == TerrainType::GRASS) {
             map[x][y].terrain = TerrainType::MOUNTAIN;
@@ -143,16 +127,13 @@ void MapGenerator::addRoads(std::vector<std::vector<MapTile>>& map, int width, i
 }
 
 void MapGenerator::addRandomObjects(std::vector<std::vector<MapTile>>& map, int width, int height) {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::uniform_int_distribution<> objChance(1, 100);
-    std::uniform_int_distribution<> objType(1, 3);
+    RandomGenerator& gen = Random::get(RandomStream::MAP);
     
     for (int y = 0; y < height; y++) {
         for (int x = 0; x < width; x++) {
-            if (map[x][y].terrain == TerrainType::GRASS && objChance(gen) < 10) {
+            if (map[x][y].terrain == TerrainType::GRASS && gen.nextInt(1, 100) < 10) {
                 map[x][y].hasObject = true;
-                map[x][y].objectType = objType(gen);  // 1:岩, 2:花, 3:小さな木
+                map[x][y].objectType = gen.nextInt(1, 3);  // 1:岩, 2:花, 3:小さな木
             }
         }
     }
@@ -173,10 +154,8 @@ void MapGenerator::smoothTerrain(std::vector<std::vector<MapTile>>& map, int wid
                 }
                 
                 if (forestCount >= 3) {
-                    static std::random_device rd;
-                    static std::mt19937 gen(rd());
-                    std::uniform_int_distribution<> flowerChance(1, 100);
-                    if (flowerChance(gen) < 40) {
+                    RandomGenerator& gen = Random::get(RandomStream::MAP);
+                    if (gen.nextInt(1, 100) < 40) {
                         map[x][y].terrain = TerrainType::FLOWER_FIELD;
                     }
                 }